@@ -48,6 +48,14 @@ public:
                 }
             }
         }
+        for (const Subtask& subtask : constraintSuite.constraints()) {
+            for (const Constraint& constraint : subtask.constraints()) {
+                spec.constraints.push_back({subtask.id(), constraint.description()});
+            }
+        }
+        for (const Constraint& constraint : constraintSuite.multipleTestCasesConstraints()) {
+            spec.multiple_test_cases_constraints.push_back(constraint.description());
+        }
 
         StyleConfig styleConfig = testSpec_->TProblemSpec::buildStyleConfig();
         switch (styleConfig.evaluationStyle()) {
@@ -60,9 +68,11 @@ public:
         }
         spec.evaluator.has_tc_output = styleConfig.hasTcOutput();
         spec.evaluator.has_scorer = styleConfig.hasScorer();
+        spec.evaluator.scoring_style = styleConfig.scoringStyle();
+        spec.evaluator.scoring_epsilon = styleConfig.scoringEpsilon();
 
         GradingConfig gradingConfig = testSpec_->TProblemSpec::buildGradingConfig();
-        spec.limits.time_s = gradingConfig.timeLimit() ;
+        spec.limits.time_ms = gradingConfig.timeLimitMs();
         spec.limits.memory_mb = gradingConfig.memoryLimit();
 
         IOFormat ioFormat = testSpec_->TProblemSpec::buildIOFormat();
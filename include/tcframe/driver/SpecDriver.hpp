@@ -68,6 +68,10 @@ public:
         testCaseDriver_->generateInput(testCasesByName_[testCaseName], out);
     }
 
+    virtual void appendTestCaseInput(const string& testCaseName, ostream* out) {
+        testCaseDriver_->appendInput(testCasesByName_[testCaseName], out);
+    }
+
     virtual void generateSampleTestCaseOutput(const string& testCaseName, ostream* out) {
         testCaseDriver_->generateSampleOutput(testCasesByName_[testCaseName], out);
     }
@@ -76,6 +80,10 @@ public:
         testCaseDriver_->validateOutput(in);
     }
 
+    virtual void validateMultipleTestCasesOutput(istream* in, int testCaseCount) {
+        testCaseDriver_->validateMultipleTestCasesOutput(in, testCaseCount);
+    }
+
     virtual void validateMultipleTestCasesInput(int testCaseCount) {
         testCaseDriver_->validateMultipleTestCasesInput(testCaseCount);
     }
@@ -5,6 +5,7 @@
 #include <stdexcept>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "RawIOManipulator.hpp"
 #include "tcframe/exception.hpp"
@@ -20,6 +21,7 @@ using std::move;
 using std::ostream;
 using std::runtime_error;
 using std::string;
+using std::vector;
 
 namespace tcframe {
 
@@ -46,7 +48,15 @@ public:
     virtual void generateInput(const TestCase& testCase, ostream* out) {
         applyInput(testCase);
         verifyInput(testCase);
-        writeInput(testCase, out);
+        writeInput(testCase, out, true);
+    }
+
+    // Generates the input of a test case to be appended to a combined multiple test cases input, i.e. without the
+    // test case count.
+    virtual void appendInput(const TestCase& testCase, ostream* out) {
+        applyInput(testCase);
+        verifyInput(testCase);
+        writeInput(testCase, out, false);
     }
 
     virtual void generateSampleOutput(const TestCase& testCase, ostream* out) {
@@ -58,6 +68,19 @@ public:
         applyOutput(in);
     }
 
+    // Validates the combined output of multiple test cases, in which each output is preceded by its output prefix.
+    virtual void validateMultipleTestCasesOutput(istream* in, int testCaseCount) {
+        vector<string> prefixes;
+        for (int i = 1; i <= testCaseCount; i++) {
+            if (multipleTestCasesConfig_.outputPrefix()) {
+                prefixes.push_back(StringUtils::interpolate(multipleTestCasesConfig_.outputPrefix().value(), i));
+            } else {
+                prefixes.emplace_back();
+            }
+        }
+        ioManipulator_->parseOutputs(in, prefixes);
+    }
+
     virtual void validateMultipleTestCasesInput(int testCaseCount) {
         *multipleTestCasesConfig_.counter().value() = testCaseCount;
 
@@ -86,8 +109,8 @@ private:
         }
     }
 
-    void writeInput(const TestCase& testCase, ostream* out) {
-        if (multipleTestCasesConfig_.counter()) {
+    void writeInput(const TestCase& testCase, ostream* out, bool withTestCaseCount) {
+        if (withTestCaseCount && multipleTestCasesConfig_.counter()) {
             int testCaseCount = 1;
             rawIOManipulator_->printLine(out, StringUtils::toString(testCaseCount));
         }
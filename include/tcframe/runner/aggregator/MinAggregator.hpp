@@ -30,6 +30,16 @@ public:
         }
         return {aggregatedVerdict, aggregatedPoints};
     }
+
+    bool zeroesSubtask(const TestCaseVerdict& testCaseVerdict) {
+        if (testCaseVerdict.verdict() == Verdict::ac()) {
+            return false;
+        }
+        if (testCaseVerdict.verdict() == Verdict::ok()) {
+            return testCaseVerdict.points().value() <= 0;
+        }
+        return true;
+    }
 };
 
 }
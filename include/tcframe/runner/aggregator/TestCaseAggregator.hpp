@@ -12,6 +12,12 @@ public:
     virtual ~TestCaseAggregator() = default;
 
     virtual SubtaskVerdict aggregate(const vector<TestCaseVerdict>& testCaseVerdicts, double subtaskPoints) = 0;
+
+    // Returns whether the verdict alone already makes every subtask containing the test case worth zero points,
+    // regardless of the verdicts of the other test cases.
+    virtual bool zeroesSubtask(const TestCaseVerdict&) {
+        return false;
+    }
 };
 
 }
@@ -49,6 +49,10 @@ public:
         os_->closeOpenedStream(out);
     }
 
+    virtual void appendTestCaseInput(const string& testCaseName, ostream* out) {
+        specDriver_->appendTestCaseInput(testCaseName, out);
+    }
+
     virtual void generateSampleTestCaseOutput(const string& testCaseName, const string& filename) {
         ostream* out = os_->openForWriting(filename);
         specDriver_->generateSampleTestCaseOutput(testCaseName, out);
@@ -61,6 +65,12 @@ public:
         os_->closeOpenedStream(in);
     }
 
+    virtual void validateMultipleTestCasesOutput(const string& filename, int testCaseCount) {
+        istream* in = os_->openForReading(filename);
+        specDriver_->validateMultipleTestCasesOutput(in, testCaseCount);
+        os_->closeOpenedStream(in);
+    }
+
     virtual void validateMultipleTestCasesInput(int testCaseCount) {
         specDriver_->validateMultipleTestCasesInput(testCaseCount);
     }
@@ -2,6 +2,7 @@
 
 #include <string>
 
+#include "tcframe/runner/grader/GradingOptions.hpp"
 #include "tcframe/util.hpp"
 
 using std::string;
@@ -17,25 +18,48 @@ public:
         GRADE
     };
 
+    enum class Format {
+        TEXT,
+        JSON
+    };
+
 private:
     Command command_;
 
     bool brief_ = false;
     optional<string> communicator_;
+    Format format_ = Format::TEXT;
+    bool incremental_ = false;
+    optional<int> jobs_;
     optional<int> memoryLimit_;
     bool noMemoryLimit_ = false;
     bool noTimeLimit_ = false;
+    GradingOrder order_ = GradingOrder::CANONICAL;
+    optional<string> outputCache_;
+    optional<int> outputCacheSize_;
+    bool paranoidIncremental_ = false;
+    bool rssMemoryLimit_ = false;
     optional<string> scorer_;
     optional<unsigned> seed_;
+    bool seedPerTestCase_ = false;
+    bool stopOnFirstFailure_ = false;
     optional<string> solution_;
+    bool stream_ = false;
+    optional<int> threads_;
     optional<int> timeLimit_;
+    optional<int> timeLimitMs_;
     optional<string> output_;
+    string runnerPath_;
 
 public:
     Command command() const {
         return command_;
     }
 
+    const string& runnerPath() const {
+        return runnerPath_;
+    }
+
     bool brief() const {
         return brief_;
     }
@@ -44,6 +68,22 @@ public:
         return communicator_;
     }
 
+    Format format() const {
+        return format_;
+    }
+
+    bool incremental() const {
+        return incremental_;
+    }
+
+    bool paranoidIncremental() const {
+        return paranoidIncremental_;
+    }
+
+    const optional<int>& jobs() const {
+        return jobs_;
+    }
+
     const optional<int>& memoryLimit() const {
         return memoryLimit_;
     }
@@ -56,10 +96,26 @@ public:
         return noTimeLimit_;
     }
 
+    GradingOrder order() const {
+        return order_;
+    }
+
     const optional<string>& output() const {
         return output_;
     }
 
+    const optional<string>& outputCache() const {
+        return outputCache_;
+    }
+
+    const optional<int>& outputCacheSize() const {
+        return outputCacheSize_;
+    }
+
+    bool rssMemoryLimit() const {
+        return rssMemoryLimit_;
+    }
+
     const optional<string>& scorer() const {
         return scorer_;
     }
@@ -68,13 +124,33 @@ public:
         return seed_;
     }
 
+    bool seedPerTestCase() const {
+        return seedPerTestCase_;
+    }
+
     const optional<string>& solution() const {
         return solution_;
     }
 
+    bool stopOnFirstFailure() const {
+        return stopOnFirstFailure_;
+    }
+
+    bool stream() const {
+        return stream_;
+    }
+
+    const optional<int>& threads() const {
+        return threads_;
+    }
+
     const optional<int>& timeLimit() const {
         return timeLimit_;
     }
+
+    const optional<int>& timeLimitMs() const {
+        return timeLimitMs_;
+    }
 };
 
 }
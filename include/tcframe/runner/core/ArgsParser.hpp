@@ -30,9 +30,22 @@ public:
                 { "seed",            required_argument, nullptr, 'h'},
                 { "solution",        required_argument, nullptr, 'i'},
                 { "time-limit",      required_argument, nullptr, 'j'},
+                { "threads",         required_argument, nullptr, 'k'},
+                { "jobs",            required_argument, nullptr, 'l'},
+                { "stream",          no_argument      , nullptr, 'm'},
+                { "time-limit-ms",   required_argument, nullptr, 'n'},
+                { "rss-memory-limit", no_argument     , nullptr, 'o'},
+                { "format",          required_argument, nullptr, 'p'},
+                { "stop-on-first-failure", no_argument, nullptr, 'q'},
+                { "order",           required_argument, nullptr, 'r'},
+                { "output-cache",    required_argument, nullptr, 's'},
+                { "output-cache-size", required_argument, nullptr, 't'},
+                { "incremental",     optional_argument, nullptr, 'u'},
+                { "seed-per-test-case", no_argument   , nullptr, 'v'},
                 { 0, 0, 0, 0 }};
 
         Args args;
+        args.runnerPath_ = argc >= 1 ? argv[0] : "";
         args.command_ = Args::Command::GENERATE;
         if (argc >= 2 && strcmp(argv[1], "grade") == 0) {
             args.command_ = Args::Command::GRADE;
@@ -76,6 +89,43 @@ public:
                 case 'j':
                     args.timeLimit_ = StringUtils::toNumber<int>(optarg);
                     break;
+                case 'k':
+                    args.threads_ = StringUtils::toNumber<int>(optarg);
+                    break;
+                case 'l':
+                    args.jobs_ = StringUtils::toNumber<int>(optarg);
+                    break;
+                case 'm':
+                    args.stream_ = true;
+                    break;
+                case 'n':
+                    args.timeLimitMs_ = StringUtils::toNumber<int>(optarg);
+                    break;
+                case 'o':
+                    args.rssMemoryLimit_ = true;
+                    break;
+                case 'p':
+                    args.format_ = parseFormat(optarg);
+                    break;
+                case 'q':
+                    args.stopOnFirstFailure_ = true;
+                    break;
+                case 'r':
+                    args.order_ = parseOrder(optarg);
+                    break;
+                case 's':
+                    args.outputCache_ = optional<string>(optarg);
+                    break;
+                case 't':
+                    args.outputCacheSize_ = StringUtils::toNumber<int>(optarg);
+                    break;
+                case 'u':
+                    args.incremental_ = true;
+                    args.paranoidIncremental_ = optarg != nullptr && parseIncrementalMode(optarg);
+                    break;
+                case 'v':
+                    args.seedPerTestCase_ = true;
+                    break;
                 case ':':
                     throw runtime_error("tcframe: option " + string(argv[optind - 1]) + " requires an argument");
                 case '?':
@@ -85,8 +135,51 @@ public:
             }
         }
 
+        // Reseeding before every test case changes the generated test cases, so it must not be implied by an option
+        // that is only meant to change how they are generated.
+        if (!args.seedPerTestCase_) {
+            if (args.jobs_) {
+                throw runtime_error("tcframe: option --jobs requires --seed-per-test-case");
+            }
+            if (args.incremental_) {
+                throw runtime_error("tcframe: option --incremental requires --seed-per-test-case");
+            }
+        }
+
         return args;
     }
+
+private:
+    static Args::Format parseFormat(const string& format) {
+        if (format == "text") {
+            return Args::Format::TEXT;
+        }
+        if (format == "json") {
+            return Args::Format::JSON;
+        }
+        throw runtime_error("tcframe: option --format must be either 'text' or 'json'");
+    }
+
+    // Returns whether the mode is paranoid.
+    static bool parseIncrementalMode(const string& mode) {
+        if (mode == "paranoid") {
+            return true;
+        }
+        throw runtime_error("tcframe: option --incremental only accepts 'paranoid'");
+    }
+
+    static GradingOrder parseOrder(const string& order) {
+        if (order == "canonical") {
+            return GradingOrder::CANONICAL;
+        }
+        if (order == "smallest-first") {
+            return GradingOrder::SMALLEST_FIRST;
+        }
+        if (order == "failing-first") {
+            return GradingOrder::FAILING_FIRST;
+        }
+        throw runtime_error("tcframe: option --order must be either 'canonical', 'smallest-first', or 'failing-first'");
+    }
 };
 
 }
@@ -27,6 +27,7 @@ struct RunnerDefaults {
     static constexpr const char* SOLUTION_COMMAND = "./solution";
     static constexpr const char* SCORER_COMMAND = "./scorer";
     static constexpr const char* COMMUNICATOR_COMMAND = "./communicator";
+    static constexpr int OUTPUT_CACHE_SIZE_MB = 512;
 };
 
 template<typename TProblemSpec>
@@ -35,6 +36,7 @@ private:
     Driver<TProblemSpec>* driver_;
 
     LoggerEngine* loggerEngine_;
+    JsonLoggerEngine* jsonLoggerEngine_;
     OperatingSystem* os_;
 
     RunnerLoggerFactory* runnerLoggerFactory_;
@@ -57,6 +59,7 @@ public:
             AggregatorRegistry* aggregatorRegistry)
             : driver_(driver)
             , loggerEngine_(loggerEngine)
+            , jsonLoggerEngine_(nullptr)
             , os_(os)
             , runnerLoggerFactory_(runnerLoggerFactory)
             , graderLoggerFactory_(graderLoggerFactory)
@@ -66,10 +69,14 @@ public:
             , aggregatorRegistry_(aggregatorRegistry) {}
 
     int run(int argc, char* argv[]) {
-        auto runnerLogger = runnerLoggerFactory_->create(loggerEngine_);
-
         try {
             Args args = parseArgs(argc, argv);
+            if (args.format() == Args::Format::JSON) {
+                jsonLoggerEngine_ = new JsonLoggerEngine();
+                loggerEngine_ = jsonLoggerEngine_;
+            }
+
+            auto runnerLogger = runnerLoggerFactory_->create(loggerEngine_);
             pair<SpecYaml, SpecDriver*> spec = buildSpec(runnerLogger);
             auto specClient = new SpecClient(spec.second, os_);
 
@@ -108,9 +115,23 @@ private:
     int generate(const Args& args, const SpecYaml& spec, SpecClient* specClient) {
         auto optionsBuilder = GenerationOptionsBuilder(spec.slug)
                 .setSeed(args.seed().value_or(unsigned(RunnerDefaults::SEED)))
+                .setSeedsPerTestCase(args.seedPerTestCase())
                 .setSolutionCommand(args.solution().value_or(string(RunnerDefaults::SOLUTION_COMMAND)))
                 .setOutputDir(args.output().value_or(string(RunnerDefaults::OUTPUT_DIR)));
 
+        if (args.jobs()) {
+            optionsBuilder.setJobs(args.jobs().value());
+        }
+        optionsBuilder.setStreamsMultipleTestCases(args.stream());
+        if (args.incremental()) {
+            optionsBuilder.setIncremental(computeBuildFingerprint(args, spec));
+        }
+        if (args.outputCache()) {
+            optionsBuilder.setOutputCache(
+                    args.outputCache().value(),
+                    args.outputCacheSize().value_or(int(RunnerDefaults::OUTPUT_CACHE_SIZE_MB)));
+        }
+
         EvaluatorConfig evaluatorConfig = evaluatorRegistry_->getConfig(spec.evaluator.slug);
         if (evaluatorConfig.testCaseOutputType() == TestCaseOutputType::NOT_REQUIRED) {
             optionsBuilder.setHasTcOutput(false);
@@ -120,11 +141,18 @@ private:
 
         GenerationOptions options = optionsBuilder.build();
 
-        auto helperCommands = getHelperCommands(args, spec.evaluator.has_scorer);
-        auto evaluator = evaluatorRegistry_->get(spec.evaluator.slug, os_, helperCommands);
-        auto logger = new DefaultGeneratorLogger(loggerEngine_);
-        auto testCaseGenerator = new TestCaseGenerator(specClient, evaluator, logger);
-        auto generator = generatorFactory_->create(specClient, testCaseGenerator, os_, logger);
+        auto helperCommands = getHelperCommands(args, spec.evaluator);
+        auto evaluator = evaluatorRegistry_->get(
+                spec.evaluator.slug, os_, helperCommands, buildEvaluatorConfig(spec.evaluator));
+        GeneratorLogger* logger;
+        if (jsonLoggerEngine_ != nullptr) {
+            logger = new JsonGeneratorLogger(jsonLoggerEngine_);
+        } else {
+            logger = new DefaultGeneratorLogger(loggerEngine_);
+        }
+        auto outputCache = new SolutionOutputCache();
+        auto testCaseGenerator = new TestCaseGenerator(specClient, evaluator, logger, outputCache);
+        auto generator = generatorFactory_->create(specClient, testCaseGenerator, os_, logger, outputCache);
 
         return generator->generate(options) ? 0 : 1;
     }
@@ -135,44 +163,114 @@ private:
                 .setOutputDir(args.output().value_or(string(RunnerDefaults::OUTPUT_DIR)));
 
         if (!args.noTimeLimit()) {
-            optionsBuilder.setTimeLimit(args.timeLimit().value_or(spec.limits.time_s));
+            int timeLimitMs = spec.limits.time_ms;
+            if (args.timeLimitMs()) {
+                timeLimitMs = args.timeLimitMs().value();
+            } else if (args.timeLimit()) {
+                timeLimitMs = args.timeLimit().value() * 1000;
+            }
+            optionsBuilder.setTimeLimit(timeLimitMs);
         }
         if (!args.noMemoryLimit()) {
-            optionsBuilder.setMemoryLimit(args.memoryLimit().value_or(spec.limits.memory_mb));
+            optionsBuilder
+                    .setMemoryLimit(args.memoryLimit().value_or(spec.limits.memory_mb))
+                    .setRssMemoryLimit(args.rssMemoryLimit());
         }
 
         vector<double> subtaskPoints;
         for (const SubtaskYaml& subtask : spec.subtasks) {
             subtaskPoints.push_back(subtask.points);
         }
-        optionsBuilder.setSubtaskPoints(subtaskPoints);
+        optionsBuilder
+                .setSubtaskPoints(subtaskPoints)
+                .setStopsOnFirstFailure(args.stopOnFirstFailure())
+                .setOrder(args.order());
 
         GradingOptions options = optionsBuilder.build();
 
-        auto logger = graderLoggerFactory_->create(loggerEngine_, args.brief());
-        auto helperCommands = getHelperCommands(args, spec.evaluator.has_scorer);
-        auto evaluator = evaluatorRegistry_->get(spec.evaluator.slug, os_, helperCommands);
+        GraderLogger* logger;
+        if (jsonLoggerEngine_ != nullptr) {
+            logger = graderLoggerFactory_->createJson(jsonLoggerEngine_);
+        } else {
+            logger = graderLoggerFactory_->create(loggerEngine_, args.brief());
+        }
+        auto helperCommands = getHelperCommands(args, spec.evaluator);
+        EvaluatorConfig evaluatorConfig = buildEvaluatorConfig(spec.evaluator);
+        auto evaluator = evaluatorRegistry_->get(spec.evaluator.slug, os_, helperCommands, evaluatorConfig);
         auto testCaseGrader = new TestCaseGrader(evaluator, logger);
         auto aggregator = aggregatorRegistry_->getTestCaseAggregator(!spec.subtasks.empty());
         auto subtaskAggregator = aggregatorRegistry_->getSubtaskAggregator();
-        auto grader = graderFactory_->create(specClient, testCaseGrader, aggregator, subtaskAggregator, logger);
+        int threads = args.threads().value_or(1);
+        int workersCount = threads > 1 ? threads : 0;
+        auto workers = createGradingWorkers(workersCount, spec.evaluator.slug, helperCommands, evaluatorConfig);
+        auto scheduler = new GradingScheduler(os_);
+        auto grader = graderFactory_->create(
+                specClient, testCaseGrader, aggregator, subtaskAggregator, logger, workers, scheduler);
 
         grader->grade(options);
         return 0;
     }
 
+    vector<GradingWorker> createGradingWorkers(
+            int workersCount,
+            const string& evaluatorSlug,
+            const map<string, string>& helperCommands,
+            const EvaluatorConfig& evaluatorConfig) {
+
+        vector<GradingWorker> workers;
+        for (int id = 1; id <= workersCount; id++) {
+            string sandboxDir = SandboxPathCreator::createSandboxDir(id);
+            os_->forceMakeDir(sandboxDir);
+
+            auto logger = new BufferedGraderLogger();
+            auto evaluator = evaluatorRegistry_->get(evaluatorSlug, os_, helperCommands, evaluatorConfig, sandboxDir);
+            workers.emplace_back(new TestCaseGrader(evaluator, logger), logger);
+        }
+        return workers;
+    }
+
+    // Identifies what every test case depends on besides its own definition: the constraints, which validate it, and
+    // the solution, which produces its output. Other parts of the spec (e.g. the I/O format, or functions called by
+    // the test cases) are only covered in the paranoid mode, which identifies the whole runner instead; any change to
+    // the spec then makes every test case be generated again. The runner is read through /proc/self/exe where
+    // available, as argv[0] is not a readable path when the runner is found via PATH.
+    static string computeBuildFingerprint(const Args& args, const SpecYaml& spec) {
+        Hasher hasher;
+        for (const ConstraintYaml& constraint : spec.constraints) {
+            hasher.add(StringUtils::toString(constraint.subtask_id)).add(constraint.description);
+        }
+        for (const string& constraint : spec.multiple_test_cases_constraints) {
+            hasher.add(constraint);
+        }
+        hasher.addCommand(args.solution().value_or(string(RunnerDefaults::SOLUTION_COMMAND)));
+        if (args.paranoidIncremental() && !hasher.addFile("/proc/self/exe")) {
+            hasher.addFile(args.runnerPath());
+        }
+        return hasher.hex();
+    }
+
     void cleanUp() {
-        os_->execute(ExecutionRequestBuilder().setCommand("rm __tcframe_*").build());
+        os_->execute(ExecutionRequestBuilder().setCommand("rm -rf __tcframe_*").build());
     }
 
-    static map<string, string> getHelperCommands(const Args& args, bool hasScorer) {
+    static map<string, string> getHelperCommands(const Args& args, const EvaluatorYaml& evaluator) {
         map<string, string> helperCommands;
-        if (hasScorer) {
+        if (evaluator.has_scorer) {
             helperCommands["scorer"] = args.scorer().value_or(string(RunnerDefaults::SCORER_COMMAND));
         }
         helperCommands["communicator"] = args.communicator().value_or(string(RunnerDefaults::COMMUNICATOR_COMMAND));
         return helperCommands;
     };
+
+    static EvaluatorConfig buildEvaluatorConfig(const EvaluatorYaml& evaluator) {
+        EvaluatorConfigBuilder builder;
+        if (!evaluator.has_scorer) {
+            builder
+                    .setBuiltInScorer(evaluator.scoring_style)
+                    .setScorerEpsilon(evaluator.scoring_epsilon);
+        }
+        return builder.build();
+    }
 };
 
 }
@@ -22,14 +22,23 @@ private:
     OperatingSystem* os_;
     TestCaseVerdictParser* testCaseVerdictParser_;
     Scorer* scorer_;
+    string evaluationFilename_;
 
 public:
     virtual ~BatchEvaluator() = default;
 
     BatchEvaluator(OperatingSystem* os, TestCaseVerdictParser* testCaseVerdictParser, Scorer* scorer)
+            : BatchEvaluator(os, testCaseVerdictParser, scorer, "") {}
+
+    BatchEvaluator(
+            OperatingSystem* os,
+            TestCaseVerdictParser* testCaseVerdictParser,
+            Scorer* scorer,
+            const string& sandboxDir)
             : os_(os)
             , testCaseVerdictParser_(testCaseVerdictParser)
-            , scorer_(scorer) {}
+            , scorer_(scorer)
+            , evaluationFilename_(SandboxPathCreator::createPath(sandboxDir, EVALUATION_OUT_FILENAME)) {}
 
     EvaluationResult evaluate(
             const string& inputFilename,
@@ -39,7 +48,7 @@ public:
         map<string, ExecutionResult> executionResults;
         TestCaseVerdict verdict;
 
-        GenerationResult generationResult = generate(inputFilename, EVALUATION_OUT_FILENAME, options);
+        GenerationResult generationResult = generate(inputFilename, evaluationFilename_, options);
         executionResults["solution"] = generationResult.executionResult();
 
         if (generationResult.verdict()) {
@@ -61,22 +70,26 @@ public:
         auto request = ExecutionRequestBuilder()
                 .setCommand(options.solutionCommand())
                 .setInputFilename(inputFilename)
-                .setOutputFilename(outputFilename);
+                .setOutputFilename(outputFilename)
+                .setMeasuresPeakMemory(options.measuresPeakMemory());
 
         if (options.timeLimit()) {
             request.setTimeLimit(options.timeLimit().value());
         }
         if (options.memoryLimit()) {
-            request.setMemoryLimit(options.memoryLimit().value());
+            request
+                    .setMemoryLimit(options.memoryLimit().value())
+                    .setRssMemoryLimit(options.rssMemoryLimit());
         }
 
         ExecutionResult executionResult = os_->execute(request.build());
-        optional<TestCaseVerdict> verdict = testCaseVerdictParser_->parseExecutionResult(executionResult);
+        optional<TestCaseVerdict> verdict =
+                testCaseVerdictParser_->parseExecutionResult(executionResult, options.timeLimit());
         return {verdict, executionResult};
     }
 
     ScoringResult score(const string& inputFilename, const string& outputFilename) {
-        return scorer_->score(inputFilename, outputFilename, EVALUATION_OUT_FILENAME);
+        return scorer_->score(inputFilename, outputFilename, evaluationFilename_);
     }
 };
 
@@ -18,8 +18,10 @@ struct EvaluationOptions {
 
 private:
     string solutionCommand_;
-    optional<int> timeLimit_;
+    optional<int> timeLimit_; // in milliseconds
     optional<int> memoryLimit_;
+    bool rssMemoryLimit_ = false;
+    bool measuresPeakMemory_ = false;
 
 public:
     const string& solutionCommand() const {
@@ -34,9 +36,17 @@ public:
         return memoryLimit_;
     }
 
+    bool rssMemoryLimit() const {
+        return rssMemoryLimit_;
+    }
+
+    bool measuresPeakMemory() const {
+        return measuresPeakMemory_;
+    }
+
     bool operator==(const EvaluationOptions& o) const {
-        return tie(solutionCommand_, timeLimit_, memoryLimit_) ==
-               tie(o.solutionCommand_, o.timeLimit_, o.memoryLimit_);
+        return tie(solutionCommand_, timeLimit_, memoryLimit_, rssMemoryLimit_, measuresPeakMemory_) ==
+               tie(o.solutionCommand_, o.timeLimit_, o.memoryLimit_, o.rssMemoryLimit_, o.measuresPeakMemory_);
     }
 };
 
@@ -79,6 +89,16 @@ public:
         return *this;
     }
 
+    EvaluationOptionsBuilder& setRssMemoryLimit(bool rssMemoryLimit) {
+        subject_.rssMemoryLimit_ = rssMemoryLimit;
+        return *this;
+    }
+
+    EvaluationOptionsBuilder& setMeasuresPeakMemory(bool measuresPeakMemory) {
+        subject_.measuresPeakMemory_ = measuresPeakMemory;
+        return *this;
+    }
+
     EvaluationOptions build() {
         return move(subject_);
     }
@@ -1,8 +1,13 @@
 #pragma once
 
+#include <tuple>
 #include <utility>
 
+#include "tcframe/spec/config.hpp"
+#include "tcframe/util.hpp"
+
 using std::move;
+using std::tie;
 
 namespace tcframe {
 
@@ -16,14 +21,25 @@ class EvaluatorConfig {
 
 private:
     TestCaseOutputType testCaseOutputType_;
+    optional<ScoringStyle> builtInScorer_;
+    double scorerEpsilon_;
 
 public:
     TestCaseOutputType testCaseOutputType() const {
         return testCaseOutputType_;
     }
 
+    const optional<ScoringStyle>& builtInScorer() const {
+        return builtInScorer_;
+    }
+
+    double scorerEpsilon() const {
+        return scorerEpsilon_;
+    }
+
     bool operator==(const EvaluatorConfig& o) const {
-        return tie(testCaseOutputType_) == tie(o.testCaseOutputType_);
+        return tie(testCaseOutputType_, builtInScorer_, scorerEpsilon_)
+               == tie(o.testCaseOutputType_, o.builtInScorer_, o.scorerEpsilon_);
     }
 };
 
@@ -32,11 +48,26 @@ private:
     EvaluatorConfig subject_;
 
 public:
+    EvaluatorConfigBuilder() {
+        subject_.testCaseOutputType_ = TestCaseOutputType::OPTIONAL;
+        subject_.scorerEpsilon_ = StyleConfig::DEFAULT_SCORING_EPSILON;
+    }
+
     EvaluatorConfigBuilder& setTestCaseOutputType(TestCaseOutputType testCaseOutputType) {
         subject_.testCaseOutputType_ = testCaseOutputType;
         return *this;
     }
 
+    EvaluatorConfigBuilder& setBuiltInScorer(ScoringStyle builtInScorer) {
+        subject_.builtInScorer_ = optional<ScoringStyle>(builtInScorer);
+        return *this;
+    }
+
+    EvaluatorConfigBuilder& setScorerEpsilon(double scorerEpsilon) {
+        subject_.scorerEpsilon_ = scorerEpsilon;
+        return *this;
+    }
+
     EvaluatorConfig build() {
         return move(subject_);
     }
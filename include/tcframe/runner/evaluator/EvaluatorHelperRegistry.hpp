@@ -3,6 +3,7 @@
 #include <string>
 
 #include "tcframe/runner/os.hpp"
+#include "tcframe/spec/config.hpp"
 #include "tcframe/util.hpp"
 #include "communicator.hpp"
 #include "scorer.hpp"
@@ -16,15 +17,38 @@ public:
     virtual ~EvaluatorHelperRegistry() = default;
 
     virtual Scorer* getScorer(OperatingSystem* os, const optional<string>& scorerCommand) {
+        return getScorer(os, scorerCommand, optional<ScoringStyle>(), StyleConfig::DEFAULT_SCORING_EPSILON, "");
+    }
+
+    virtual Scorer* getScorer(
+            OperatingSystem* os,
+            const optional<string>& scorerCommand,
+            const optional<ScoringStyle>& builtInScorer,
+            double scorerEpsilon,
+            const string& sandboxDir) {
+
         if (scorerCommand) {
-            return new CustomScorer(os, new TestCaseVerdictParser(), scorerCommand.value());
-        } else {
-            return new DiffScorer(os);
+            return new CustomScorer(os, new TestCaseVerdictParser(), scorerCommand.value(), sandboxDir);
+        }
+        if (builtInScorer && builtInScorer.value() == ScoringStyle::TOKEN) {
+            return new TokenScorer(os);
         }
+        if (builtInScorer && builtInScorer.value() == ScoringStyle::REAL) {
+            return new RealScorer(os, scorerEpsilon);
+        }
+        return new DiffScorer(os);
     }
 
     virtual Communicator* getCommunicator(OperatingSystem* os, const string& communicatorCommand) {
-        return new Communicator(os, new TestCaseVerdictParser(), communicatorCommand);
+        return getCommunicator(os, communicatorCommand, "");
+    }
+
+    virtual Communicator* getCommunicator(
+            OperatingSystem* os,
+            const string& communicatorCommand,
+            const string& sandboxDir) {
+
+        return new Communicator(os, new TestCaseVerdictParser(), communicatorCommand, sandboxDir);
     }
 };
 
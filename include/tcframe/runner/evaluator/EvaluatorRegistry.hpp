@@ -29,12 +29,27 @@ public:
     explicit EvaluatorRegistry(EvaluatorHelperRegistry* helperRegistry)
             : helperRegistry_(helperRegistry) {}
 
-    virtual Evaluator* get(const string& slug, OperatingSystem* os, const map<string, string>& helperCommands) {
+    virtual Evaluator* get(
+            const string& slug,
+            OperatingSystem* os,
+            const map<string, string>& helperCommands,
+            const EvaluatorConfig& config) {
+
+        return get(slug, os, helperCommands, config, "");
+    }
+
+    virtual Evaluator* get(
+            const string& slug,
+            OperatingSystem* os,
+            const map<string, string>& helperCommands,
+            const EvaluatorConfig& config,
+            const string& sandboxDir) {
+
         if (slug == "batch") {
-            return getBatch(os, helperCommands);
+            return getBatch(os, helperCommands, config, sandboxDir);
         }
         if (slug == "interactive") {
-            return getInteractive(os, helperCommands);
+            return getInteractive(os, helperCommands, sandboxDir);
         }
         return nullptr;
     }
@@ -50,10 +65,20 @@ public:
     }
 
 private:
-    Evaluator* getBatch(OperatingSystem* os, const map<string, string>& helperCommands) {
-        Scorer* scorer = helperRegistry_->getScorer(os, getHelperCommand(helperCommands, "scorer"));
-
-        return new BatchEvaluator(os, new TestCaseVerdictParser(), scorer);
+    Evaluator* getBatch(
+            OperatingSystem* os,
+            const map<string, string>& helperCommands,
+            const EvaluatorConfig& config,
+            const string& sandboxDir) {
+
+        Scorer* scorer = helperRegistry_->getScorer(
+                os,
+                getHelperCommand(helperCommands, "scorer"),
+                config.builtInScorer(),
+                config.scorerEpsilon(),
+                sandboxDir);
+
+        return new BatchEvaluator(os, new TestCaseVerdictParser(), scorer, sandboxDir);
     }
 
     EvaluatorConfig getBatchConfig() {
@@ -62,9 +87,13 @@ private:
                 .build();
     }
 
-    Evaluator* getInteractive(OperatingSystem* os, const map<string, string>& helperCommands) {
+    Evaluator* getInteractive(
+            OperatingSystem* os,
+            const map<string, string>& helperCommands,
+            const string& sandboxDir) {
+
         string communicatorCommand = getHelperCommand(helperCommands, "communicator").value();
-        Communicator* communicator = helperRegistry_->getCommunicator(os, communicatorCommand);
+        Communicator* communicator = helperRegistry_->getCommunicator(os, communicatorCommand, sandboxDir);
 
         return new InteractiveEvaluator(communicator);
     }
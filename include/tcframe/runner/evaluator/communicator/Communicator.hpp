@@ -24,37 +24,50 @@ private:
     OperatingSystem* os_;
     TestCaseVerdictParser* testCaseVerdictParser_;
     string communicatorCommand_;
+    string communicationPipeFilename_;
 
 public:
     virtual ~Communicator() = default;
 
     Communicator(OperatingSystem* os, TestCaseVerdictParser* testCaseVerdictParser, string communicatorCommand)
+            : Communicator(os, testCaseVerdictParser, move(communicatorCommand), "") {}
+
+    Communicator(
+            OperatingSystem* os,
+            TestCaseVerdictParser* testCaseVerdictParser,
+            string communicatorCommand,
+            const string& sandboxDir)
             : os_(os)
             , testCaseVerdictParser_(testCaseVerdictParser)
-            , communicatorCommand_(move(communicatorCommand)) {}
+            , communicatorCommand_(move(communicatorCommand))
+            , communicationPipeFilename_(SandboxPathCreator::createPath(sandboxDir, COMMUNICATION_PIPE_FILENAME)) {}
 
     virtual CommunicationResult communicate(const string& inputFilename, const EvaluationOptions& options) {
         string communicationCommand = string()
-                + "rm -f " + COMMUNICATION_PIPE_FILENAME + " && "
-                + "mkfifo " + COMMUNICATION_PIPE_FILENAME + " && "
-                + communicatorCommand_ + " " + inputFilename + " < " + COMMUNICATION_PIPE_FILENAME
+                + "rm -f " + communicationPipeFilename_ + " && "
+                + "mkfifo " + communicationPipeFilename_ + " && "
+                + communicatorCommand_ + " " + inputFilename + " < " + communicationPipeFilename_
                 + " | "
-                + options.solutionCommand() + " > " + COMMUNICATION_PIPE_FILENAME;
+                + options.solutionCommand() + " > " + communicationPipeFilename_;
 
         auto request = ExecutionRequestBuilder()
-                .setCommand(communicationCommand);
+                .setCommand(communicationCommand)
+                .setMeasuresPeakMemory(options.measuresPeakMemory());
 
         if (options.timeLimit()) {
             request.setTimeLimit(options.timeLimit().value());
         }
         if (options.memoryLimit()) {
-            request.setMemoryLimit(options.memoryLimit().value());
+            request
+                    .setMemoryLimit(options.memoryLimit().value())
+                    .setRssMemoryLimit(options.rssMemoryLimit());
         }
 
         ExecutionResult executionResult = ignoreSIGPIPE(os_->execute(request.build()));
 
         TestCaseVerdict verdict;
-        optional<TestCaseVerdict> maybeVerdict = testCaseVerdictParser_->parseExecutionResult(executionResult);
+        optional<TestCaseVerdict> maybeVerdict =
+                testCaseVerdictParser_->parseExecutionResult(executionResult, options.timeLimit());
 
         if (maybeVerdict) {
             verdict = maybeVerdict.value();
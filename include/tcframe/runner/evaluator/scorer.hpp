@@ -2,5 +2,7 @@
 
 #include "tcframe/runner/evaluator/scorer/CustomScorer.hpp"
 #include "tcframe/runner/evaluator/scorer/DiffScorer.hpp"
+#include "tcframe/runner/evaluator/scorer/RealScorer.hpp"
 #include "tcframe/runner/evaluator/scorer/Scorer.hpp"
 #include "tcframe/runner/evaluator/scorer/ScoringResult.hpp"
+#include "tcframe/runner/evaluator/scorer/TokenScorer.hpp"
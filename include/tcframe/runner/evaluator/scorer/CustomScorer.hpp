@@ -23,14 +23,23 @@ private:
     OperatingSystem* os_;
     TestCaseVerdictParser* testCaseVerdictParser_;
     string scorerCommand_;
+    string scoringFilename_;
 
 public:
     virtual ~CustomScorer() = default;
 
     CustomScorer(OperatingSystem* os, TestCaseVerdictParser* testCaseVerdictParser, string scorerCommand)
+            : CustomScorer(os, testCaseVerdictParser, move(scorerCommand), "") {}
+
+    CustomScorer(
+            OperatingSystem* os,
+            TestCaseVerdictParser* testCaseVerdictParser,
+            string scorerCommand,
+            const string& sandboxDir)
             : os_(os)
             , testCaseVerdictParser_(testCaseVerdictParser)
-            , scorerCommand_(move(scorerCommand)) {}
+            , scorerCommand_(move(scorerCommand))
+            , scoringFilename_(SandboxPathCreator::createPath(sandboxDir, SCORING_OUT_FILENAME)) {}
 
     ScoringResult score(const string& inputFilename, const string& outputFilename, const string& evaluationFilename) {
         string scoringCommand = scorerCommand_
@@ -40,12 +49,12 @@ public:
 
         ExecutionResult executionResult = os_->execute(ExecutionRequestBuilder()
                 .setCommand(scoringCommand)
-                .setOutputFilename(SCORING_OUT_FILENAME)
+                .setOutputFilename(scoringFilename_)
                 .build());
 
         TestCaseVerdict verdict;
         if (executionResult.isSuccessful()) {
-            istream* output = os_->openForReading(SCORING_OUT_FILENAME);
+            istream* output = os_->openForReading(scoringFilename_);
             try {
                 verdict = testCaseVerdictParser_->parseStream(output);
             } catch (runtime_error& e) {
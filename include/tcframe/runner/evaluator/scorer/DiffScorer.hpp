@@ -1,7 +1,13 @@
 #pragma once
 
+#include <cstring>
+#include <deque>
 #include <istream>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
 #include <string>
+#include <vector>
 
 #include "Scorer.hpp"
 #include "ScoringResult.hpp"
@@ -9,13 +15,22 @@
 #include "tcframe/runner/verdict.hpp"
 #include "tcframe/util.hpp"
 
+using std::deque;
 using std::istream;
+using std::numeric_limits;
+using std::ostringstream;
+using std::runtime_error;
+using std::streamsize;
 using std::string;
+using std::vector;
 
 namespace tcframe {
 
 class DiffScorer : public Scorer {
 private:
+    static constexpr size_t CHUNK_SIZE = 1 << 16;
+    static constexpr int CONTEXT_LINES_COUNT = 2;
+
     OperatingSystem* os_;
 
 public:
@@ -25,40 +40,131 @@ public:
             : os_(os) {}
 
     ScoringResult score(const string&, const string& outputFilename, const string& evaluationFilename) {
-        string scoringCommand = string()
-                + "diff --brief " + outputFilename + " " + evaluationFilename + " > /dev/null"
-                + " || "
-                + "( "
-                + "echo 'Diff:'; "
-                + "diff "
-                + "--unchanged-line-format=' %.2dn    %L' "
-                + "--old-line-format='(expected) [line %.2dn]    %L' "
-                + "--new-line-format='(received) [line %.2dn]    %L' "
-                + outputFilename + " " + evaluationFilename
-                + " | head -n 10"
-                + " )";
-
-        ExecutionResult executionResult = os_->execute(ExecutionRequestBuilder()
-                .setCommand(scoringCommand)
-                .setOutputFilename(SCORING_OUT_FILENAME)
-                .build());
-        istream* output = os_->openForReading(SCORING_OUT_FILENAME);
-        string diff = StringUtils::streamToString(output);
-        os_->closeOpenedStream(output);
-
         TestCaseVerdict verdict;
-        if (diff.empty()) {
-            verdict = TestCaseVerdict(Verdict::ac());
-        } else {
-            verdict = TestCaseVerdict(Verdict::wa());
+        string diff;
+        try {
+            long long mismatchOffset = findFirstMismatch(outputFilename, evaluationFilename);
+            if (mismatchOffset < 0) {
+                verdict = TestCaseVerdict(Verdict::ac());
+            } else {
+                verdict = TestCaseVerdict(Verdict::wa());
+                diff = createDiff(outputFilename, evaluationFilename, mismatchOffset);
+            }
+        } catch (runtime_error& e) {
+            verdict = TestCaseVerdict(Verdict::err());
+            diff = e.what();
         }
 
-        // TODO(fushar): Figure out how to directly output the diff to the standard error.
-        auto newExecutionResult = ExecutionResultBuilder(executionResult)
+        auto executionResult = ExecutionResultBuilder()
                 .setStandardError(diff)
                 .build();
 
-        return {verdict, newExecutionResult};
+        return {verdict, executionResult};
+    }
+
+private:
+    // Returns the offset of the first differing byte, or -1 if both files are identical.
+    long long findFirstMismatch(const string& expectedFilename, const string& receivedFilename) {
+        istream* expected = os_->openForReading(expectedFilename);
+        istream* received = os_->openForReading(receivedFilename);
+        if (expected->fail() || received->fail()) {
+            string filename = expected->fail() ? expectedFilename : receivedFilename;
+            os_->closeOpenedStream(expected);
+            os_->closeOpenedStream(received);
+            throw runtime_error("Cannot open file: " + filename);
+        }
+
+        size_t chunkSize = CHUNK_SIZE;
+        vector<char> expectedChunk(chunkSize);
+        vector<char> receivedChunk(chunkSize);
+
+        long long offset = 0;
+        long long mismatchOffset = -1;
+        while (true) {
+            size_t expectedSize = readChunk(expected, expectedChunk);
+            size_t receivedSize = readChunk(received, receivedChunk);
+            size_t commonSize = expectedSize < receivedSize ? expectedSize : receivedSize;
+
+            if (memcmp(expectedChunk.data(), receivedChunk.data(), commonSize) != 0) {
+                size_t i = 0;
+                while (expectedChunk[i] == receivedChunk[i]) {
+                    i++;
+                }
+                mismatchOffset = offset + i;
+                break;
+            }
+            if (expectedSize != receivedSize) {
+                mismatchOffset = offset + commonSize;
+                break;
+            }
+            if (expectedSize < chunkSize) {
+                break;
+            }
+            offset += expectedSize;
+        }
+
+        os_->closeOpenedStream(expected);
+        os_->closeOpenedStream(received);
+        return mismatchOffset;
+    }
+
+    // Mimics the output of diff, showing a few unchanged lines before the first differing line.
+    string createDiff(const string& expectedFilename, const string& receivedFilename, long long mismatchOffset) {
+        istream* expected = os_->openForReading(expectedFilename);
+        istream* received = os_->openForReading(receivedFilename);
+
+        deque<string> contextLines;
+        int lineNumber = 0;
+        long long lineEndOffset = 0;
+        string receivedLine;
+        bool hasReceivedLine;
+
+        // Both files are identical before the mismatch, so the lines before it are read from the received file.
+        while (true) {
+            lineNumber++;
+            hasReceivedLine = (bool) getline(*received, receivedLine);
+            lineEndOffset += receivedLine.size() + 1;
+            if (!hasReceivedLine || lineEndOffset > mismatchOffset) {
+                break;
+            }
+            contextLines.push_back(receivedLine);
+            if ((int) contextLines.size() > CONTEXT_LINES_COUNT) {
+                contextLines.pop_front();
+            }
+        }
+
+        for (int i = 1; i < lineNumber; i++) {
+            expected->ignore(numeric_limits<streamsize>::max(), '\n');
+        }
+        string expectedLine;
+        bool hasExpectedLine = (bool) getline(*expected, expectedLine);
+
+        os_->closeOpenedStream(expected);
+        os_->closeOpenedStream(received);
+
+        ostringstream diff;
+        diff << "Diff:\n";
+        int contextLineNumber = lineNumber - (int) contextLines.size();
+        for (const string& contextLine : contextLines) {
+            diff << " " << formatLineNumber(contextLineNumber++) << "    " << contextLine << "\n";
+        }
+        if (hasExpectedLine) {
+            diff << "(expected) [line " << formatLineNumber(lineNumber) << "]    " << expectedLine << "\n";
+        }
+        if (hasReceivedLine) {
+            diff << "(received) [line " << formatLineNumber(lineNumber) << "]    " << receivedLine << "\n";
+        }
+        return diff.str();
+    }
+
+    static size_t readChunk(istream* in, vector<char>& chunk) {
+        in->read(chunk.data(), chunk.size());
+        return (size_t) in->gcount();
+    }
+
+    static string formatLineNumber(int lineNumber) {
+        string result = StringUtils::toString(lineNumber);
+        return result.size() < 2 ? "0" + result : result;
     }
 };
 
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cmath>
+#include <cstdlib>
+#include <string>
+
+#include "TokenScorer.hpp"
+#include "tcframe/runner/os.hpp"
+
+using std::fabs;
+using std::isfinite;
+using std::string;
+using std::strtod;
+
+namespace tcframe {
+
+class RealScorer : public TokenScorer {
+private:
+    double epsilon_;
+
+public:
+    virtual ~RealScorer() = default;
+
+    RealScorer(OperatingSystem* os, double epsilon)
+            : TokenScorer(os)
+            , epsilon_(epsilon) {}
+
+protected:
+    // Numbers are accepted if their absolute or relative difference is within epsilon;
+    // other tokens must match exactly.
+    bool matches(const string& expectedToken, const string& receivedToken) {
+        double expected, received;
+        if (!parseNumber(expectedToken, expected)) {
+            return expectedToken == receivedToken;
+        }
+        if (!parseNumber(receivedToken, received)) {
+            return false;
+        }
+        double difference = fabs(expected - received);
+        return difference <= epsilon_ || difference <= epsilon_ * fabs(expected);
+    }
+
+private:
+    static bool parseNumber(const string& token, double& result) {
+        const char* begin = token.c_str();
+        char* end;
+        result = strtod(begin, &end);
+        return end == begin + token.size() && isfinite(result);
+    }
+};
+
+}
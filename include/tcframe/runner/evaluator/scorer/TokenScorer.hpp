@@ -0,0 +1,173 @@
+#pragma once
+
+#include <istream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "Scorer.hpp"
+#include "ScoringResult.hpp"
+#include "tcframe/runner/os.hpp"
+#include "tcframe/runner/verdict.hpp"
+#include "tcframe/util.hpp"
+
+using std::istream;
+using std::ostringstream;
+using std::string;
+using std::vector;
+
+namespace tcframe {
+
+class TokenScorer : public Scorer {
+private:
+    static constexpr size_t CHUNK_SIZE = 1 << 16;
+
+    // Reads whitespace-separated tokens from a stream, one chunk at a time.
+    class TokenStream {
+    private:
+        istream* in_;
+        vector<char> chunk_;
+        size_t position_;
+        size_t size_;
+        int lineNumber_;
+
+    public:
+        TokenStream(istream* in, size_t chunkSize)
+                : in_(in)
+                , chunk_(chunkSize)
+                , position_(0)
+                , size_(0)
+                , lineNumber_(1) {}
+
+        // Returns false if there are no more tokens.
+        bool next(string& token, int& lineNumber) {
+            token.clear();
+            if (!skipWhitespaces()) {
+                return false;
+            }
+            lineNumber = lineNumber_;
+            while (true) {
+                size_t begin = position_;
+                while (position_ < size_ && !isWhitespace(chunk_[position_])) {
+                    position_++;
+                }
+                token.append(chunk_.data() + begin, position_ - begin);
+                if (position_ < size_ || !fill()) {
+                    return true;
+                }
+            }
+        }
+
+    private:
+        bool skipWhitespaces() {
+            while (true) {
+                while (position_ < size_ && isWhitespace(chunk_[position_])) {
+                    if (chunk_[position_] == '\n') {
+                        lineNumber_++;
+                    }
+                    position_++;
+                }
+                if (position_ < size_) {
+                    return true;
+                }
+                if (!fill()) {
+                    return false;
+                }
+            }
+        }
+
+        bool fill() {
+            in_->read(chunk_.data(), chunk_.size());
+            size_ = (size_t) in_->gcount();
+            position_ = 0;
+            return size_ > 0;
+        }
+
+        static bool isWhitespace(char c) {
+            return c == ' ' || c == '\n' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+        }
+    };
+
+    OperatingSystem* os_;
+
+public:
+    virtual ~TokenScorer() = default;
+
+    explicit TokenScorer(OperatingSystem* os)
+            : os_(os) {}
+
+    ScoringResult score(const string&, const string& outputFilename, const string& evaluationFilename) {
+        istream* expected = os_->openForReading(outputFilename);
+        istream* received = os_->openForReading(evaluationFilename);
+        if (expected->fail() || received->fail()) {
+            string filename = expected->fail() ? outputFilename : evaluationFilename;
+            os_->closeOpenedStream(expected);
+            os_->closeOpenedStream(received);
+
+            auto executionResult = ExecutionResultBuilder()
+                    .setStandardError("Cannot open file: " + filename)
+                    .build();
+            return {TestCaseVerdict(Verdict::err()), executionResult};
+        }
+
+        TokenStream expectedTokens(expected, CHUNK_SIZE);
+        TokenStream receivedTokens(received, CHUNK_SIZE);
+
+        string expectedToken, receivedToken;
+        int expectedLineNumber = 0, receivedLineNumber = 0;
+        bool hasExpectedToken, hasReceivedToken;
+
+        int tokenNumber = 0;
+        while (true) {
+            tokenNumber++;
+            hasExpectedToken = expectedTokens.next(expectedToken, expectedLineNumber);
+            hasReceivedToken = receivedTokens.next(receivedToken, receivedLineNumber);
+            if (hasExpectedToken != hasReceivedToken || !matches(expectedToken, receivedToken)) {
+                break;
+            }
+            if (!hasExpectedToken) {
+                break;
+            }
+        }
+
+        os_->closeOpenedStream(expected);
+        os_->closeOpenedStream(received);
+
+        TestCaseVerdict verdict;
+        string diff;
+        if (!hasExpectedToken && !hasReceivedToken) {
+            verdict = TestCaseVerdict(Verdict::ac());
+        } else {
+            verdict = TestCaseVerdict(Verdict::wa());
+
+            ostringstream out;
+            out << "Token mismatch at token " << tokenNumber << ":\n";
+            if (hasExpectedToken) {
+                out << "(expected) [line " << formatLineNumber(expectedLineNumber) << "]    " << expectedToken << "\n";
+            }
+            if (hasReceivedToken) {
+                out << "(received) [line " << formatLineNumber(receivedLineNumber) << "]    " << receivedToken << "\n";
+            }
+            diff = out.str();
+        }
+
+        auto executionResult = ExecutionResultBuilder()
+                .setStandardError(diff)
+                .build();
+
+        return {verdict, executionResult};
+    }
+
+protected:
+    virtual bool matches(const string& expectedToken, const string& receivedToken) {
+        return expectedToken == receivedToken;
+    }
+
+private:
+    static string formatLineNumber(int lineNumber) {
+        string result = StringUtils::toString(lineNumber);
+        return result.size() < 2 ? "0" + result : result;
+    }
+};
+
+}
@@ -1,7 +1,10 @@
 #pragma once
 
 #include "tcframe/runner/generator/DefaultGeneratorLogger.hpp"
+#include "tcframe/runner/generator/GenerationManifest.hpp"
 #include "tcframe/runner/generator/GenerationOptions.hpp"
 #include "tcframe/runner/generator/Generator.hpp"
 #include "tcframe/runner/generator/GeneratorLogger.hpp"
+#include "tcframe/runner/generator/JsonGeneratorLogger.hpp"
+#include "tcframe/runner/generator/SolutionOutputCache.hpp"
 #include "tcframe/runner/generator/TestCaseGenerator.hpp"
@@ -11,6 +11,8 @@
 #include "tcframe/spec/verifier.hpp"
 #include "tcframe/util.hpp"
 
+using std::cout;
+using std::flush;
 using std::runtime_error;
 using std::string;
 using std::vector;
@@ -50,6 +52,10 @@ public:
         engine_->logParagraph(2, "Reasons:");
     }
 
+    void logTestCaseUnchangedResult() {
+        engine_->logParagraph(0, "OK (unchanged)");
+    }
+
     void logMultipleTestCasesCombinationIntroduction(const string& testGroupName) {
         engine_->logHangingParagraph(1, "Combining test cases into a single file (" + testGroupName + "): ");
     }
@@ -62,6 +68,17 @@ public:
         engine_->logParagraph(0, "FAILED");
         engine_->logParagraph(2, "Reasons:");
     }
+
+    // The output was already formatted by this logger in a worker process.
+    void logWorkerOutput(const string& output) {
+        cout << output << flush;
+    }
+
+    void logOutputCacheStatistics(int hits, int misses) {
+        engine_->logParagraph(0, "");
+        engine_->logParagraph(0, "Solution output cache: " + StringUtils::toString(hits) + " hit(s), "
+                                 + StringUtils::toString(misses) + " miss(es).");
+    }
 };
 
 }
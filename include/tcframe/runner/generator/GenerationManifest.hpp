@@ -0,0 +1,76 @@
+#pragma once
+
+#include <istream>
+#include <map>
+#include <ostream>
+#include <string>
+#include <tuple>
+#include <utility>
+
+#include "tcframe/util.hpp"
+
+using std::istream;
+using std::map;
+using std::move;
+using std::ostream;
+using std::string;
+using std::tie;
+
+namespace tcframe {
+
+struct GenerationManifestEntry {
+    string fingerprint;
+    string checksum;
+
+    bool operator==(const GenerationManifestEntry& o) const {
+        return tie(fingerprint, checksum) == tie(o.fingerprint, o.checksum);
+    }
+};
+
+// The fingerprints of the generated test cases and the checksums of their files, kept in a small text file with one
+// "<name> <fingerprint> <checksum>" line per test case (or per test group, for problems with multiple test cases per
+// file).
+class GenerationManifest {
+private:
+    map<string, GenerationManifestEntry> entries_;
+
+public:
+    optional<GenerationManifestEntry> get(const string& name) const {
+        auto it = entries_.find(name);
+        if (it == entries_.end()) {
+            return {};
+        }
+        return optional<GenerationManifestEntry>(it->second);
+    }
+
+    void put(const string& name, GenerationManifestEntry entry) {
+        entries_[name] = move(entry);
+    }
+
+    const map<string, GenerationManifestEntry>& entries() const {
+        return entries_;
+    }
+
+    // Reading stops at the first malformed line; the test cases after it are then simply generated again.
+    static GenerationManifest read(istream* in) {
+        GenerationManifest manifest;
+        string name;
+        GenerationManifestEntry entry;
+        while (*in >> name >> entry.fingerprint >> entry.checksum) {
+            manifest.entries_[name] = entry;
+        }
+        return manifest;
+    }
+
+    void write(ostream* out) const {
+        for (const auto& entry : entries_) {
+            *out << entry.first << " " << entry.second.fingerprint << " " << entry.second.checksum << "\n";
+        }
+    }
+
+    bool operator==(const GenerationManifest& o) const {
+        return entries_ == o.entries_;
+    }
+};
+
+}
@@ -5,6 +5,7 @@
 #include <utility>
 
 #include "tcframe/spec/core.hpp"
+#include "tcframe/util.hpp"
 
 using std::move;
 using std::string;
@@ -18,9 +19,16 @@ struct GenerationOptions {
 private:
     string slug_;
     unsigned seed_;
+    bool seedsPerTestCase_ = false;
     string solutionCommand_;
     string outputDir_;
     bool hasTcOutput_;
+    optional<int> jobs_;
+    bool streamsMultipleTestCases_ = false;
+    optional<string> outputCacheDir_;
+    int outputCacheSizeMb_ = 0;
+    bool incremental_ = false;
+    string buildFingerprint_;
 
 public:
     const string& slug() const {
@@ -31,6 +39,12 @@ public:
         return seed_;
     }
 
+    // Whether the random number generator is reseeded before every test case, with a seed derived from the seed, the
+    // test group id, and the test case id. Parallel and incremental generations require it.
+    bool seedsPerTestCase() const {
+        return seedsPerTestCase_;
+    }
+
     const string& solutionCommand() const {
         return solutionCommand_;
     }
@@ -43,9 +57,38 @@ public:
         return hasTcOutput_;
     }
 
+    const optional<int>& jobs() const {
+        return jobs_;
+    }
+
+    bool streamsMultipleTestCases() const {
+        return streamsMultipleTestCases_;
+    }
+
+    const optional<string>& outputCacheDir() const {
+        return outputCacheDir_;
+    }
+
+    int outputCacheSizeMb() const {
+        return outputCacheSizeMb_;
+    }
+
+    bool incremental() const {
+        return incremental_;
+    }
+
+    // Identifies what all test cases depend on besides their own definitions, e.g. the solution. Its changes invalidate
+    // all test cases in incremental generation.
+    const string& buildFingerprint() const {
+        return buildFingerprint_;
+    }
+
     bool operator==(const GenerationOptions& o) const {
-        return tie(slug_, seed_, solutionCommand_, outputDir_, hasTcOutput_) ==
-                tie(o.slug_, o.seed_, o.solutionCommand_, o.outputDir_, o.hasTcOutput_);
+        return tie(slug_, seed_, seedsPerTestCase_, solutionCommand_, outputDir_, hasTcOutput_, jobs_,
+                   streamsMultipleTestCases_, outputCacheDir_, outputCacheSizeMb_, incremental_, buildFingerprint_) ==
+                tie(o.slug_, o.seed_, o.seedsPerTestCase_, o.solutionCommand_, o.outputDir_, o.hasTcOutput_, o.jobs_,
+                    o.streamsMultipleTestCases_, o.outputCacheDir_, o.outputCacheSizeMb_, o.incremental_,
+                    o.buildFingerprint_);
     }
 };
 
@@ -66,6 +109,11 @@ public:
         return *this;
     }
 
+    GenerationOptionsBuilder& setSeedsPerTestCase(bool seedsPerTestCase) {
+        subject_.seedsPerTestCase_ = seedsPerTestCase;
+        return *this;
+    }
+
     GenerationOptionsBuilder& setSolutionCommand(string solutionCommand) {
         subject_.solutionCommand_ = move(solutionCommand);
         return *this;
@@ -81,6 +129,28 @@ public:
         return *this;
     }
 
+    GenerationOptionsBuilder& setJobs(int jobs) {
+        subject_.jobs_ = optional<int>(jobs);
+        return *this;
+    }
+
+    GenerationOptionsBuilder& setStreamsMultipleTestCases(bool streamsMultipleTestCases) {
+        subject_.streamsMultipleTestCases_ = streamsMultipleTestCases;
+        return *this;
+    }
+
+    GenerationOptionsBuilder& setOutputCache(string outputCacheDir, int outputCacheSizeMb) {
+        subject_.outputCacheDir_ = optional<string>(move(outputCacheDir));
+        subject_.outputCacheSizeMb_ = outputCacheSizeMb;
+        return *this;
+    }
+
+    GenerationOptionsBuilder& setIncremental(string buildFingerprint) {
+        subject_.incremental_ = true;
+        subject_.buildFingerprint_ = move(buildFingerprint);
+        return *this;
+    }
+
     GenerationOptions build() {
         return move(subject_);
     }
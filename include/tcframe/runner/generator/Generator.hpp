@@ -1,41 +1,78 @@
 #pragma once
 
-#include <sstream>
+#include <algorithm>
+#include <istream>
+#include <limits>
+#include <map>
+#include <ostream>
+#include <set>
 #include <string>
+#include <utility>
+#include <vector>
 
+#include "GenerationManifest.hpp"
 #include "GenerationOptions.hpp"
 #include "GeneratorLogger.hpp"
+#include "SolutionOutputCache.hpp"
 #include "TestCaseGenerator.hpp"
 #include "tcframe/exception.hpp"
 #include "tcframe/runner/client.hpp"
 #include "tcframe/runner/os.hpp"
 #include "tcframe/spec/core.hpp"
+#include "tcframe/spec/random.hpp"
 #include "tcframe/util.hpp"
 
-using std::ostringstream;
+using std::char_traits;
+using std::istream;
+using std::map;
+using std::max;
+using std::numeric_limits;
+using std::ostream;
+using std::pair;
+using std::set;
+using std::streamsize;
 using std::string;
+using std::vector;
 
 namespace tcframe {
 
 class Generator {
 private:
+    static constexpr const char* WORKER_OUT_FILENAME_PREFIX = "__tcframe_generation_";
+
+    // A unit of work for a forked worker: the whole sample test group (its test cases share the evaluation scratch
+    // files), a whole streamed test group, or a single official test case.
+    struct GenerationJob {
+        int testGroupIndex;
+        vector<int> testCaseIds;
+        bool isFirstInTestGroup;
+        bool isLastInTestGroup;
+        bool isStreamed;
+        bool isUnchanged;
+    };
+
     SpecClient* specClient_;
     TestCaseGenerator* testCaseGenerator_;
     OperatingSystem* os_;
     GeneratorLogger* logger_;
+    SolutionOutputCache* outputCache_;
 
 public:
+    static constexpr const char* MANIFEST_FILENAME = ".generation_manifest";
+
     virtual ~Generator() = default;
 
     Generator(
             SpecClient* specClient,
             TestCaseGenerator* testCaseGenerator,
             OperatingSystem* os,
-            GeneratorLogger* logger)
+            GeneratorLogger* logger,
+            SolutionOutputCache* outputCache)
             : specClient_(specClient)
             , testCaseGenerator_(testCaseGenerator)
             , os_(os)
-            , logger_(logger) {}
+            , logger_(logger)
+            , outputCache_(outputCache) {}
 
     virtual bool generate(const GenerationOptions& options) {
         logger_->logIntroduction();
@@ -44,13 +81,40 @@ public:
         bool hasMultipleTestCases = specClient_->hasMultipleTestCases();
         optional<string> multipleTestCasesOutputPrefix = specClient_->getMultipleTestCasesOutputPrefix();
 
-        specClient_->setSeed(options.seed());
+        if (!options.seedsPerTestCase()) {
+            specClient_->setSeed(options.seed());
+        }
 
-        os_->forceMakeDir(options.outputDir());
+        map<string, string> fingerprints;
+        GenerationManifest manifest;
+        set<string> unchangedNames;
+        if (options.incremental()) {
+            os_->makeDir(options.outputDir());
+            fingerprints = computeFingerprints(testSuite, options, hasMultipleTestCases);
+            manifest = readManifest(options);
+            unchangedNames = findUnchangedNames(fingerprints, manifest, options);
+            removeStaleFiles(fingerprints, manifest, options);
+        } else {
+            os_->forceMakeDir(options.outputDir());
+        }
 
         bool successful = true;
-        for (const TestGroup& testGroup : testSuite.testGroups()) {
-            successful &= generateTestGroup(testGroup, options, hasMultipleTestCases, multipleTestCasesOutputPrefix);
+        if (options.jobs()) {
+            successful = generateInParallel(
+                    testSuite, options, hasMultipleTestCases, multipleTestCasesOutputPrefix, unchangedNames);
+        } else {
+            for (const TestGroup& testGroup : testSuite.testGroups()) {
+                successful &= generateTestGroup(
+                        testGroup, options, hasMultipleTestCases, multipleTestCasesOutputPrefix, unchangedNames);
+            }
+        }
+        if (options.incremental()) {
+            writeManifest(fingerprints, manifest, unchangedNames, successful, options);
+        }
+        if (options.outputCacheDir()) {
+            outputCache_->evict(options);
+            OutputCacheStatistics statistics = outputCache_->statistics();
+            logger_->logOutputCacheStatistics(statistics.hits, statistics.misses);
         }
         if (successful) {
             logger_->logSuccessfulResult();
@@ -65,20 +129,408 @@ private:
             const TestGroup& testGroup,
             const GenerationOptions& options,
             bool hasMultipleTestCases,
-            optional<string> multipleTestCasesOutputPrefix) {
+            optional<string> multipleTestCasesOutputPrefix,
+            const set<string>& unchangedNames) {
 
         logger_->logTestGroupIntroduction(testGroup.id());
 
-        bool successful = true;
-        for (const TestCase& testCase : testGroup.testCases()) {
-            successful &= testCaseGenerator_->generate(testCase, options);
+        vector<int> testCaseIds;
+        for (int id = 1; id <= (int) testGroup.testCases().size(); id++) {
+            testCaseIds.push_back(id);
+        }
+        if (hasMultipleTestCases && unchangedNames.count(TestGroup::createName(options.slug(), testGroup.id()))) {
+            logUnchangedTestCases(testGroup, testCaseIds);
+            return true;
+        }
+
+        if (isStreamed(testGroup, options, hasMultipleTestCases)) {
+            return generateStreamedTestGroup(testGroup, options);
         }
+
+        bool successful = generateTestCases(testGroup, testCaseIds, options, unchangedNames);
         if (successful && hasMultipleTestCases && !testGroup.testCases().empty()) {
             return combineMultipleTestCases(testGroup, options, multipleTestCasesOutputPrefix);
         }
         return successful;
     }
 
+    // Each job runs in a forked worker, with the random number generator reseeded for every test case, so that the
+    // generated test cases do not depend on the number of jobs. The logs of the workers are printed in order, and
+    // their output cache statistics are added to the ones of this process.
+    bool generateInParallel(
+            const TestSuite& testSuite,
+            const GenerationOptions& options,
+            bool hasMultipleTestCases,
+            optional<string> multipleTestCasesOutputPrefix,
+            const set<string>& unchangedNames) {
+
+        const vector<TestGroup>& testGroups = testSuite.testGroups();
+        vector<GenerationJob> jobs = createGenerationJobs(testGroups, options, hasMultipleTestCases, unchangedNames);
+
+        int maxRunningJobs = max(1, options.jobs().value());
+        map<int, size_t> jobIndexByPid;
+        vector<bool> done(jobs.size());
+        vector<bool> successful(jobs.size());
+        size_t nextJob = 0;
+
+        bool allSuccessful = true;
+        bool testGroupSuccessful = true;
+        for (size_t i = 0; i < jobs.size(); i++) {
+            while (nextJob < jobs.size() && (int) jobIndexByPid.size() < maxRunningJobs) {
+                const GenerationJob& job = jobs[nextJob];
+                if (job.testCaseIds.empty() || job.isUnchanged) {
+                    done[nextJob] = successful[nextJob] = true;
+                } else {
+                    const TestGroup& testGroup = testGroups[job.testGroupIndex];
+                    size_t jobIndex = nextJob;
+                    int pid = os_->forkProcess([=] {
+                        OutputCacheStatistics initialStatistics = outputCache_->statistics();
+                        bool jobSuccessful = job.isStreamed
+                                ? generateStreamedTestGroup(testGroup, options)
+                                : generateTestCases(testGroup, job.testCaseIds, options, unchangedNames);
+                        if (options.outputCacheDir()) {
+                            saveWorkerCacheStatistics(jobIndex, initialStatistics);
+                        }
+                        return jobSuccessful;
+                    }, createWorkerOutputFilename(jobIndex));
+                    jobIndexByPid[pid] = nextJob;
+                }
+                nextJob++;
+            }
+            while (!done[i]) {
+                pair<int, bool> result = os_->waitForAnyProcess();
+                size_t jobIndex = jobIndexByPid[result.first];
+                jobIndexByPid.erase(result.first);
+                done[jobIndex] = true;
+                successful[jobIndex] = result.second;
+            }
+
+            const GenerationJob& job = jobs[i];
+            const TestGroup& testGroup = testGroups[job.testGroupIndex];
+            if (job.isFirstInTestGroup) {
+                logger_->logTestGroupIntroduction(testGroup.id());
+                testGroupSuccessful = true;
+            }
+            if (job.isUnchanged) {
+                logUnchangedTestCases(testGroup, job.testCaseIds);
+            } else if (!job.testCaseIds.empty()) {
+                string workerOutputFilename = createWorkerOutputFilename(i);
+                istream* workerOutput = os_->openForReading(workerOutputFilename);
+                logger_->logWorkerOutput(StringUtils::streamToString(workerOutput));
+                os_->closeOpenedStream(workerOutput);
+                os_->removeFile(workerOutputFilename);
+                if (options.outputCacheDir()) {
+                    addWorkerCacheStatistics(i);
+                }
+            }
+
+            testGroupSuccessful &= successful[i];
+            if (job.isLastInTestGroup) {
+                if (testGroupSuccessful && hasMultipleTestCases && !job.isStreamed && !job.isUnchanged
+                        && !testGroup.testCases().empty()) {
+                    testGroupSuccessful = combineMultipleTestCases(testGroup, options, multipleTestCasesOutputPrefix);
+                }
+                allSuccessful &= testGroupSuccessful;
+            }
+        }
+        return allSuccessful;
+    }
+
+    static vector<GenerationJob> createGenerationJobs(
+            const vector<TestGroup>& testGroups,
+            const GenerationOptions& options,
+            bool hasMultipleTestCases,
+            const set<string>& unchangedNames) {
+
+        vector<GenerationJob> jobs;
+        for (int i = 0; i < (int) testGroups.size(); i++) {
+            const TestGroup& testGroup = testGroups[i];
+            int testCasesCount = (int) testGroup.testCases().size();
+            bool streamed = isStreamed(testGroup, options, hasMultipleTestCases);
+
+            if (testGroup.id() == TestGroup::SAMPLE_ID || testCasesCount == 0 || streamed) {
+                vector<int> testCaseIds;
+                for (int id = 1; id <= testCasesCount; id++) {
+                    testCaseIds.push_back(id);
+                }
+                jobs.push_back({i, testCaseIds, true, true, streamed, false});
+            } else {
+                for (int id = 1; id <= testCasesCount; id++) {
+                    jobs.push_back({i, {id}, id == 1, id == testCasesCount, false, false});
+                }
+            }
+        }
+        for (GenerationJob& job : jobs) {
+            job.isUnchanged = isUnchanged(job, testGroups, options, hasMultipleTestCases, unchangedNames);
+        }
+        return jobs;
+    }
+
+    // For problems with multiple test cases per file, the test cases of a test group can only be kept as a whole.
+    static bool isUnchanged(
+            const GenerationJob& job,
+            const vector<TestGroup>& testGroups,
+            const GenerationOptions& options,
+            bool hasMultipleTestCases,
+            const set<string>& unchangedNames) {
+
+        const TestGroup& testGroup = testGroups[job.testGroupIndex];
+        if (job.testCaseIds.empty()) {
+            return false;
+        }
+        if (hasMultipleTestCases) {
+            return unchangedNames.count(TestGroup::createName(options.slug(), testGroup.id())) > 0;
+        }
+        for (int testCaseId : job.testCaseIds) {
+            if (!unchangedNames.count(testGroup.testCases()[testCaseId - 1].name())) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // The sample test cases are never streamed, since their outputs are checked one by one.
+    static bool isStreamed(const TestGroup& testGroup, const GenerationOptions& options, bool hasMultipleTestCases) {
+        return options.streamsMultipleTestCases()
+               && hasMultipleTestCases
+               && testGroup.id() != TestGroup::SAMPLE_ID
+               && !testGroup.testCases().empty();
+    }
+
+    // The test cases are printed straight into the test group input, which is then given to the solution once. No
+    // test case files are created; the combined output is split back into the outputs of the test cases to validate
+    // each of them.
+    bool generateStreamedTestGroup(const TestGroup& testGroup, const GenerationOptions& options) {
+        int testCaseCount = (int) testGroup.testCases().size();
+
+        string testGroupName = TestGroup::createName(options.slug(), testGroup.id());
+        string testGroupIn = TestCasePathCreator::createInputPath(testGroupName, options.outputDir());
+        string testGroupOut = TestCasePathCreator::createOutputPath(testGroupName, options.outputDir());
+
+        ostream* groupIn = os_->openForWriting(testGroupIn);
+        *groupIn << testCaseCount << '\n';
+
+        bool successful = true;
+        for (int id = 1; id <= testCaseCount; id++) {
+            seedTestCase(testGroup, id, options);
+            successful &= testCaseGenerator_->appendInput(testGroup.testCases()[id - 1], groupIn);
+        }
+        os_->closeOpenedStream(groupIn);
+
+        if (!successful) {
+            os_->removeFile(testGroupIn);
+            return false;
+        }
+
+        logger_->logMultipleTestCasesCombinationIntroduction(testGroupName);
+        try {
+            verify(testGroup);
+            if (options.hasTcOutput()) {
+                testCaseGenerator_->generateOutput(testGroupIn, testGroupOut, options);
+                specClient_->validateMultipleTestCasesOutput(testGroupOut, testCaseCount);
+            }
+        } catch (runtime_error& e) {
+            logger_->logMultipleTestCasesCombinationFailedResult();
+            logger_->logError(&e);
+            return false;
+        }
+
+        logger_->logMultipleTestCasesCombinationSuccessfulResult();
+        return true;
+    }
+
+    bool generateTestCases(
+            const TestGroup& testGroup,
+            const vector<int>& testCaseIds,
+            const GenerationOptions& options,
+            const set<string>& unchangedNames) {
+
+        bool successful = true;
+        for (int testCaseId : testCaseIds) {
+            const TestCase& testCase = testGroup.testCases()[testCaseId - 1];
+            if (unchangedNames.count(testCase.name())) {
+                logUnchangedTestCases(testGroup, {testCaseId});
+                continue;
+            }
+            seedTestCase(testGroup, testCaseId, options);
+            successful &= testCaseGenerator_->generate(testCase, options);
+        }
+        return successful;
+    }
+
+    void seedTestCase(const TestGroup& testGroup, int testCaseId, const GenerationOptions& options) {
+        if (options.seedsPerTestCase()) {
+            specClient_->setSeed(SeedDeriver::derive(options.seed(), testGroup.id(), testCaseId));
+        }
+    }
+
+    void logUnchangedTestCases(const TestGroup& testGroup, const vector<int>& testCaseIds) {
+        for (int testCaseId : testCaseIds) {
+            logger_->logTestCaseIntroduction(testGroup.testCases()[testCaseId - 1].name());
+            logger_->logTestCaseUnchangedResult();
+        }
+    }
+
+    // A test case is identified by its seed and its definition: the CASE() description of an official test case, or
+    // the contents of a sample test case. For problems with multiple test cases per file, the test cases of a test
+    // group are identified together, by the name of the test group.
+    static map<string, string> computeFingerprints(
+            const TestSuite& testSuite,
+            const GenerationOptions& options,
+            bool hasMultipleTestCases) {
+
+        map<string, string> fingerprints;
+        for (const TestGroup& testGroup : testSuite.testGroups()) {
+            int testCaseCount = (int) testGroup.testCases().size();
+            if (hasMultipleTestCases && testCaseCount > 0) {
+                Hasher hasher;
+                hasher.add(options.buildFingerprint());
+                for (int id = 1; id <= testCaseCount; id++) {
+                    addTestCaseFingerprint(hasher, testGroup, id, options);
+                }
+                fingerprints[TestGroup::createName(options.slug(), testGroup.id())] = hasher.hex();
+            } else if (!hasMultipleTestCases) {
+                for (int id = 1; id <= testCaseCount; id++) {
+                    Hasher hasher;
+                    hasher.add(options.buildFingerprint());
+                    addTestCaseFingerprint(hasher, testGroup, id, options);
+                    fingerprints[testGroup.testCases()[id - 1].name()] = hasher.hex();
+                }
+            }
+        }
+        return fingerprints;
+    }
+
+    static void addTestCaseFingerprint(
+            Hasher& hasher,
+            const TestGroup& testGroup,
+            int testCaseId,
+            const GenerationOptions& options) {
+
+        const TestCase& testCase = testGroup.testCases()[testCaseId - 1];
+        hasher.add(StringUtils::toString(SeedDeriver::derive(options.seed(), testGroup.id(), testCaseId)));
+        if (testCase.data()->type() == TestCaseDataType::SAMPLE) {
+            auto data = (SampleTestCaseData*) testCase.data();
+            hasher.add(data->input()).add(data->output() ? "+" + data->output().value() : "-");
+        } else {
+            hasher.add(testCase.description().value_or(string()));
+        }
+    }
+
+    // Returns nothing if any of the files is missing.
+    optional<string> computeChecksum(const string& name, const GenerationOptions& options) {
+        vector<string> filenames = {TestCasePathCreator::createInputPath(name, options.outputDir())};
+        if (options.hasTcOutput()) {
+            filenames.push_back(TestCasePathCreator::createOutputPath(name, options.outputDir()));
+        }
+
+        Hasher hasher;
+        for (const string& filename : filenames) {
+            istream* in = os_->openForReading(filename);
+            bool exists = !in->fail();
+            if (exists) {
+                hasher.addStream(in);
+            }
+            os_->closeOpenedStream(in);
+            if (!exists) {
+                return {};
+            }
+        }
+        return optional<string>(hasher.hex());
+    }
+
+    static string createManifestFilename(const GenerationOptions& options) {
+        return options.outputDir() + "/" + MANIFEST_FILENAME;
+    }
+
+    GenerationManifest readManifest(const GenerationOptions& options) {
+        istream* in = os_->openForReading(createManifestFilename(options));
+        GenerationManifest manifest = GenerationManifest::read(in);
+        os_->closeOpenedStream(in);
+        return manifest;
+    }
+
+    // A test case is kept if its fingerprint did not change and its files were not modified since.
+    set<string> findUnchangedNames(
+            const map<string, string>& fingerprints,
+            const GenerationManifest& manifest,
+            const GenerationOptions& options) {
+
+        set<string> unchangedNames;
+        for (const auto& fingerprint : fingerprints) {
+            optional<GenerationManifestEntry> entry = manifest.get(fingerprint.first);
+            if (entry && entry.value().fingerprint == fingerprint.second
+                    && computeChecksum(fingerprint.first, options) == optional<string>(entry.value().checksum)) {
+                unchangedNames.insert(fingerprint.first);
+            }
+        }
+        return unchangedNames;
+    }
+
+    // Removes the files of the test cases that no longer exist.
+    void removeStaleFiles(
+            const map<string, string>& fingerprints,
+            const GenerationManifest& manifest,
+            const GenerationOptions& options) {
+
+        for (const auto& entry : manifest.entries()) {
+            if (!fingerprints.count(entry.first)) {
+                os_->removeFile(TestCasePathCreator::createInputPath(entry.first, options.outputDir()));
+                os_->removeFile(TestCasePathCreator::createOutputPath(entry.first, options.outputDir()));
+            }
+        }
+    }
+
+    // If the generation failed, only the unchanged test cases are recorded, so that the rest are generated again.
+    void writeManifest(
+            const map<string, string>& fingerprints,
+            const GenerationManifest& previousManifest,
+            const set<string>& unchangedNames,
+            bool successful,
+            const GenerationOptions& options) {
+
+        GenerationManifest manifest;
+        for (const auto& fingerprint : fingerprints) {
+            if (unchangedNames.count(fingerprint.first)) {
+                manifest.put(fingerprint.first, previousManifest.get(fingerprint.first).value());
+            } else if (successful) {
+                optional<string> checksum = computeChecksum(fingerprint.first, options);
+                if (checksum) {
+                    manifest.put(fingerprint.first, {fingerprint.second, checksum.value()});
+                }
+            }
+        }
+
+        ostream* out = os_->openForWriting(createManifestFilename(options));
+        manifest.write(out);
+        os_->closeOpenedStream(out);
+    }
+
+    static string createWorkerOutputFilename(size_t jobIndex) {
+        return WORKER_OUT_FILENAME_PREFIX + StringUtils::toString(jobIndex) + ".out";
+    }
+
+    static string createWorkerCacheStatisticsFilename(size_t jobIndex) {
+        return WORKER_OUT_FILENAME_PREFIX + StringUtils::toString(jobIndex) + ".cache";
+    }
+
+    void saveWorkerCacheStatistics(size_t jobIndex, const OutputCacheStatistics& initialStatistics) {
+        OutputCacheStatistics statistics = outputCache_->statistics();
+        ostream* out = os_->openForWriting(createWorkerCacheStatisticsFilename(jobIndex));
+        *out << statistics.hits - initialStatistics.hits << ' ' << statistics.misses - initialStatistics.misses << '\n';
+        os_->closeOpenedStream(out);
+    }
+
+    void addWorkerCacheStatistics(size_t jobIndex) {
+        string filename = createWorkerCacheStatisticsFilename(jobIndex);
+        istream* in = os_->openForReading(filename);
+        OutputCacheStatistics statistics = {0, 0};
+        *in >> statistics.hits >> statistics.misses;
+        os_->closeOpenedStream(in);
+        os_->removeFile(filename);
+        outputCache_->addStatistics(statistics);
+    }
+
     bool combineMultipleTestCases(
             const TestGroup& testGroup,
             const GenerationOptions& options,
@@ -104,6 +556,8 @@ private:
         specClient_->validateMultipleTestCasesInput((int) testGroup.testCases().size());
     }
 
+    // The test cases are concatenated in-process with buffered stream copies, replacing the first line (the fake
+    // test case count) of each input and the output prefix of each output.
     void combine(
             const TestGroup& testGroup,
             const GenerationOptions& options,
@@ -116,54 +570,50 @@ private:
         string testGroupOut = TestCasePathCreator::createOutputPath(testGroupName, options.outputDir());
         bool hasTcOutput = options.hasTcOutput();
 
-        ostringstream sout;
-
-        sout << "echo " << testCaseCount << " > " << testGroupIn;
-
-        if (hasTcOutput) {
-            sout << " && touch " << testGroupOut;
-        }
+        ostream* groupIn = os_->openForWriting(testGroupIn);
+        ostream* groupOut = hasTcOutput ? os_->openForWriting(testGroupOut) : nullptr;
 
-        os_->execute(ExecutionRequestBuilder().setCommand(sout.str()).build());
+        *groupIn << testCaseCount << '\n';
 
         for (int i = 1; i <= testCaseCount; i++) {
             string testCaseName = TestCase::createName(testGroupName, i);
             string in = TestCasePathCreator::createInputPath(testCaseName, options.outputDir());
             string out = TestCasePathCreator::createOutputPath(testCaseName, options.outputDir());
 
-            ostringstream sout2;
-            sout2 << "tail -n +2 " << in << " >> " << testGroupIn;
+            istream* testCaseIn = os_->openForReading(in);
+            testCaseIn->ignore(numeric_limits<streamsize>::max(), '\n');
+            copyStream(testCaseIn, groupIn);
+            os_->closeOpenedStream(testCaseIn);
 
             if (hasTcOutput) {
-                sout2 << " && ";
+                istream* testCaseOut = os_->openForReading(out);
                 if (i > 1 && multipleTestCasesOutputPrefix) {
                     string outputPrefix = multipleTestCasesOutputPrefix.value();
                     // Replace the prefix for the first tc, with the correct prefix for this tc
                     string firstPrefix = StringUtils::interpolate(outputPrefix, 1);
                     string correctPrefix = StringUtils::interpolate(outputPrefix, i);
-                    sout2 << "printf \"%b\" \"" << escapeForBash(correctPrefix) << "\" >> " << testGroupOut << " && ";
-                    sout2 << "tail -c +" << (firstPrefix.size() + 1) << " " << out << " >> " << testGroupOut;
-                } else {
-                    sout2 << "cat " << out << " >> " << testGroupOut;
+                    testCaseOut->ignore((streamsize) firstPrefix.size());
+                    *groupOut << correctPrefix;
                 }
+                copyStream(testCaseOut, groupOut);
+                os_->closeOpenedStream(testCaseOut);
             }
 
-            os_->execute(ExecutionRequestBuilder().setCommand(sout2.str()).build());
+            os_->removeFile(in);
+            os_->removeFile(out);
+        }
 
-            ostringstream sout3;
-            sout3 << "rm " << in << " " << out;
-            os_->execute(ExecutionRequestBuilder().setCommand(sout3.str()).build());
+        os_->closeOpenedStream(groupIn);
+        if (hasTcOutput) {
+            os_->closeOpenedStream(groupOut);
         }
     }
 
-    static string escapeForBash(const string& s) {
-        string res = s;
-        res = StringUtils::replace(res, '\\', "\\\\");
-        res = StringUtils::replace(res, '$', "\\$");
-        res = StringUtils::replace(res, '"', "\\\"");
-        res = StringUtils::replace(res, '\n', "\\n");
-        res = StringUtils::replace(res, '\t', "\\t");
-        return res;
+    static void copyStream(istream* in, ostream* out) {
+        // Inserting an exhausted stream buffer would set the failbit of the output stream.
+        if (in->peek() != char_traits<char>::eof()) {
+            *out << in->rdbuf();
+        }
     }
 };
 
@@ -175,9 +625,10 @@ public:
             SpecClient* specClient,
             TestCaseGenerator* testCaseGenerator,
             OperatingSystem* os,
-            GeneratorLogger* logger) {
+            GeneratorLogger* logger,
+            SolutionOutputCache* outputCache) {
 
-        return new Generator(specClient, testCaseGenerator, os, logger);
+        return new Generator(specClient, testCaseGenerator, os, logger, outputCache);
     }
 };
 
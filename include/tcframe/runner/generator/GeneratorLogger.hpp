@@ -25,9 +25,12 @@ public:
     virtual void logFailedResult() = 0;
     virtual void logTestCaseSuccessfulResult() = 0;
     virtual void logTestCaseFailedResult(const optional<string>& testCaseDescription) = 0;
+    virtual void logTestCaseUnchangedResult() = 0;
     virtual void logMultipleTestCasesCombinationIntroduction(const string& testGroupName) = 0;
     virtual void logMultipleTestCasesCombinationSuccessfulResult() = 0;
     virtual void logMultipleTestCasesCombinationFailedResult() = 0;
+    virtual void logWorkerOutput(const string& output) = 0;
+    virtual void logOutputCacheStatistics(int hits, int misses) = 0;
 };
 
 }
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <iostream>
+#include <string>
+
+#include "GeneratorLogger.hpp"
+#include "tcframe/runner/logger.hpp"
+#include "tcframe/util.hpp"
+
+using std::cout;
+using std::flush;
+using std::string;
+
+namespace tcframe {
+
+class JsonGeneratorLogger : public GeneratorLogger, public JsonBaseLogger {
+public:
+    virtual ~JsonGeneratorLogger() = default;
+
+    explicit JsonGeneratorLogger(JsonLoggerEngine* engine)
+            : JsonBaseLogger(engine) {}
+
+    void logIntroduction() {
+        engine_->logObject(JsonObject().add("event", "generation"));
+    }
+
+    void logSuccessfulResult() {
+        logStatus("result", "OK");
+    }
+
+    void logFailedResult() {
+        logStatus("result", "FAILED");
+    }
+
+    void logTestCaseSuccessfulResult() {
+        engine_->logObject(JsonObject()
+                .add("event", "test_case")
+                .add("name", testCaseName_)
+                .add("status", "OK"));
+    }
+
+    void logTestCaseFailedResult(const optional<string>& testCaseDescription) {
+        JsonObject object;
+        object.add("event", "test_case")
+                .add("name", testCaseName_)
+                .add("status", "FAILED");
+        if (testCaseDescription) {
+            object.add("description", testCaseDescription.value());
+        }
+        engine_->logObject(object);
+    }
+
+    void logTestCaseUnchangedResult() {
+        engine_->logObject(JsonObject()
+                .add("event", "test_case")
+                .add("name", testCaseName_)
+                .add("status", "UNCHANGED"));
+    }
+
+    void logMultipleTestCasesCombinationIntroduction(const string& testGroupName) {
+        testCaseName_ = testGroupName;
+    }
+
+    void logMultipleTestCasesCombinationSuccessfulResult() {
+        engine_->logObject(JsonObject()
+                .add("event", "combination")
+                .add("name", testCaseName_)
+                .add("status", "OK"));
+    }
+
+    void logMultipleTestCasesCombinationFailedResult() {
+        engine_->logObject(JsonObject()
+                .add("event", "combination")
+                .add("name", testCaseName_)
+                .add("status", "FAILED"));
+    }
+
+    // The output was already formatted by this logger in a worker process.
+    void logWorkerOutput(const string& output) {
+        cout << output << flush;
+    }
+
+    void logOutputCacheStatistics(int hits, int misses) {
+        engine_->logObject(JsonObject()
+                .add("event", "output_cache")
+                .add("hits", hits)
+                .add("misses", misses));
+    }
+
+private:
+    void logStatus(const string& event, const string& status) {
+        engine_->logObject(JsonObject()
+                .add("event", event)
+                .add("status", status));
+    }
+};
+
+}
@@ -0,0 +1,205 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdio>
+#include <dirent.h>
+#include <fstream>
+#include <map>
+#include <string>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <tuple>
+#include <unistd.h>
+#include <utime.h>
+#include <vector>
+
+#include "GenerationOptions.hpp"
+#include "tcframe/util.hpp"
+
+using std::ifstream;
+using std::ios;
+using std::map;
+using std::ofstream;
+using std::remove;
+using std::rename;
+using std::sort;
+using std::string;
+using std::tie;
+using std::vector;
+
+namespace tcframe {
+
+struct OutputCacheStatistics {
+    int hits;
+    int misses;
+
+    bool operator==(const OutputCacheStatistics& o) const {
+        return tie(hits, misses) == tie(o.hits, o.misses);
+    }
+};
+
+// Keeps the outputs produced by the solution in a directory, keyed by the hashes of the input and the solution, so
+// that they can be reused by later generations. It does nothing unless the cache directory is given.
+//
+// The solution is identified by its command and the contents of every argument of the command that names a file,
+// such as ./solution or Solution.py. The least recently used outputs are evicted when the cache grows too large,
+// along with the temporary files left behind by generations that were interrupted while storing an output.
+class SolutionOutputCache {
+private:
+    static constexpr const char* ENTRY_EXTENSION = ".out";
+    static constexpr const char* TEMPORARY_EXTENSION = ".tmp";
+
+    struct Entry {
+        string filename;
+        long long size;
+        long long lastUsedTime;
+    };
+
+    map<string, string> solutionHashes_;
+    OutputCacheStatistics statistics_ = {0, 0};
+
+public:
+    virtual ~SolutionOutputCache() = default;
+
+    // Copies the cached output of the given input into the output file. Returns false if there is none.
+    virtual bool restore(
+            const string& inputFilename,
+            const string& outputFilename,
+            const GenerationOptions& options) {
+
+        if (!options.outputCacheDir()) {
+            return false;
+        }
+
+        string entryFilename = getEntryFilename(inputFilename, options);
+        if (entryFilename.empty() || !copyFile(entryFilename, outputFilename)) {
+            statistics_.misses++;
+            return false;
+        }
+
+        // Marks the entry as recently used.
+        utime(entryFilename.c_str(), nullptr);
+        statistics_.hits++;
+        return true;
+    }
+
+    virtual void store(const string& inputFilename, const string& outputFilename, const GenerationOptions& options) {
+        if (!options.outputCacheDir()) {
+            return;
+        }
+
+        string entryFilename = getEntryFilename(inputFilename, options);
+        if (entryFilename.empty()) {
+            return;
+        }
+
+        // The entry is written under a temporary name first, so that concurrent workers never read it half written.
+        makeDirs(options.outputCacheDir().value());
+        string temporaryFilename = entryFilename + "." + StringUtils::toString(getpid()) + TEMPORARY_EXTENSION;
+        if (!copyFile(outputFilename, temporaryFilename) || rename(temporaryFilename.c_str(), entryFilename.c_str())) {
+            remove(temporaryFilename.c_str());
+        }
+    }
+
+    // Removes the least recently used entries until the cache fits in its size limit.
+    virtual void evict(const GenerationOptions& options) {
+        if (!options.outputCacheDir()) {
+            return;
+        }
+
+        vector<Entry> entries = listEntries(options.outputCacheDir().value());
+        sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) {
+            return tie(b.lastUsedTime, b.filename) < tie(a.lastUsedTime, a.filename);
+        });
+
+        long long sizeLimit = (long long) options.outputCacheSizeMb() * 1024 * 1024;
+        long long totalSize = 0;
+        for (const Entry& entry : entries) {
+            totalSize += entry.size;
+            if (totalSize > sizeLimit) {
+                remove(entry.filename.c_str());
+            }
+        }
+    }
+
+    virtual OutputCacheStatistics statistics() {
+        return statistics_;
+    }
+
+    // Adds the statistics of a forked worker.
+    virtual void addStatistics(const OutputCacheStatistics& statistics) {
+        statistics_.hits += statistics.hits;
+        statistics_.misses += statistics.misses;
+    }
+
+private:
+    // Returns an empty string if the input cannot be read.
+    string getEntryFilename(const string& inputFilename, const GenerationOptions& options) {
+        Hasher inputHasher;
+        if (!inputHasher.addFile(inputFilename)) {
+            return "";
+        }
+        return options.outputCacheDir().value() + "/" + getSolutionHash(options.solutionCommand())
+               + inputHasher.hex() + ENTRY_EXTENSION;
+    }
+
+    // The solution is hashed only once, since it does not change during a generation.
+    string getSolutionHash(const string& solutionCommand) {
+        if (!solutionHashes_.count(solutionCommand)) {
+            solutionHashes_[solutionCommand] = Hasher().addCommand(solutionCommand).hex();
+        }
+        return solutionHashes_[solutionCommand];
+    }
+
+    static bool copyFile(const string& sourceFilename, const string& destinationFilename) {
+        ifstream source(sourceFilename, ios::binary);
+        if (!source) {
+            return false;
+        }
+        ofstream destination(destinationFilename, ios::binary);
+        if (!destination) {
+            return false;
+        }
+        if (source.peek() != ifstream::traits_type::eof()) {
+            destination << source.rdbuf();
+        }
+        destination.close();
+        return !destination.fail();
+    }
+
+    static void makeDirs(const string& dirName) {
+        for (size_t i = 1; i <= dirName.size(); i++) {
+            if (i == dirName.size() || dirName[i] == '/') {
+                mkdir(dirName.substr(0, i).c_str(), 0755);
+            }
+        }
+    }
+
+    static vector<Entry> listEntries(const string& dirName) {
+        vector<Entry> entries;
+        DIR* dir = opendir(dirName.c_str());
+        if (dir == nullptr) {
+            return entries;
+        }
+        while (dirent* dirEntry = readdir(dir)) {
+            string name = dirEntry->d_name;
+            if (!hasExtension(name, ENTRY_EXTENSION) && !hasExtension(name, TEMPORARY_EXTENSION)) {
+                continue;
+            }
+            string filename = dirName + "/" + name;
+            struct stat info;
+            if (stat(filename.c_str(), &info) == 0 && S_ISREG(info.st_mode)) {
+                entries.push_back({filename, (long long) info.st_size, (long long) info.st_mtime});
+            }
+        }
+        closedir(dir);
+        return entries;
+    }
+
+    static bool hasExtension(const string& name, const string& extension) {
+        return name.size() > extension.size()
+                && name.compare(name.size() - extension.size(), extension.size(), extension) == 0;
+    }
+};
+
+}
@@ -1,16 +1,19 @@
 #pragma once
 
+#include <ostream>
 #include <stdexcept>
 #include <string>
 
 #include "GenerationOptions.hpp"
 #include "GeneratorLogger.hpp"
+#include "SolutionOutputCache.hpp"
 #include "tcframe/exception.hpp"
 #include "tcframe/runner/client.hpp"
 #include "tcframe/runner/evaluator.hpp"
 #include "tcframe/runner/verdict.hpp"
 #include "tcframe/spec/testcase.hpp"
 
+using std::ostream;
 using std::runtime_error;
 using std::string;
 
@@ -21,6 +24,7 @@ private:
     SpecClient* specClient_;
     Evaluator* evaluator_;
     GeneratorLogger* logger_;
+    SolutionOutputCache* outputCache_;
 
 public:
     virtual ~TestCaseGenerator() = default;
@@ -28,10 +32,12 @@ public:
     TestCaseGenerator(
             SpecClient* specClient,
             Evaluator* evaluator,
-            GeneratorLogger* logger)
+            GeneratorLogger* logger,
+            SolutionOutputCache* outputCache)
             : specClient_(specClient)
             , evaluator_(evaluator)
-            , logger_(logger) {}
+            , logger_(logger)
+            , outputCache_(outputCache) {}
 
     virtual bool generate(const TestCase& testCase, const GenerationOptions& options) {
         logger_->logTestCaseIntroduction(testCase.name());
@@ -41,7 +47,7 @@ public:
 
         try {
             generateInput(testCase, inputFilename);
-            generateOutput(testCase, inputFilename, outputFilename, options);
+            generateOutput(inputFilename, outputFilename, options);
             validateOutput(testCase, inputFilename, outputFilename, options);
         } catch (runtime_error& e) {
             logger_->logTestCaseFailedResult(testCase.description());
@@ -53,13 +59,23 @@ public:
         return true;
     }
 
-private:
-    void generateInput(const TestCase& testCase, const string& inputFilename) {
-        specClient_->generateTestCaseInput(testCase.name(), inputFilename);
+    // Appends the input of a test case to the combined input of its test group, which is being streamed.
+    virtual bool appendInput(const TestCase& testCase, ostream* out) {
+        logger_->logTestCaseIntroduction(testCase.name());
+
+        try {
+            specClient_->appendTestCaseInput(testCase.name(), out);
+        } catch (runtime_error& e) {
+            logger_->logTestCaseFailedResult(testCase.description());
+            logger_->logError(&e);
+            return false;
+        }
+
+        logger_->logTestCaseSuccessfulResult();
+        return true;
     }
 
-    void generateOutput(
-            const TestCase& testCase,
+    virtual void generateOutput(
             const string& inputFilename,
             const string& outputFilename,
             const GenerationOptions& options) {
@@ -67,6 +83,9 @@ private:
         if (!options.hasTcOutput()) {
             return;
         }
+        if (outputCache_->restore(inputFilename, outputFilename, options)) {
+            return;
+        }
 
         auto evaluationOptions = EvaluationOptionsBuilder()
                 .setSolutionCommand(options.solutionCommand())
@@ -76,6 +95,12 @@ private:
         if (!generationResult.executionResult().isSuccessful()) {
             throw ExecutionResults::asFormattedError({{"solution", generationResult.executionResult()}});
         }
+        outputCache_->store(inputFilename, outputFilename, options);
+    }
+
+private:
+    void generateInput(const TestCase& testCase, const string& inputFilename) {
+        specClient_->generateTestCaseInput(testCase.name(), inputFilename);
     }
 
     void validateOutput(
@@ -1,9 +1,14 @@
 #pragma once
 
 #include "tcframe/runner/grader/BriefGraderLogger.hpp"
+#include "tcframe/runner/grader/BufferedGraderLogger.hpp"
 #include "tcframe/runner/grader/DefaultGraderLogger.hpp"
 #include "tcframe/runner/grader/Grader.hpp"
 #include "tcframe/runner/grader/GraderLogger.hpp"
 #include "tcframe/runner/grader/GraderLoggerFactory.hpp"
+#include "tcframe/runner/grader/GradingHistory.hpp"
 #include "tcframe/runner/grader/GradingOptions.hpp"
+#include "tcframe/runner/grader/GradingScheduler.hpp"
+#include "tcframe/runner/grader/GradingWorker.hpp"
+#include "tcframe/runner/grader/JsonGraderLogger.hpp"
 #include "tcframe/runner/grader/TestCaseGrader.hpp"
@@ -25,6 +25,7 @@ public:
     void logError(runtime_error*) {}
     void logIntroduction(const string&) {}
     void logTestCaseVerdict(const TestCaseVerdict&) {}
+    void logTestCaseSkipped() {}
 
     void logResult(const map<int, SubtaskVerdict>& subtaskVerdicts, const SubtaskVerdict& verdict) {
         engine_->logParagraph(0, verdict.toBriefString());
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <functional>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "GraderLogger.hpp"
+#include "tcframe/exception.hpp"
+#include "tcframe/runner/verdict.hpp"
+
+using std::function;
+using std::map;
+using std::move;
+using std::runtime_error;
+using std::string;
+using std::vector;
+
+namespace tcframe {
+
+class BufferedGraderLogger : public GraderLogger {
+public:
+    typedef function<void(GraderLogger*)> Entry;
+
+private:
+    vector<Entry> entries_;
+
+public:
+    virtual ~BufferedGraderLogger() = default;
+
+    void logTestGroupIntroduction(int testGroupId) {
+        entries_.push_back([=](GraderLogger* logger) {
+            logger->logTestGroupIntroduction(testGroupId);
+        });
+    }
+
+    void logTestCaseIntroduction(const string& testCaseName) {
+        entries_.push_back([=](GraderLogger* logger) {
+            logger->logTestCaseIntroduction(testCaseName);
+        });
+    }
+
+    void logError(runtime_error* e) {
+        auto formattedE = dynamic_cast<FormattedError*>(e);
+        if (formattedE != nullptr) {
+            FormattedError error = *formattedE;
+            entries_.push_back([=](GraderLogger* logger) mutable {
+                logger->logError(&error);
+            });
+        } else {
+            runtime_error error = *e;
+            entries_.push_back([=](GraderLogger* logger) mutable {
+                logger->logError(&error);
+            });
+        }
+    }
+
+    void logIntroduction(const string& solutionCommand) {
+        entries_.push_back([=](GraderLogger* logger) {
+            logger->logIntroduction(solutionCommand);
+        });
+    }
+
+    void logTestCaseVerdict(const TestCaseVerdict& verdict) {
+        entries_.push_back([=](GraderLogger* logger) {
+            logger->logTestCaseVerdict(verdict);
+        });
+    }
+
+    void logTestCaseSkipped() {
+        entries_.push_back([=](GraderLogger* logger) {
+            logger->logTestCaseSkipped();
+        });
+    }
+
+    void logResult(const map<int, SubtaskVerdict>& subtaskVerdicts, const SubtaskVerdict& verdict) {
+        entries_.push_back([=](GraderLogger* logger) {
+            logger->logResult(subtaskVerdicts, verdict);
+        });
+    }
+
+    vector<Entry> release() {
+        vector<Entry> entries = move(entries_);
+        entries_.clear();
+        return entries;
+    }
+
+    static void replay(const vector<Entry>& entries, GraderLogger* logger) {
+        for (const Entry& entry : entries) {
+            entry(logger);
+        }
+    }
+};
+
+}
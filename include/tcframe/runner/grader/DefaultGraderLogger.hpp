@@ -1,6 +1,10 @@
 #pragma once
 
+#include <algorithm>
 #include <map>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "GraderLogger.hpp"
 #include "tcframe/runner/logger.hpp"
@@ -8,10 +12,20 @@
 #include "tcframe/util.hpp"
 
 using std::map;
+using std::pair;
+using std::stable_sort;
+using std::string;
+using std::vector;
 
 namespace tcframe {
 
 class DefaultGraderLogger : public GraderLogger, public DefaultBaseLogger {
+private:
+    static constexpr size_t SLOWEST_TEST_CASES_COUNT = 5;
+
+    string testCaseName_;
+    vector<pair<string, ResourceUsage>> testCaseUsages_;
+
 public:
     virtual ~DefaultGraderLogger() = default;
 
@@ -22,8 +36,20 @@ public:
         engine_->logParagraph(0, "Local grading with solution command: '" + solutionCommand + "'...");
     }
 
+    void logTestCaseIntroduction(const string& testCaseName) {
+        DefaultBaseLogger::logTestCaseIntroduction(testCaseName);
+        testCaseName_ = testCaseName;
+    }
+
     void logTestCaseVerdict(const TestCaseVerdict& verdict) {
-        engine_->logParagraph(0, verdict.toString());
+        engine_->logParagraph(0, verdict.toString() + usageToString(verdict.usage(), ""));
+        if (verdict.usage()) {
+            testCaseUsages_.emplace_back(testCaseName_, verdict.usage().value());
+        }
+    }
+
+    void logTestCaseSkipped() {
+        engine_->logParagraph(0, "Skipped");
     }
 
     void logResult(const map<int, SubtaskVerdict>& subtaskVerdicts, const SubtaskVerdict& verdict) {
@@ -32,12 +58,49 @@ public:
             for (auto entry : subtaskVerdicts) {
                 engine_->logParagraph(
                         1,
-                        "Subtask " + StringUtils::toString(entry.first) + ": " + entry.second.toString());
+                        "Subtask " + StringUtils::toString(entry.first) + ": " + entry.second.toString()
+                        + usageToString(entry.second.usage(), "max: "));
             }
         }
 
         engine_->logHeading("VERDICT");
-        engine_->logParagraph(1, verdict.toString());
+        engine_->logParagraph(1, verdict.toString() + usageToString(verdict.usage(), "max: "));
+
+        logSlowestTestCases();
+    }
+
+private:
+    void logSlowestTestCases() {
+        if (testCaseUsages_.empty()) {
+            return;
+        }
+
+        vector<pair<string, ResourceUsage>> usages = testCaseUsages_;
+        stable_sort(usages.begin(), usages.end(), [](
+                const pair<string, ResourceUsage>& a,
+                const pair<string, ResourceUsage>& b) {
+            if (a.second.cpuTimeMs() != b.second.cpuTimeMs()) {
+                return a.second.cpuTimeMs() > b.second.cpuTimeMs();
+            }
+            return a.second.wallTimeMs() > b.second.wallTimeMs();
+        });
+
+        size_t count = SLOWEST_TEST_CASES_COUNT;
+        if (usages.size() > count) {
+            usages.resize(count);
+        }
+
+        engine_->logHeading("SLOWEST TEST CASES");
+        for (const auto& entry : usages) {
+            engine_->logParagraph(1, entry.first + ": " + entry.second.toString());
+        }
+    }
+
+    static string usageToString(const optional<ResourceUsage>& usage, const string& prefix) {
+        if (!usage) {
+            return "";
+        }
+        return " (" + prefix + usage.value().toString() + ")";
     }
 };
 
@@ -1,11 +1,20 @@
 #pragma once
 
 #include <algorithm>
+#include <condition_variable>
+#include <exception>
 #include <map>
+#include <mutex>
+#include <set>
 #include <string>
+#include <thread>
+#include <utility>
 #include <vector>
 
+#include "BufferedGraderLogger.hpp"
 #include "GradingOptions.hpp"
+#include "GradingScheduler.hpp"
+#include "GradingWorker.hpp"
 #include "GraderLogger.hpp"
 #include "TestCaseGrader.hpp"
 #include "tcframe/runner/os.hpp"
@@ -15,9 +24,17 @@
 #include "tcframe/spec.hpp"
 #include "tcframe/util.hpp"
 
+using std::condition_variable;
+using std::exception_ptr;
+using std::lock_guard;
 using std::map;
 using std::max;
+using std::move;
+using std::mutex;
+using std::set;
 using std::string;
+using std::thread;
+using std::unique_lock;
 using std::vector;
 
 namespace tcframe {
@@ -29,6 +46,32 @@ private:
     TestCaseAggregator* testCaseAggregator_;
     SubtaskAggregator* subtaskAggregator_;
     GraderLogger* logger_;
+    vector<GradingWorker> workers_;
+    GradingScheduler* scheduler_;
+
+    struct GradingJob {
+        optional<TestCase> testCase;
+        int testGroupId;
+        bool isFirstInTestGroup;
+    };
+
+    // The outcomes of the jobs graded out of canonical order, until they can be logged in canonical order.
+    struct GradingLog {
+        vector<TestCaseVerdict> verdicts;
+        vector<vector<BufferedGraderLogger::Entry>> entries;
+        vector<exception_ptr> errors;
+        vector<bool> decided;
+        vector<bool> skipped;
+        size_t nextLogged;
+
+        explicit GradingLog(size_t jobsCount)
+                : verdicts(jobsCount)
+                , entries(jobsCount)
+                , errors(jobsCount)
+                , decided(jobsCount)
+                , skipped(jobsCount)
+                , nextLogged(0) {}
+    };
 
 public:
     virtual ~Grader() = default;
@@ -39,11 +82,23 @@ public:
             TestCaseAggregator* testCaseAggregator,
             SubtaskAggregator* subtaskAggregator,
             GraderLogger* logger)
+            : Grader(specClient, testCaseGrader, testCaseAggregator, subtaskAggregator, logger, {}, nullptr) {}
+
+    Grader(
+            SpecClient* specClient,
+            TestCaseGrader* testCaseGrader,
+            TestCaseAggregator* testCaseAggregator,
+            SubtaskAggregator* subtaskAggregator,
+            GraderLogger* logger,
+            vector<GradingWorker> workers,
+            GradingScheduler* scheduler)
             : specClient_(specClient)
             , testCaseGrader_(testCaseGrader)
             , testCaseAggregator_(testCaseAggregator)
             , subtaskAggregator_(subtaskAggregator)
-            , logger_(logger) {}
+            , logger_(logger)
+            , workers_(move(workers))
+            , scheduler_(scheduler) {}
 
     virtual void grade(const GradingOptions& options) {
         logger_->logIntroduction(options.solutionCommand());
@@ -51,26 +106,41 @@ public:
         TestSuite testSuite = specClient_->getTestSuite();
         bool hasMultipleTestCases = specClient_->hasMultipleTestCases();
 
-        map<int, vector<TestCaseVerdict>> verdictsBySubtaskId;
+        vector<GradingJob> jobs;
         for (const TestGroup& testGroup : testSuite.testGroups()) {
-            gradeTestGroup(testGroup, options, hasMultipleTestCases, verdictsBySubtaskId);
+            addTestGroupJobs(testGroup, options, hasMultipleTestCases, jobs);
+        }
+
+        map<int, vector<TestCaseVerdict>> verdictsBySubtaskId;
+        if (!workers_.empty()) {
+            gradeWithWorkers(jobs, schedule(jobs, options), options, verdictsBySubtaskId);
+        } else {
+            gradeInSequence(jobs, options, verdictsBySubtaskId);
+        }
+        if (scheduler_ != nullptr) {
+            scheduler_->save(options);
         }
 
         map<int, double> subtaskPointsById = getSubtaskPoints(options);
         map<int, SubtaskVerdict> subtaskVerdictsById;
         vector<SubtaskVerdict> subtaskVerdicts;
+        optional<ResourceUsage> usage;
 
         for (const auto& entry : verdictsBySubtaskId) {
             int subtaskId = entry.first;
             const vector<TestCaseVerdict>& verdicts = entry.second;
+            optional<ResourceUsage> subtaskUsage = getMaxUsage(verdicts);
+            usage = ResourceUsage::max(usage, subtaskUsage);
 
             if (subtaskPointsById.count(subtaskId)) {
                 SubtaskVerdict subtaskVerdict = testCaseAggregator_->aggregate(verdicts, subtaskPointsById[subtaskId]);
+                subtaskVerdict = {subtaskVerdict.verdict(), subtaskVerdict.points(), subtaskUsage};
                 subtaskVerdictsById[subtaskId] = subtaskVerdict;
                 subtaskVerdicts.push_back(subtaskVerdict);
             }
         }
         SubtaskVerdict verdict = subtaskAggregator_->aggregate(subtaskVerdicts);
+        verdict = {verdict.verdict(), verdict.points(), usage};
 
         logger_->logResult(subtaskVerdictsById, verdict);
     }
@@ -88,40 +158,276 @@ private:
         return subtaskPointsByIds;
     }
 
-    void gradeTestGroup(
+    static optional<ResourceUsage> getMaxUsage(const vector<TestCaseVerdict>& verdicts) {
+        optional<ResourceUsage> usage;
+        for (const TestCaseVerdict& verdict : verdicts) {
+            usage = ResourceUsage::max(usage, verdict.usage());
+        }
+        return usage;
+    }
+
+    void addTestGroupJobs(
             const TestGroup& testGroup,
             const GradingOptions& options,
             bool hasMultipleTestCases,
-            map<int, vector<TestCaseVerdict>>& verdictsBySubtaskId) {
+            vector<GradingJob>& jobs) {
 
-        if (hasMultipleTestCases && testGroup.testCases().empty()) {
+        // An empty test group is still introduced, unless its test cases are combined into a single file.
+        if (testGroup.testCases().empty()) {
+            if (!hasMultipleTestCases) {
+                jobs.push_back({optional<TestCase>(), testGroup.id(), true});
+            }
             return;
         }
 
-        logger_->logTestGroupIntroduction(testGroup.id());
-
         if (hasMultipleTestCases) {
             auto testCase = TestCaseBuilder()
                     .setName(TestGroup::createName(options.slug(), testGroup.id()))
                     .setSubtaskIds(testGroup.testCases()[0].subtaskIds())
                     .build();
-            gradeTestCase(testCase, options, verdictsBySubtaskId);
+            jobs.push_back({optional<TestCase>(testCase), testGroup.id(), true});
         } else {
             for (const TestCase& testCase : testGroup.testCases()) {
-                gradeTestCase(testCase, options, verdictsBySubtaskId);
+                bool isFirstInTestGroup = jobs.empty() || jobs.back().testGroupId != testGroup.id();
+                jobs.push_back({optional<TestCase>(testCase), testGroup.id(), isFirstInTestGroup});
             }
         }
     }
 
-    void gradeTestCase(
+    void gradeInSequence(
+            const vector<GradingJob>& jobs,
+            const GradingOptions& options,
+            map<int, vector<TestCaseVerdict>>& verdictsBySubtaskId) {
+
+        if (options.order() != GradingOrder::CANONICAL) {
+            gradeInScheduledOrder(jobs, schedule(jobs, options), options, verdictsBySubtaskId);
+            return;
+        }
+
+        set<int> zeroedSubtaskIds;
+        for (const GradingJob& job : jobs) {
+            if (job.isFirstInTestGroup) {
+                logger_->logTestGroupIntroduction(job.testGroupId);
+            }
+            if (isSkipped(job, options, zeroedSubtaskIds)) {
+                logSkipped(job.testCase.value());
+            } else if (job.testCase) {
+                TestCaseVerdict verdict = testCaseGrader_->grade(job.testCase.value(), options);
+                markZeroedSubtasks(job.testCase.value(), verdict, zeroedSubtaskIds);
+                addVerdict(job.testCase.value(), verdict, options, verdictsBySubtaskId);
+            }
+        }
+    }
+
+    // Test cases are graded one by one in the scheduled order, and are decided the same way as with the workers. Their
+    // logs are held back, so that they are still logged in canonical order.
+    void gradeInScheduledOrder(
+            const vector<GradingJob>& jobs,
+            const vector<size_t>& order,
+            const GradingOptions& options,
+            map<int, vector<TestCaseVerdict>>& verdictsBySubtaskId) {
+
+        size_t jobsCount = jobs.size();
+        GradingLog log(jobsCount);
+        BufferedGraderLogger bufferedLogger;
+        set<int> zeroedSubtaskIds;
+
+        exception_ptr error;
+        for (size_t p = 0; p < jobsCount && !error; p++) {
+            size_t i = order[p];
+            log.skipped[i] = isSkipped(jobs[i], options, zeroedSubtaskIds);
+            if (jobs[i].testCase && !log.skipped[i]) {
+                try {
+                    log.verdicts[i] = testCaseGrader_->grade(jobs[i].testCase.value(), options, &bufferedLogger);
+                    markZeroedSubtasks(jobs[i].testCase.value(), log.verdicts[i], zeroedSubtaskIds);
+                } catch (...) {
+                    error = log.errors[i] = std::current_exception();
+                }
+                log.entries[i] = bufferedLogger.release();
+            }
+            log.decided[i] = true;
+            logDecided(jobs, log, options, verdictsBySubtaskId);
+        }
+
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    // The jobs without test cases only introduce their test groups, so they are done first.
+    vector<size_t> schedule(const vector<GradingJob>& jobs, const GradingOptions& options) {
+        vector<size_t> order;
+        vector<size_t> testCaseJobs;
+        vector<TestCase> testCases;
+        for (size_t i = 0; i < jobs.size(); i++) {
+            if (jobs[i].testCase) {
+                testCaseJobs.push_back(i);
+                testCases.push_back(jobs[i].testCase.value());
+            } else {
+                order.push_back(i);
+            }
+        }
+
+        if (scheduler_ == nullptr) {
+            order.insert(order.end(), testCaseJobs.begin(), testCaseJobs.end());
+        } else {
+            for (size_t j : scheduler_->schedule(testCases, options)) {
+                order.push_back(testCaseJobs[j]);
+            }
+        }
+        return order;
+    }
+
+    // Test cases are handed out to the workers in the scheduled order, and are decided in the same order: a test case
+    // is skipped if the failures decided before it already zero all of its subtasks. A worker may grade a test case
+    // that turns out to be skipped, if those failures have not been decided yet; its verdict is then discarded.
+    // The results are logged and collected in canonical order, so that the log and the verdicts look exactly like
+    // the sequential grading when the order is canonical.
+    void gradeWithWorkers(
+            const vector<GradingJob>& jobs,
+            const vector<size_t>& order,
+            const GradingOptions& options,
+            map<int, vector<TestCaseVerdict>>& verdictsBySubtaskId) {
+
+        size_t jobsCount = jobs.size();
+        vector<TestCaseVerdict> verdicts(jobsCount);
+        vector<vector<BufferedGraderLogger::Entry>> logs(jobsCount);
+        vector<exception_ptr> errors(jobsCount);
+        vector<bool> done(jobsCount);
+        size_t nextJob = 0;
+        set<int> zeroedSubtaskIds;
+
+        mutex lock;
+        condition_variable jobDone;
+
+        vector<thread> threads;
+        for (const GradingWorker& worker : workers_) {
+            threads.emplace_back([&, worker] {
+                while (true) {
+                    size_t i;
+                    bool skipped;
+                    {
+                        lock_guard<mutex> guard(lock);
+                        if (nextJob == jobsCount) {
+                            return;
+                        }
+                        i = order[nextJob++];
+                        skipped = isSkipped(jobs[i], options, zeroedSubtaskIds);
+                    }
+
+                    TestCaseVerdict verdict;
+                    exception_ptr error;
+                    if (jobs[i].testCase && !skipped) {
+                        try {
+                            verdict = worker.testCaseGrader()->grade(jobs[i].testCase.value(), options);
+                        } catch (...) {
+                            error = std::current_exception();
+                        }
+                    }
+
+                    {
+                        lock_guard<mutex> guard(lock);
+                        verdicts[i] = verdict;
+                        logs[i] = worker.logger()->release();
+                        errors[i] = error;
+                        done[i] = true;
+                    }
+                    jobDone.notify_all();
+                }
+            });
+        }
+
+        GradingLog log(jobsCount);
+        exception_ptr error;
+        for (size_t p = 0; p < jobsCount && !error; p++) {
+            size_t i = order[p];
+            {
+                unique_lock<mutex> guard(lock);
+                jobDone.wait(guard, [&] { return done[i]; });
+                log.skipped[i] = isSkipped(jobs[i], options, zeroedSubtaskIds);
+                if (errors[i] && !log.skipped[i]) {
+                    error = errors[i];
+                    nextJob = jobsCount;
+                } else if (jobs[i].testCase && !log.skipped[i]) {
+                    markZeroedSubtasks(jobs[i].testCase.value(), verdicts[i], zeroedSubtaskIds);
+                }
+                log.verdicts[i] = verdicts[i];
+                log.entries[i] = move(logs[i]);
+                log.errors[i] = errors[i];
+            }
+            log.decided[i] = true;
+            logDecided(jobs, log, options, verdictsBySubtaskId);
+        }
+
+        for (thread& t : threads) {
+            t.join();
+        }
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    // Logs the jobs decided so far that follow all the already logged ones in canonical order.
+    void logDecided(
+            const vector<GradingJob>& jobs,
+            GradingLog& log,
+            const GradingOptions& options,
+            map<int, vector<TestCaseVerdict>>& verdictsBySubtaskId) {
+
+        for (; log.nextLogged < jobs.size() && log.decided[log.nextLogged]; log.nextLogged++) {
+            size_t i = log.nextLogged;
+            const GradingJob& job = jobs[i];
+            if (job.isFirstInTestGroup) {
+                logger_->logTestGroupIntroduction(job.testGroupId);
+            }
+            if (log.skipped[i]) {
+                logSkipped(job.testCase.value());
+            } else {
+                BufferedGraderLogger::replay(log.entries[i], logger_);
+                if (job.testCase && !log.errors[i]) {
+                    addVerdict(job.testCase.value(), log.verdicts[i], options, verdictsBySubtaskId);
+                }
+            }
+        }
+    }
+
+    void addVerdict(
             const TestCase& testCase,
+            const TestCaseVerdict& verdict,
             const GradingOptions& options,
             map<int, vector<TestCaseVerdict>>& verdictsBySubtaskId) {
 
-        TestCaseVerdict verdict = testCaseGrader_->grade(testCase, options);
         for (int subtaskId : testCase.subtaskIds()) {
             verdictsBySubtaskId[subtaskId].push_back(verdict);
         }
+        if (scheduler_ != nullptr) {
+            scheduler_->record(testCase, verdict, options);
+        }
+    }
+
+    void markZeroedSubtasks(const TestCase& testCase, const TestCaseVerdict& verdict, set<int>& zeroedSubtaskIds) {
+        if (testCaseAggregator_->zeroesSubtask(verdict)) {
+            zeroedSubtaskIds.insert(testCase.subtaskIds().begin(), testCase.subtaskIds().end());
+        }
+    }
+
+    // With stop-on-first-failure, a test case is skipped once every subtask containing it is already worth zero
+    // points, since its verdict could not change the points anymore.
+    static bool isSkipped(const GradingJob& job, const GradingOptions& options, const set<int>& zeroedSubtaskIds) {
+        if (!options.stopsOnFirstFailure() || !job.testCase || job.testCase.value().subtaskIds().empty()) {
+            return false;
+        }
+        for (int subtaskId : job.testCase.value().subtaskIds()) {
+            if (!zeroedSubtaskIds.count(subtaskId)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void logSkipped(const TestCase& testCase) {
+        logger_->logTestCaseIntroduction(testCase.name());
+        logger_->logTestCaseSkipped();
     }
 };
 
@@ -134,8 +440,10 @@ public:
             TestCaseGrader* testCaseGrader,
             TestCaseAggregator* aggregator,
             SubtaskAggregator* subtaskAggregator,
-            GraderLogger* logger) {
-        return new Grader(specClient, testCaseGrader, aggregator, subtaskAggregator, logger);
+            GraderLogger* logger,
+            const vector<GradingWorker>& workers,
+            GradingScheduler* scheduler) {
+        return new Grader(specClient, testCaseGrader, aggregator, subtaskAggregator, logger, workers, scheduler);
     }
 };
 
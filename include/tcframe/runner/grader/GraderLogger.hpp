@@ -16,6 +16,7 @@ public:
 
     virtual void logIntroduction(const string& solutionCommand) = 0;
     virtual void logTestCaseVerdict(const TestCaseVerdict& verdict) = 0;
+    virtual void logTestCaseSkipped() = 0;
     virtual void logResult(const map<int, SubtaskVerdict>& subtaskVerdicts, const SubtaskVerdict& verdict) = 0;
 };
 
@@ -3,6 +3,7 @@
 #include "BriefGraderLogger.hpp"
 #include "DefaultGraderLogger.hpp"
 #include "GraderLogger.hpp"
+#include "JsonGraderLogger.hpp"
 #include "tcframe/runner/logger.hpp"
 
 namespace tcframe {
@@ -17,6 +18,10 @@ public:
         }
         return new DefaultGraderLogger(engine);
     }
+
+    virtual GraderLogger* createJson(JsonLoggerEngine* engine) {
+        return new JsonGraderLogger(engine);
+    }
 };
 
 }
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <istream>
+#include <map>
+#include <ostream>
+#include <string>
+#include <tuple>
+
+#include "tcframe/runner/verdict.hpp"
+
+using std::istream;
+using std::map;
+using std::ostream;
+using std::string;
+using std::tie;
+
+namespace tcframe {
+
+struct TestCaseHistory {
+    int runs = 0;
+    int failures = 0;
+    long long totalCpuTimeMs = 0;
+
+    double failureRate() const {
+        return runs == 0 ? 0 : (double) failures / runs;
+    }
+
+    long long averageCpuTimeMs() const {
+        return runs == 0 ? 0 : totalCpuTimeMs / runs;
+    }
+
+    bool operator==(const TestCaseHistory& o) const {
+        return tie(runs, failures, totalCpuTimeMs) == tie(o.runs, o.failures, o.totalCpuTimeMs);
+    }
+};
+
+// The failure counts and CPU times of the test cases over past gradings, kept in a small text file with one
+// "<name> <runs> <failures> <total CPU time in ms>" line per test case.
+class GradingHistory {
+private:
+    map<string, TestCaseHistory> entries_;
+
+public:
+    TestCaseHistory get(const string& testCaseName) const {
+        auto it = entries_.find(testCaseName);
+        return it == entries_.end() ? TestCaseHistory() : it->second;
+    }
+
+    void record(const string& testCaseName, const TestCaseVerdict& verdict) {
+        TestCaseHistory& entry = entries_[testCaseName];
+        entry.runs++;
+        if (!(verdict.verdict() == Verdict::ac()) && !(verdict.verdict() == Verdict::ok())) {
+            entry.failures++;
+        }
+        if (verdict.usage()) {
+            entry.totalCpuTimeMs += verdict.usage().value().cpuTimeMs();
+        }
+    }
+
+    // Reading stops at the first malformed line, as the history only serves as a hint.
+    static GradingHistory read(istream* in) {
+        GradingHistory history;
+        string testCaseName;
+        TestCaseHistory entry;
+        while (*in >> testCaseName >> entry.runs >> entry.failures >> entry.totalCpuTimeMs) {
+            history.entries_[testCaseName] = entry;
+        }
+        return history;
+    }
+
+    void write(ostream* out) const {
+        for (const auto& entry : entries_) {
+            *out << entry.first << " " << entry.second.runs << " " << entry.second.failures << " "
+                 << entry.second.totalCpuTimeMs << "\n";
+        }
+    }
+
+    bool operator==(const GradingHistory& o) const {
+        return entries_ == o.entries_;
+    }
+};
+
+}
@@ -14,6 +14,12 @@ using std::vector;
 
 namespace tcframe {
 
+enum class GradingOrder {
+    CANONICAL,
+    SMALLEST_FIRST,
+    FAILING_FIRST
+};
+
 struct GradingOptions {
     friend class GradingOptionsBuilder;
 
@@ -22,8 +28,11 @@ private:
     vector<double> subtaskPoints_;
     string solutionCommand_;
     string outputDir_;
-    optional<int> timeLimit_;
+    optional<int> timeLimit_; // in milliseconds
     optional<int> memoryLimit_;
+    bool rssMemoryLimit_ = false;
+    bool stopsOnFirstFailure_ = false;
+    GradingOrder order_ = GradingOrder::CANONICAL;
 
 public:
     const string& slug() const {
@@ -50,9 +59,23 @@ public:
         return memoryLimit_;
     }
 
+    bool rssMemoryLimit() const {
+        return rssMemoryLimit_;
+    }
+
+    bool stopsOnFirstFailure() const {
+        return stopsOnFirstFailure_;
+    }
+
+    GradingOrder order() const {
+        return order_;
+    }
+
     bool operator==(const GradingOptions& o) const {
-        return tie(slug_, subtaskPoints_, solutionCommand_, outputDir_, timeLimit_, memoryLimit_) ==
-                tie(o.slug_, o.subtaskPoints_, o.solutionCommand_, o.outputDir_, o.timeLimit_, o.memoryLimit_);
+        return tie(slug_, subtaskPoints_, solutionCommand_, outputDir_, timeLimit_, memoryLimit_, rssMemoryLimit_,
+                   stopsOnFirstFailure_, order_) ==
+                tie(o.slug_, o.subtaskPoints_, o.solutionCommand_, o.outputDir_, o.timeLimit_, o.memoryLimit_,
+                    o.rssMemoryLimit_, o.stopsOnFirstFailure_, o.order_);
     }
 };
 
@@ -93,6 +116,21 @@ public:
         return *this;
     }
 
+    GradingOptionsBuilder& setRssMemoryLimit(bool rssMemoryLimit) {
+        subject_.rssMemoryLimit_ = rssMemoryLimit;
+        return *this;
+    }
+
+    GradingOptionsBuilder& setStopsOnFirstFailure(bool stopsOnFirstFailure) {
+        subject_.stopsOnFirstFailure_ = stopsOnFirstFailure;
+        return *this;
+    }
+
+    GradingOptionsBuilder& setOrder(GradingOrder order) {
+        subject_.order_ = order;
+        return *this;
+    }
+
     GradingOptions build() {
         return move(subject_);
     }
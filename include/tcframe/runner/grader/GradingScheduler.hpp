@@ -0,0 +1,97 @@
+#pragma once
+
+#include <algorithm>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "GradingHistory.hpp"
+#include "GradingOptions.hpp"
+#include "tcframe/runner/os.hpp"
+#include "tcframe/runner/verdict.hpp"
+#include "tcframe/spec/testcase.hpp"
+
+using std::iota;
+using std::stable_sort;
+using std::string;
+using std::vector;
+
+namespace tcframe {
+
+// Decides the order in which the test cases are graded. The history of past gradings is only read and updated
+// when the test cases that failed most often are graded first. It is kept in the working directory, next to the
+// runner, so that grading never writes into the output directory.
+class GradingScheduler {
+private:
+    OperatingSystem* os_;
+    GradingHistory history_;
+
+public:
+    static constexpr const char* HISTORY_FILENAME = ".tcframe_grading_history";
+
+    virtual ~GradingScheduler() = default;
+
+    explicit GradingScheduler(OperatingSystem* os)
+            : os_(os) {}
+
+    // Returns the indices of the test cases, in the order they should be graded. Ties keep the canonical order.
+    virtual vector<size_t> schedule(const vector<TestCase>& testCases, const GradingOptions& options) {
+        vector<size_t> order(testCases.size());
+        iota(order.begin(), order.end(), 0);
+
+        if (options.order() == GradingOrder::SMALLEST_FIRST) {
+            vector<long long> inputSizes;
+            for (const TestCase& testCase : testCases) {
+                inputSizes.push_back(getInputSize(testCase, options));
+            }
+            stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+                return inputSizes[a] < inputSizes[b];
+            });
+        } else if (options.order() == GradingOrder::FAILING_FIRST) {
+            history_ = readHistory();
+            vector<TestCaseHistory> entries;
+            for (const TestCase& testCase : testCases) {
+                entries.push_back(history_.get(testCase.name()));
+            }
+            stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+                if (entries[a].failureRate() != entries[b].failureRate()) {
+                    return entries[a].failureRate() > entries[b].failureRate();
+                }
+                return entries[a].averageCpuTimeMs() < entries[b].averageCpuTimeMs();
+            });
+        }
+        return order;
+    }
+
+    virtual void record(const TestCase& testCase, const TestCaseVerdict& verdict, const GradingOptions& options) {
+        if (options.order() == GradingOrder::FAILING_FIRST) {
+            history_.record(testCase.name(), verdict);
+        }
+    }
+
+    virtual void save(const GradingOptions& options) {
+        if (options.order() == GradingOrder::FAILING_FIRST) {
+            ostream* out = os_->openForWriting(HISTORY_FILENAME);
+            history_.write(out);
+            os_->closeOpenedStream(out);
+        }
+    }
+
+private:
+    long long getInputSize(const TestCase& testCase, const GradingOptions& options) {
+        istream* in = os_->openForReading(TestCasePathCreator::createInputPath(testCase.name(), options.outputDir()));
+        in->seekg(0, istream::end);
+        long long size = in->fail() ? 0 : (long long) in->tellg();
+        os_->closeOpenedStream(in);
+        return size;
+    }
+
+    GradingHistory readHistory() {
+        istream* in = os_->openForReading(HISTORY_FILENAME);
+        GradingHistory history = GradingHistory::read(in);
+        os_->closeOpenedStream(in);
+        return history;
+    }
+};
+
+}
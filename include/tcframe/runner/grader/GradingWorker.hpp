@@ -0,0 +1,27 @@
+#pragma once
+
+#include "BufferedGraderLogger.hpp"
+#include "TestCaseGrader.hpp"
+
+namespace tcframe {
+
+struct GradingWorker {
+private:
+    TestCaseGrader* testCaseGrader_;
+    BufferedGraderLogger* logger_;
+
+public:
+    GradingWorker(TestCaseGrader* testCaseGrader, BufferedGraderLogger* logger)
+            : testCaseGrader_(testCaseGrader)
+            , logger_(logger) {}
+
+    TestCaseGrader* testCaseGrader() const {
+        return testCaseGrader_;
+    }
+
+    BufferedGraderLogger* logger() const {
+        return logger_;
+    }
+};
+
+}
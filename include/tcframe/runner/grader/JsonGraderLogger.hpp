@@ -0,0 +1,79 @@
+#pragma once
+
+#include <map>
+#include <string>
+
+#include "GraderLogger.hpp"
+#include "tcframe/runner/logger.hpp"
+#include "tcframe/runner/verdict.hpp"
+#include "tcframe/util.hpp"
+
+using std::map;
+using std::string;
+
+namespace tcframe {
+
+class JsonGraderLogger : public GraderLogger, public JsonBaseLogger {
+public:
+    virtual ~JsonGraderLogger() = default;
+
+    explicit JsonGraderLogger(JsonLoggerEngine* engine)
+            : JsonBaseLogger(engine) {}
+
+    void logIntroduction(const string& solutionCommand) {
+        engine_->logObject(JsonObject()
+                .add("event", "grading")
+                .add("solution", solutionCommand));
+    }
+
+    void logTestCaseVerdict(const TestCaseVerdict& verdict) {
+        JsonObject object;
+        object.add("event", "test_case")
+                .add("name", testCaseName_)
+                .add("verdict", verdict.verdict().code());
+        if (verdict.points()) {
+            object.add("points", verdict.points().value());
+        }
+        addUsage(object, verdict.usage());
+        engine_->logObject(object);
+    }
+
+    void logTestCaseSkipped() {
+        engine_->logObject(JsonObject()
+                .add("event", "test_case")
+                .add("name", testCaseName_)
+                .add("skipped", true));
+    }
+
+    void logResult(const map<int, SubtaskVerdict>& subtaskVerdicts, const SubtaskVerdict& verdict) {
+        if (subtaskVerdicts.size() > 1) {
+            for (const auto& entry : subtaskVerdicts) {
+                JsonObject object;
+                object.add("event", "subtask")
+                        .add("id", entry.first)
+                        .add("verdict", entry.second.verdict().code())
+                        .add("points", entry.second.points());
+                addUsage(object, entry.second.usage());
+                engine_->logObject(object);
+            }
+        }
+
+        JsonObject object;
+        object.add("event", "result")
+                .add("verdict", verdict.verdict().code())
+                .add("points", verdict.points());
+        addUsage(object, verdict.usage());
+        engine_->logObject(object);
+    }
+
+private:
+    static void addUsage(JsonObject& object, const optional<ResourceUsage>& usage) {
+        if (usage) {
+            object.add("cpu_ms", usage.value().cpuTimeMs())
+                    .add("wall_ms", usage.value().wallTimeMs())
+                    .add("memory_kb", usage.value().peakMemoryKb());
+        }
+    }
+};
+
+}
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <map>
 #include <string>
 
 #include "GradingOptions.hpp"
@@ -9,6 +10,7 @@
 #include "tcframe/runner/os.hpp"
 #include "tcframe/runner/verdict.hpp"
 
+using std::map;
 using std::string;
 
 namespace tcframe {
@@ -26,21 +28,44 @@ public:
             , logger_(logger) {}
 
     virtual TestCaseVerdict grade(const TestCase& testCase, const GradingOptions& options) {
-        logger_->logTestCaseIntroduction(testCase.name());
+        return grade(testCase, options, logger_);
+    }
+
+    // Logs to the given logger instead, e.g. to hold back the log of a test case graded out of order.
+    virtual TestCaseVerdict grade(const TestCase& testCase, const GradingOptions& options, GraderLogger* logger) {
+        logger->logTestCaseIntroduction(testCase.name());
 
         EvaluationResult evaluationResult = evaluate(testCase, options);
-        TestCaseVerdict testCaseVerdict = evaluationResult.verdict();
+        TestCaseVerdict testCaseVerdict = withUsage(evaluationResult);
 
-        logger_->logTestCaseVerdict(testCaseVerdict);
-        if (!(testCaseVerdict.verdict() == Verdict::tle())) {
+        logger->logTestCaseVerdict(testCaseVerdict);
+        if (!(testCaseVerdict.verdict() == Verdict::tle()) && !(testCaseVerdict.verdict() == Verdict::mle())) {
             FormattedError error = ExecutionResults::asFormattedError(evaluationResult.executionResults());
-            logger_->logError(&error);
+            logger->logError(&error);
         }
 
         return testCaseVerdict;
     }
 
 private:
+    // The solution is run by the communicator in interactive problems, so the communicator's usage is taken there.
+    static TestCaseVerdict withUsage(const EvaluationResult& evaluationResult) {
+        const TestCaseVerdict& verdict = evaluationResult.verdict();
+        const map<string, ExecutionResult>& executionResults = evaluationResult.executionResults();
+
+        auto it = executionResults.find("solution");
+        if (it == executionResults.end()) {
+            it = executionResults.find("communicator");
+        }
+        if (it == executionResults.end()) {
+            return verdict;
+        }
+
+        const ExecutionResult& executionResult = it->second;
+        ResourceUsage usage(executionResult.cpuTimeMs(), executionResult.wallTimeMs(), executionResult.peakMemoryKb());
+        return {verdict.verdict(), verdict.points(), optional<ResourceUsage>(usage)};
+    }
+
     EvaluationResult evaluate(const TestCase& testCase, const GradingOptions& options) {
         string inputFilename = TestCasePathCreator::createInputPath(testCase.name(), options.outputDir());
         string outputFilename = TestCasePathCreator::createOutputPath(testCase.name(), options.outputDir());
@@ -48,6 +73,8 @@ private:
                 .setSolutionCommand(options.solutionCommand())
                 .setTimeLimit(options.timeLimit())
                 .setMemoryLimit(options.memoryLimit())
+                .setRssMemoryLimit(options.rssMemoryLimit())
+                .setMeasuresPeakMemory(true)
                 .build();
 
         return evaluator_->evaluate(inputFilename, outputFilename, evaluationOptions);
@@ -2,6 +2,9 @@
 
 #include "tcframe/runner/logger/BaseLogger.hpp"
 #include "tcframe/runner/logger/DefaultBaseLogger.hpp"
+#include "tcframe/runner/logger/JsonBaseLogger.hpp"
+#include "tcframe/runner/logger/JsonLoggerEngine.hpp"
+#include "tcframe/runner/logger/JsonObject.hpp"
 #include "tcframe/runner/logger/LoggerEngine.hpp"
 #include "tcframe/runner/logger/RunnerLogger.hpp"
 #include "tcframe/runner/logger/SimpleLoggerEngine.hpp"
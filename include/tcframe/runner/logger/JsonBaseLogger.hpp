@@ -0,0 +1,56 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "BaseLogger.hpp"
+#include "JsonLoggerEngine.hpp"
+#include "JsonObject.hpp"
+#include "tcframe/exception.hpp"
+
+using std::string;
+using std::vector;
+
+namespace tcframe {
+
+class JsonBaseLogger : public virtual BaseLogger {
+protected:
+    JsonLoggerEngine* engine_;
+    string testCaseName_;
+
+public:
+    virtual ~JsonBaseLogger() = default;
+
+    explicit JsonBaseLogger(JsonLoggerEngine* engine)
+            : engine_(engine) {}
+
+    virtual void logTestGroupIntroduction(int testGroupId) {
+        engine_->logObject(JsonObject()
+                .add("event", "test_group")
+                .add("id", testGroupId));
+    }
+
+    // Nothing is logged until the result of the test case is known; the name is attached to the later events.
+    virtual void logTestCaseIntroduction(const string& testCaseName) {
+        testCaseName_ = testCaseName;
+    }
+
+    virtual void logError(runtime_error* e) {
+        vector<string> messages;
+        auto formattedE = dynamic_cast<FormattedError*>(e);
+        if (formattedE != nullptr) {
+            for (const auto& entry : formattedE->messages()) {
+                messages.push_back(entry.second);
+            }
+        } else {
+            messages.emplace_back(e->what());
+        }
+
+        engine_->logObject(JsonObject()
+                .add("event", "error")
+                .add("name", testCaseName_)
+                .add("messages", messages));
+    }
+};
+
+}
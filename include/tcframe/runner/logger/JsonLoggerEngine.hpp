@@ -0,0 +1,55 @@
+#pragma once
+
+#include <iostream>
+#include <string>
+
+#include "JsonObject.hpp"
+#include "LoggerEngine.hpp"
+
+using std::cout;
+using std::endl;
+using std::string;
+
+namespace tcframe {
+
+// Writes every log entry as a JSON object on its own line (JSON Lines), flushed as soon as it is logged, so that
+// the output can be consumed while it is being written. Structured loggers log their events via logObject(); plain
+// text logged by the other loggers becomes "message" objects.
+class JsonLoggerEngine : public LoggerEngine {
+public:
+    virtual ~JsonLoggerEngine() = default;
+
+    virtual void logObject(const JsonObject& object) {
+        cout << object.toString() << endl;
+    }
+
+    void logHeading(const string& message) {
+        logMessage(0, message);
+    }
+
+    void logParagraph(int level, const string& message) {
+        logMessage(level, message);
+    }
+
+    void logHangingParagraph(int level, const string& message) {
+        logMessage(level, message);
+    }
+
+    void logListItem1(int level, const string& message) {
+        logMessage(level, message);
+    }
+
+    void logListItem2(int level, const string& message) {
+        logMessage(level, message);
+    }
+
+private:
+    void logMessage(int level, const string& message) {
+        logObject(JsonObject()
+                .add("event", "message")
+                .add("level", level)
+                .add("text", message));
+    }
+};
+
+}
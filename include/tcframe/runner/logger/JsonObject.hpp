@@ -0,0 +1,163 @@
+#pragma once
+
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "tcframe/util.hpp"
+
+using std::isfinite;
+using std::snprintf;
+using std::string;
+using std::vector;
+
+namespace tcframe {
+
+// A flat JSON object whose members are serialized as they are added, in order.
+class JsonObject {
+private:
+    string members_;
+
+public:
+    JsonObject& add(const string& key, const string& value) {
+        return addRaw(key, quote(value));
+    }
+
+    JsonObject& add(const string& key, const char* value) {
+        return add(key, string(value));
+    }
+
+    JsonObject& add(const string& key, bool value) {
+        return addRaw(key, value ? "true" : "false");
+    }
+
+    JsonObject& add(const string& key, int value) {
+        return addRaw(key, StringUtils::toString(value));
+    }
+
+    JsonObject& add(const string& key, double value) {
+        if (!isfinite(value)) {
+            return addRaw(key, "null");
+        }
+        char number[32];
+        snprintf(number, sizeof(number), "%.10g", value);
+        return addRaw(key, number);
+    }
+
+    JsonObject& add(const string& key, const vector<string>& values) {
+        string array = "[";
+        for (size_t i = 0; i < values.size(); i++) {
+            if (i > 0) {
+                array += ",";
+            }
+            array += quote(values[i]);
+        }
+        return addRaw(key, array + "]");
+    }
+
+    string toString() const {
+        return "{" + members_ + "}";
+    }
+
+    bool operator==(const JsonObject& o) const {
+        return members_ == o.members_;
+    }
+
+private:
+    JsonObject& addRaw(const string& key, const string& value) {
+        if (!members_.empty()) {
+            members_ += ",";
+        }
+        members_ += quote(key) + ":" + value;
+        return *this;
+    }
+
+    // Bytes that are not part of a valid UTF-8 sequence (e.g. in the stderr of a solution) are replaced with U+FFFD,
+    // so that the result is always valid JSON.
+    static string quote(const string& value) {
+        string result = "\"";
+        for (size_t i = 0; i < value.size(); i++) {
+            char c = value[i];
+            if ((unsigned char) c >= 0x80) {
+                size_t length = getUtf8SequenceLength(value, i);
+                if (length == 0) {
+                    result += "\\ufffd";
+                } else {
+                    result.append(value, i, length);
+                    i += length - 1;
+                }
+                continue;
+            }
+            switch (c) {
+                case '"':
+                    result += "\\\"";
+                    break;
+                case '\\':
+                    result += "\\\\";
+                    break;
+                case '\n':
+                    result += "\\n";
+                    break;
+                case '\r':
+                    result += "\\r";
+                    break;
+                case '\t':
+                    result += "\\t";
+                    break;
+                default:
+                    if ((unsigned char) c < 0x20) {
+                        char escaped[8];
+                        snprintf(escaped, sizeof(escaped), "\\u%04x", (unsigned) c);
+                        result += escaped;
+                    } else {
+                        result += c;
+                    }
+            }
+        }
+        return result + "\"";
+    }
+
+    // Returns the length of the multi-byte UTF-8 sequence starting at the given position, or 0 if it is not valid:
+    // truncated, overlong, a surrogate, or beyond U+10FFFF.
+    static size_t getUtf8SequenceLength(const string& value, size_t pos) {
+        auto byte = [&](size_t i) {
+            return pos + i < value.size() ? (unsigned char) value[pos + i] : 0;
+        };
+
+        unsigned char lead = byte(0);
+        size_t length;
+        unsigned char min = 0x80, max = 0xBF;
+        if (lead >= 0xC2 && lead <= 0xDF) {
+            length = 2;
+        } else if (lead >= 0xE0 && lead <= 0xEF) {
+            length = 3;
+            if (lead == 0xE0) {
+                min = 0xA0;
+            } else if (lead == 0xED) {
+                max = 0x9F;
+            }
+        } else if (lead >= 0xF0 && lead <= 0xF4) {
+            length = 4;
+            if (lead == 0xF0) {
+                min = 0x90;
+            } else if (lead == 0xF4) {
+                max = 0x8F;
+            }
+        } else {
+            return 0;
+        }
+
+        if (byte(1) < min || byte(1) > max) {
+            return 0;
+        }
+        for (size_t i = 2; i < length; i++) {
+            if (byte(i) < 0x80 || byte(i) > 0xBF) {
+                return 0;
+            }
+        }
+        return length;
+    }
+};
+
+}
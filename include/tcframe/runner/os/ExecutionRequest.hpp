@@ -19,8 +19,10 @@ private:
     string command_;
     optional<string> inputFilename_;
     optional<string> outputFilename_;
-    optional<int> timeLimit_;
-    optional<int> memoryLimit_;
+    optional<int> timeLimit_; // in milliseconds
+    optional<int> memoryLimit_; // in megabytes
+    bool rssMemoryLimit_ = false;
+    bool measuresPeakMemory_ = false;
 
 public:
     const string& command() const {
@@ -43,9 +45,21 @@ public:
         return memoryLimit_;
     }
 
+    // Whether the memory limit applies to the resident set size instead of the address space.
+    bool rssMemoryLimit() const {
+        return rssMemoryLimit_;
+    }
+
+    // Whether the peak memory must only include the processes of the command, which requires tracing them.
+    bool measuresPeakMemory() const {
+        return measuresPeakMemory_;
+    }
+
     bool operator==(const ExecutionRequest& o) const {
-        return tie(command_, inputFilename_, outputFilename_, timeLimit_, memoryLimit_)
-                == tie(o.command_, o.inputFilename_, o.outputFilename_, o.timeLimit_, o.memoryLimit_);
+        return tie(command_, inputFilename_, outputFilename_, timeLimit_, memoryLimit_, rssMemoryLimit_,
+                   measuresPeakMemory_)
+                == tie(o.command_, o.inputFilename_, o.outputFilename_, o.timeLimit_, o.memoryLimit_,
+                       o.rssMemoryLimit_, o.measuresPeakMemory_);
     }
 };
 
@@ -79,6 +93,16 @@ public:
         return *this;
     }
 
+    ExecutionRequestBuilder& setRssMemoryLimit(bool rssMemoryLimit) {
+        subject_.rssMemoryLimit_ = rssMemoryLimit;
+        return *this;
+    }
+
+    ExecutionRequestBuilder& setMeasuresPeakMemory(bool measuresPeakMemory) {
+        subject_.measuresPeakMemory_ = measuresPeakMemory;
+        return *this;
+    }
+
     ExecutionRequest build() {
         return move(subject_);
     }
@@ -23,6 +23,10 @@ private:
     optional<int> exitCode_ = optional<int>(0);
     optional<int> exitSignal_;
     string standardError_;
+    int cpuTimeMs_ = 0;
+    int wallTimeMs_ = 0;
+    int peakMemoryKb_ = 0;
+    bool memoryLimitExceeded_ = false;
 
 public:
     ExecutionResult() = default;
@@ -39,13 +43,31 @@ public:
         return standardError_;
     }
 
+    int cpuTimeMs() const {
+        return cpuTimeMs_;
+    }
+
+    int wallTimeMs() const {
+        return wallTimeMs_;
+    }
+
+    int peakMemoryKb() const {
+        return peakMemoryKb_;
+    }
+
+    // Whether the command was killed for going above the resident memory limit.
+    bool memoryLimitExceeded() const {
+        return memoryLimitExceeded_;
+    }
+
     bool isSuccessful() const {
         return exitCode_ && exitCode_.value() == 0;
     }
 
     bool operator==(const ExecutionResult& o) const {
-        return tie(exitCode_, exitSignal_, standardError_)
-               == tie(o.exitCode_, o.exitSignal_, standardError_);
+        return tie(exitCode_, exitSignal_, standardError_, cpuTimeMs_, wallTimeMs_, peakMemoryKb_, memoryLimitExceeded_)
+               == tie(o.exitCode_, o.exitSignal_, o.standardError_, o.cpuTimeMs_, o.wallTimeMs_, o.peakMemoryKb_,
+                      o.memoryLimitExceeded_);
     }
 };
 
@@ -103,6 +125,26 @@ public:
         return *this;
     }
 
+    ExecutionResultBuilder& setCpuTimeMs(int cpuTimeMs) {
+        subject_.cpuTimeMs_ = cpuTimeMs;
+        return *this;
+    }
+
+    ExecutionResultBuilder& setWallTimeMs(int wallTimeMs) {
+        subject_.wallTimeMs_ = wallTimeMs;
+        return *this;
+    }
+
+    ExecutionResultBuilder& setPeakMemoryKb(int peakMemoryKb) {
+        subject_.peakMemoryKb_ = peakMemoryKb;
+        return *this;
+    }
+
+    ExecutionResultBuilder& setMemoryLimitExceeded(bool memoryLimitExceeded) {
+        subject_.memoryLimitExceeded_ = memoryLimitExceeded;
+        return *this;
+    }
+
     ExecutionResult build() {
         return move(subject_);
     }
@@ -1,29 +1,77 @@
 #pragma once
 
+#include <cctype>
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
 #include <cstring>
+#include <dirent.h>
+#include <fcntl.h>
 #include <fstream>
+#include <functional>
+#include <future>
 #include <iostream>
+#include <mutex>
+#include <poll.h>
+#include <set>
 #include <sstream>
+#include <stdexcept>
 #include <string>
+#include <sys/resource.h>
+#include <sys/time.h>
+#ifdef __linux__
+#include <sys/ptrace.h>
+#include <sys/syscall.h>
+#endif
 #include <sys/wait.h>
+#include <thread>
+#include <unistd.h>
+#include <utility>
+#include <vector>
 
 #include "ExecutionRequest.hpp"
 #include "ExecutionResult.hpp"
 #include "tcframe/util.hpp"
 
+using std::chrono::duration_cast;
+using std::chrono::milliseconds;
+using std::chrono::steady_clock;
+using std::cout;
+using std::flush;
+using std::function;
+using std::future;
 using std::ifstream;
 using std::ios;
 using std::istream;
 using std::ofstream;
 using std::ostream;
+using std::istringstream;
+using std::lock_guard;
+using std::max;
+using std::mutex;
 using std::ostringstream;
+using std::pair;
+using std::promise;
+using std::remove;
+using std::runtime_error;
+using std::set;
 using std::string;
+using std::thread;
+using std::vector;
 
 namespace tcframe {
 
 class OperatingSystem {
 private:
-    static constexpr const char* ERROR_FILENAME = "__tcframe_error.out";
+    static constexpr int COMMAND_NOT_FOUND_EXIT_CODE = 127;
+
+    // The wall-clock watchdog only catches processes that do not use the CPU (e.g. sleeping or blocked ones), so it is
+    // lenient to avoid killing processes that are merely slowed down by a loaded machine.
+    static constexpr int WALL_TIME_LIMIT_FACTOR = 2;
+    static constexpr int WALL_TIME_LIMIT_MARGIN_MS = 1000;
+    static constexpr int MEMORY_POLL_INTERVAL_MS = 10;
 
 public:
     virtual ~OperatingSystem() = default;
@@ -49,59 +97,690 @@ public:
         runCommand("mkdir -p " + dirName);
     }
 
+    virtual void makeDir(const string& dirName) {
+        runCommand("mkdir -p " + dirName);
+    }
+
     virtual void removeFile(const string& filename) {
-        runCommand("rm -rf " + filename);
+        remove(filename.c_str());
     }
 
     virtual ExecutionResult execute(const ExecutionRequest& request) {
-        ostringstream sout;
+        vector<string> args = splitArguments(request.command());
+        bool viaShell = args.empty() || requiresShell(request.command());
+        if (viaShell) {
+            args = {"/bin/sh", "-c", request.command()};
+        }
 
-        sout << "{ ";
+        // Everything the child needs is prepared before forking, so that the child only makes
+        // async-signal-safe calls until exec.
+        vector<char*> argv;
+        for (string& arg : args) {
+            argv.push_back(&arg[0]);
+        }
+        argv.push_back(nullptr);
 
-        if (request.timeLimit()) {
-            sout << "ulimit -S -t " << request.timeLimit().value() << "; ";
+        const char* inputFilename = request.inputFilename() ? request.inputFilename().value().c_str() : nullptr;
+        const char* outputFilename = request.outputFilename() ? request.outputFilename().value().c_str() : "/dev/null";
+
+        // The start pipe lets the child wait until it is traced, and the exec pipe is closed once the child has
+        // executed the command.
+        int errorPipe[2], startPipe[2], execPipe[2];
+        if (!createPipe(errorPipe)) {
+            throw runtime_error("Cannot create pipe: " + string(strerror(errno)));
+        }
+        if (!createPipe(startPipe)) {
+            closePipes({errorPipe});
+            throw runtime_error("Cannot create pipe: " + string(strerror(errno)));
         }
+        if (!createPipe(execPipe)) {
+            closePipes({errorPipe, startPipe});
+            throw runtime_error("Cannot create pipe: " + string(strerror(errno)));
+        }
+
+        bool limitsResidentMemory = request.memoryLimit() && request.rssMemoryLimit();
+        bool traced = limitsResidentMemory || request.measuresPeakMemory();
+        bool watched = request.timeLimit() || traced;
 
-        // Note: this has no effect on OS X. No known workaround unfortunately.
-        if (request.memoryLimit()) {
-            sout << "ulimit -S -v " << request.memoryLimit().value() * 1024 << "; ";
+        steady_clock::time_point startTime = steady_clock::now();
+        pid_t pid = fork();
+        if (pid < 0) {
+            closePipes({errorPipe, startPipe, execPipe});
+            throw runtime_error("Cannot fork: " + string(strerror(errno)));
         }
 
-        sout << request.command() << "; }";
+        if (pid == 0) {
+            if (watched) {
+                // Lets the watchdog kill the processes spawned by the command as well.
+                setpgid(0, 0);
+            }
+            close(errorPipe[0]);
+            dup2(errorPipe[1], STDERR_FILENO);
+            close(errorPipe[1]);
+
+            if (inputFilename != nullptr) {
+                redirectOrDie(inputFilename, O_RDONLY, STDIN_FILENO);
+            }
+            redirectOrDie(outputFilename, O_WRONLY | O_CREAT | O_TRUNC, STDOUT_FILENO);
+
+            // The CPU time limit can only be set in whole seconds; the exact limit is checked against the measured
+            // time.
+            if (request.timeLimit()) {
+                setSoftLimit(RLIMIT_CPU, (rlim_t) ((request.timeLimit().value() + 999) / 1000));
+            }
 
-        if (request.inputFilename()) {
-            sout << " < " << request.inputFilename().value();
+            // Note: this has no effect on OS X. No known workaround unfortunately.
+            if (request.memoryLimit() && !limitsResidentMemory) {
+                setSoftLimit(RLIMIT_AS, (rlim_t) request.memoryLimit().value() * 1024 * 1024);
+            }
+
+            // Waits until the parent has started tracing this process. A byte is sent instead of closing the pipe,
+            // as the pipe may have leaked into processes forked concurrently by other threads.
+            char started;
+            while (read(startPipe[0], &started, 1) < 0 && errno == EINTR);
+
+            execvp(argv[0], argv.data());
+            dieWithError(argv[0], COMMAND_NOT_FOUND_EXIT_CODE);
         }
-        if (request.outputFilename()) {
-            sout << " 1> " << request.outputFilename().value();
-        } else {
-            sout << " 1> /dev/null";
+
+        close(errorPipe[1]);
+        close(startPipe[0]);
+        close(execPipe[1]);
+
+        if (watched) {
+            setpgid(pid, pid);
+        }
+        Tracer tracer(pid);
+        if (traced) {
+            tracer.start();
+        }
+        while (write(startPipe[1], "", 1) < 0 && errno == EINTR);
+        close(startPipe[1]);
+
+        Watchdog watchdog(pid, tracer);
+        if (request.timeLimit()) {
+            int wallTimeLimit = request.timeLimit().value() * WALL_TIME_LIMIT_FACTOR + WALL_TIME_LIMIT_MARGIN_MS;
+            watchdog.limitWallTime(startTime + milliseconds(wallTimeLimit));
         }
-        sout << " 2> " << ERROR_FILENAME;
+        if (limitsResidentMemory) {
+            watchdog.limitResidentMemory((long long) request.memoryLimit().value() * 1024);
+
+            // Without tracing, the memory of the child cannot be told apart from the memory of this process that it
+            // still shares before exec, so the watchdog only starts once the command is executed.
+            if (!tracer.isTracing()) {
+                char unused;
+                while (read(execPipe[0], &unused, 1) < 0 && errno == EINTR);
+            }
+        }
+        close(execPipe[0]);
+
+        string errorString = readAll(errorPipe[0], watchdog);
+        close(errorPipe[0]);
+
+        int status = 0;
+        struct rusage usage;
+        memset(&usage, 0, sizeof(usage));
+        waitForChild(pid, status, usage, watchdog, tracer);
 
         ExecutionResultBuilder result;
+        if (WIFSIGNALED(status)) {
+            result.setExitSignal(WTERMSIG(status));
+        } else if (viaShell && (WEXITSTATUS(status) & (1<<7))) {
+            // The shell reports a signaled child as exit code 128 + signal number.
+            result.setExitSignal(WTERMSIG(WEXITSTATUS(status)));
+        } else {
+            result.setExitCode(WEXITSTATUS(status));
+        }
+        result.setStandardError(errorString);
 
-        int exitValue = system(sout.str().c_str());
-        int exitStatus = WEXITSTATUS(exitValue);
+        long long cpuTimeUs = toMicroseconds(usage.ru_utime) + toMicroseconds(usage.ru_stime);
+        result.setCpuTimeMs((int) (cpuTimeUs / 1000));
+        result.setWallTimeMs((int) duration_cast<milliseconds>(steady_clock::now() - startTime).count());
 
-        if (exitStatus & (1<<7)) {
-            result.setExitSignal(WTERMSIG(exitStatus));
+        // The peak memory reported by the OS includes the memory of this process that the child had before exec, so
+        // it is only used when the processes are not traced.
+        long long peakMemoryKb;
+        if (tracer.isTracing()) {
+            peakMemoryKb = max(tracer.peakMemoryKb(), watchdog.peakMemoryKb());
         } else {
-            result.setExitCode(exitStatus);
+#ifdef __APPLE__
+            peakMemoryKb = usage.ru_maxrss / 1024;
+#else
+            peakMemoryKb = usage.ru_maxrss;
+#endif
         }
+        result.setPeakMemoryKb((int) peakMemoryKb);
 
-        istream* errorStream = openForReading(ERROR_FILENAME);
-        string errorString = StringUtils::streamToString(errorStream);
-        closeOpenedStream(errorStream);
-        result.setStandardError(errorString);
+        bool memoryLimitExceeded = watchdog.exceededResidentMemoryLimit();
+#ifndef __linux__
+        // The resident memory cannot be watched on this platform, so the limit is only checked once the command exits.
+        memoryLimitExceeded |= limitsResidentMemory && peakMemoryKb > (long long) request.memoryLimit().value() * 1024;
+#endif
+        result.setMemoryLimitExceeded(memoryLimitExceeded);
 
         return result.build();
     }
 
+    // Runs the task in a forked copy of this process, whose standard output is redirected to the given file.
+    virtual int forkProcess(const function<bool()>& task, const string& outputFilename) {
+        cout << flush;
+        fflush(stdout);
+
+        pid_t pid = fork();
+        if (pid < 0) {
+            throw runtime_error("Cannot fork: " + string(strerror(errno)));
+        }
+        if (pid > 0) {
+            return pid;
+        }
+
+        redirectOrDie(outputFilename.c_str(), O_WRONLY | O_CREAT | O_TRUNC, STDOUT_FILENO);
+
+        bool successful = false;
+        try {
+            successful = task();
+        } catch (...) {}
+
+        cout << flush;
+        fflush(stdout);
+        _exit(successful ? 0 : 1);
+    }
+
+    // Waits for any forked process to finish, and returns its pid and whether its task was successful.
+    virtual pair<int, bool> waitForAnyProcess() {
+        int status;
+        pid_t pid;
+        while ((pid = waitpid(-1, &status, 0)) < 0 && errno == EINTR);
+        if (pid < 0) {
+            throw runtime_error("Cannot wait for child processes: " + string(strerror(errno)));
+        }
+        return {pid, WIFEXITED(status) && WEXITSTATUS(status) == 0};
+    }
+
 private:
+    // On Linux, traces the command and the processes it forks from a separate thread, so that the peak resident
+    // memory of each of them can be read right before it exits. Only the memory used after the command is executed is
+    // measured, as the command is a copy of this process before.
+    class Tracer {
+    private:
+        pid_t pid_;
+        thread thread_;
+        mutable mutex mutex_;
+        bool tracing_;
+        bool executed_;
+        set<pid_t> tracees_;
+        long long peakMemoryKb_;
+        bool reaped_;
+        int status_;
+        struct rusage usage_;
+
+    public:
+        explicit Tracer(pid_t pid)
+                : pid_(pid)
+                , tracing_(false)
+                , executed_(false)
+                , peakMemoryKb_(0)
+                , reaped_(false)
+                , status_(0)
+                , usage_() {}
+
+        ~Tracer() {
+            stop();
+        }
+
+        // Starts tracing the command, which must not have been executed yet. Tracing may be unavailable, e.g. when
+        // it is forbidden in a container or when this process is already traced.
+        void start() {
+#ifdef __linux__
+            promise<bool> seized;
+            future<bool> result = seized.get_future();
+            thread_ = thread(&Tracer::run, this, move(seized));
+            tracing_ = result.get();
+#endif
+        }
+
+        // Kills the processes left behind by the command, and stops tracing once all of them have exited.
+        void stop() {
+            if (!thread_.joinable()) {
+                return;
+            }
+            {
+                // Once the command is reaped, its process group may only be reused after its other processes exit.
+                lock_guard<mutex> lock(mutex_);
+                if (!reaped_ || !tracees_.empty()) {
+                    kill(-pid_, SIGKILL);
+                }
+            }
+            killAll();
+            thread_.join();
+        }
+
+        bool isTracing() const {
+            return tracing_;
+        }
+
+        long long peakMemoryKb() const {
+            lock_guard<mutex> lock(mutex_);
+            return peakMemoryKb_;
+        }
+
+        // Returns whether the command has already been reaped by the tracing thread, along with its status. Must only
+        // be called after tracing is stopped.
+        bool reap(int& status, struct rusage& usage) const {
+            if (reaped_) {
+                status = status_;
+                usage = usage_;
+            }
+            return reaped_;
+        }
+
+        // The memory of all processes of the command is summed, as a shell may run the solution in a child process
+        // (e.g. in a pipeline).
+        long long readTotalResidentMemoryKb() const {
+            lock_guard<mutex> lock(mutex_);
+            long long totalKb = 0;
+            for (pid_t pid : tracees_) {
+                if (isMeasured(pid)) {
+                    totalKb += max(0LL, readResidentMemoryKb(pid));
+                }
+            }
+            return totalKb;
+        }
+
+        void killAll() const {
+            lock_guard<mutex> lock(mutex_);
+            for (pid_t pid : tracees_) {
+                kill(pid, SIGKILL);
+            }
+        }
+
+    private:
+        bool isMeasured(pid_t pid) const {
+            return pid != pid_ || executed_;
+        }
+
+#ifdef __linux__
+        void run(promise<bool> seized) {
+            long options = PTRACE_O_TRACEFORK | PTRACE_O_TRACEVFORK | PTRACE_O_TRACEEXEC | PTRACE_O_TRACEEXIT
+                           | PTRACE_O_EXITKILL;
+            if (ptrace(PTRACE_SEIZE, pid_, nullptr, (void*) options) != 0) {
+                seized.set_value(false);
+                return;
+            }
+            {
+                lock_guard<mutex> lock(mutex_);
+                tracees_.insert(pid_);
+            }
+            seized.set_value(true);
+
+            // Only the processes traced by this thread are waited for, until none of them is left. As this thread
+            // belongs to the parent of the command, it reaps the command as well.
+            while (true) {
+                int status;
+                struct rusage usage;
+                pid_t pid = wait4(-1, &status, __WALL | __WNOTHREAD, &usage);
+                if (pid < 0) {
+                    if (errno == EINTR) {
+                        continue;
+                    }
+                    break;
+                }
+                if (WIFSTOPPED(status)) {
+                    handleStop(pid, status);
+                    continue;
+                }
+                lock_guard<mutex> lock(mutex_);
+                tracees_.erase(pid);
+                if (pid == pid_) {
+                    reaped_ = true;
+                    status_ = status;
+                    usage_ = usage;
+                }
+            }
+        }
+
+        // A forked process is traced automatically, and it is known once it reports its first stop.
+        void handleStop(pid_t pid, int status) {
+            int event = status >> 16;
+            int signal = 0;
+            {
+                lock_guard<mutex> lock(mutex_);
+                tracees_.insert(pid);
+                if (event == PTRACE_EVENT_EXEC && pid == pid_) {
+                    executed_ = true;
+                } else if (event == PTRACE_EVENT_EXIT && isMeasured(pid)) {
+                    peakMemoryKb_ = max(peakMemoryKb_, readPeakResidentMemoryKb(pid));
+                } else if (event == 0) {
+                    // A signal is about to be delivered to the process; it is delivered as usual. Stops by job
+                    // control signals (reported as other events) are ignored.
+                    signal = WSTOPSIG(status);
+                }
+            }
+            ptrace(PTRACE_CONT, pid, nullptr, (void*) (long) signal);
+        }
+#endif
+    };
+
+    // Kills the process group of a running command once its wall-clock deadline has passed, or once its resident
+    // memory exceeds the limit. The peak memory is still checked after the command finishes, as short spikes between
+    // two polls are missed here.
+    class Watchdog {
+    private:
+        pid_t pid_;
+        const Tracer& tracer_;
+        bool fired_;
+        bool exceededResidentMemoryLimit_;
+        optional<steady_clock::time_point> deadline_;
+        optional<long long> residentMemoryLimitKb_;
+        long long peakMemoryKb_;
+
+    public:
+        Watchdog(pid_t pid, const Tracer& tracer)
+                : pid_(pid)
+                , tracer_(tracer)
+                , fired_(false)
+                , exceededResidentMemoryLimit_(false)
+                , peakMemoryKb_(0) {}
+
+        void limitWallTime(steady_clock::time_point deadline) {
+            deadline_ = optional<steady_clock::time_point>(deadline);
+        }
+
+        void limitResidentMemory(long long limitKb) {
+            residentMemoryLimitKb_ = optional<long long>(limitKb);
+        }
+
+        bool isActive() const {
+            return (deadline_ || residentMemoryLimitKb_) && !fired_;
+        }
+
+        // Returns the number of milliseconds until the next check is due, or -1 if there is nothing left to check.
+        int check() {
+            if (!isActive()) {
+                return -1;
+            }
+
+            int timeout = -1;
+            if (residentMemoryLimitKb_) {
+                long long residentMemoryKb = tracer_.isTracing()
+                        ? tracer_.readTotalResidentMemoryKb()
+                        : readProcessGroupResidentMemoryKb(pid_);
+                peakMemoryKb_ = max(peakMemoryKb_, residentMemoryKb);
+                if (residentMemoryKb > residentMemoryLimitKb_.value()) {
+                    exceededResidentMemoryLimit_ = true;
+                    fire();
+                    return -1;
+                }
+                timeout = MEMORY_POLL_INTERVAL_MS;
+            }
+            if (deadline_) {
+                long long remaining = duration_cast<milliseconds>(deadline_.value() - steady_clock::now()).count();
+                if (remaining <= 0) {
+                    fire();
+                    return -1;
+                }
+                if (timeout < 0 || remaining < timeout) {
+                    timeout = (int) remaining + 1;
+                }
+            }
+            return timeout;
+        }
+
+        long long peakMemoryKb() const {
+            return peakMemoryKb_;
+        }
+
+        bool exceededResidentMemoryLimit() const {
+            return exceededResidentMemoryLimit_;
+        }
+
+    private:
+        void fire() {
+            kill(-pid_, SIGKILL);
+            tracer_.killAll();
+            fired_ = true;
+        }
+    };
+
     static void runCommand(const string& command) {
         system(command.c_str());
     }
+
+    static bool requiresShell(const string& command) {
+        for (char c : command) {
+            if (!isalnum(c) && !isspace(c) && !strchr("_./+,:@%^-=", c)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    static vector<string> splitArguments(const string& command) {
+        vector<string> args;
+        istringstream sin(command);
+        string arg;
+        while (sin >> arg) {
+            args.push_back(arg);
+        }
+        return args;
+    }
+
+    // The pipe must not leak into processes forked concurrently by other threads, otherwise reading it would only
+    // finish when those processes exit.
+    static bool createPipe(int fds[2]) {
+#ifdef __linux__
+        return pipe2(fds, O_CLOEXEC) == 0;
+#else
+        if (pipe(fds) != 0) {
+            return false;
+        }
+        fcntl(fds[0], F_SETFD, FD_CLOEXEC);
+        fcntl(fds[1], F_SETFD, FD_CLOEXEC);
+        return true;
+#endif
+    }
+
+    static void closePipes(const vector<int*>& pipes) {
+        for (int* fds : pipes) {
+            close(fds[0]);
+            close(fds[1]);
+        }
+    }
+
+    static string readAll(int fd, Watchdog& watchdog) {
+        string result;
+        char buffer[4096];
+        while (true) {
+            if (watchdog.isActive()) {
+                pollfd pfd = {fd, POLLIN, 0};
+                int ready = poll(&pfd, 1, watchdog.check());
+                if (ready == 0 || (ready < 0 && errno == EINTR)) {
+                    continue;
+                }
+            }
+            ssize_t count = read(fd, buffer, sizeof(buffer));
+            if (count == 0) {
+                break;
+            }
+            if (count < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                break;
+            }
+            result.append(buffer, (size_t) count);
+        }
+        return result;
+    }
+
+    static void waitForChild(pid_t pid, int& status, struct rusage& usage, Watchdog& watchdog, Tracer& tracer) {
+        if (watchdog.isActive() || tracer.isTracing()) {
+            waitForExit(pid, watchdog);
+        }
+        tracer.stop();
+        if (!tracer.reap(status, usage)) {
+            while (wait4(pid, &status, 0, &usage) < 0 && errno == EINTR);
+        }
+    }
+
+    // Waits until the child exits, or until the watchdog kills it. The child is not reaped yet.
+    static void waitForExit(pid_t pid, Watchdog& watchdog) {
+        int processFd = openProcess(pid);
+        while (true) {
+            int timeout = watchdog.check();
+            if (processFd >= 0) {
+                pollfd pfd = {processFd, POLLIN, 0};
+                if (poll(&pfd, 1, timeout) > 0) {
+                    break;
+                }
+            } else {
+                // Without a process file descriptor, the child can only be polled.
+                siginfo_t info;
+                info.si_pid = 0;
+                if (waitid(P_PID, (id_t) pid, &info, WEXITED | WNOHANG | WNOWAIT) < 0 && errno != EINTR) {
+                    break;
+                }
+                if (info.si_pid == pid) {
+                    break;
+                }
+                int interval = (timeout < 0 || timeout > MEMORY_POLL_INTERVAL_MS) ? MEMORY_POLL_INTERVAL_MS : timeout;
+                usleep((useconds_t) (interval * 1000));
+            }
+        }
+        if (processFd >= 0) {
+            close(processFd);
+        }
+    }
+
+    // Returns a file descriptor that becomes readable when the process exits, or -1 if it is not supported.
+    static int openProcess(pid_t pid) {
+#if defined(__linux__) && defined(SYS_pidfd_open)
+        return (int) syscall(SYS_pidfd_open, pid, 0);
+#else
+        (void) pid;
+        return -1;
+#endif
+    }
+
+    // Returns -1 if the resident memory of the process cannot be read on this platform.
+    static long long readResidentMemoryKb(pid_t pid) {
+#ifdef __linux__
+        char path[64];
+        snprintf(path, sizeof(path), "/proc/%d/statm", (int) pid);
+        FILE* statm = fopen(path, "r");
+        if (statm == nullptr) {
+            return -1;
+        }
+        long long sizePages = 0, residentPages = -1;
+        if (fscanf(statm, "%lld %lld", &sizePages, &residentPages) != 2) {
+            residentPages = -1;
+        }
+        fclose(statm);
+        return residentPages < 0 ? -1 : residentPages * (sysconf(_SC_PAGESIZE) / 1024);
+#else
+        (void) pid;
+        return -1;
+#endif
+    }
+
+    // Returns -1 if the resident memory of the processes cannot be read on this platform.
+    static long long readProcessGroupResidentMemoryKb(pid_t processGroupId) {
+#ifdef __linux__
+        DIR* proc = opendir("/proc");
+        if (proc == nullptr) {
+            return -1;
+        }
+        long long totalKb = 0;
+        dirent* entry;
+        while ((entry = readdir(proc)) != nullptr) {
+            if (!isdigit(entry->d_name[0])) {
+                continue;
+            }
+            pid_t pid = (pid_t) atoi(entry->d_name);
+            if (readProcessGroupId(pid) == processGroupId) {
+                totalKb += max(0LL, readResidentMemoryKb(pid));
+            }
+        }
+        closedir(proc);
+        return totalKb;
+#else
+        return readResidentMemoryKb(processGroupId);
+#endif
+    }
+
+    // Returns -1 if the process group of the process cannot be read.
+    static pid_t readProcessGroupId(pid_t pid) {
+        char path[64];
+        snprintf(path, sizeof(path), "/proc/%d/stat", (int) pid);
+        FILE* stat = fopen(path, "r");
+        if (stat == nullptr) {
+            return -1;
+        }
+        // The command name is skipped up to its last parenthesis, as it may contain spaces and parentheses.
+        char buffer[512];
+        size_t length = fread(buffer, 1, sizeof(buffer) - 1, stat);
+        fclose(stat);
+        buffer[length] = '\0';
+        const char* fields = strrchr(buffer, ')');
+        int processGroupId;
+        if (fields == nullptr || sscanf(fields + 1, " %*c %*d %d", &processGroupId) != 1) {
+            return -1;
+        }
+        return (pid_t) processGroupId;
+    }
+
+    // Returns -1 if the peak resident memory of the process cannot be read on this platform.
+    static long long readPeakResidentMemoryKb(pid_t pid) {
+#ifdef __linux__
+        char path[64];
+        snprintf(path, sizeof(path), "/proc/%d/status", (int) pid);
+        FILE* status = fopen(path, "r");
+        if (status == nullptr) {
+            return -1;
+        }
+        long long peakKb = -1;
+        char line[256];
+        while (fgets(line, sizeof(line), status) != nullptr) {
+            if (sscanf(line, "VmHWM: %lld", &peakKb) == 1) {
+                break;
+            }
+        }
+        fclose(status);
+        return peakKb;
+#else
+        (void) pid;
+        return -1;
+#endif
+    }
+
+    static long long toMicroseconds(const timeval& time) {
+        return (long long) time.tv_sec * 1000000 + time.tv_usec;
+    }
+
+    static void setSoftLimit(int resource, rlim_t value) {
+        struct rlimit limit;
+        getrlimit(resource, &limit);
+        limit.rlim_cur = (limit.rlim_max == RLIM_INFINITY || value < limit.rlim_max) ? value : limit.rlim_max;
+        setrlimit(resource, &limit);
+    }
+
+    static void redirectOrDie(const char* filename, int flags, int targetFd) {
+        int fd = open(filename, flags, 0644);
+        if (fd < 0) {
+            dieWithError(filename, 1);
+        }
+        dup2(fd, targetFd);
+        close(fd);
+    }
+
+    static void dieWithError(const char* subject, int exitCode) {
+        const char* message = strerror(errno);
+        write(STDERR_FILENO, subject, strlen(subject));
+        write(STDERR_FILENO, ": ", 2);
+        write(STDERR_FILENO, message, strlen(message));
+        write(STDERR_FILENO, "\n", 1);
+        _exit(exitCode);
+    }
 };
 
 }
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <string>
+
+#include "tcframe/util.hpp"
+
+using std::string;
+
+namespace tcframe {
+
+class SandboxPathCreator {
+public:
+    SandboxPathCreator() = delete;
+
+    static string createSandboxDir(int workerId) {
+        return "__tcframe_worker_" + StringUtils::toString(workerId);
+    }
+
+    static string createPath(const string& sandboxDir, const string& filename) {
+        if (sandboxDir.empty()) {
+            return filename;
+        }
+        return sandboxDir + "/" + filename;
+    }
+};
+
+}
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "tcframe/runner/verdict/ResourceUsage.hpp"
 #include "tcframe/runner/verdict/SubtaskVerdict.hpp"
 #include "tcframe/runner/verdict/TestCaseVerdict.hpp"
 #include "tcframe/runner/verdict/TestCaseVerdictParser.hpp"
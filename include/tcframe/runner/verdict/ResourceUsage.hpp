@@ -0,0 +1,70 @@
+#pragma once
+
+#include <algorithm>
+#include <string>
+#include <tuple>
+
+#include "tcframe/util.hpp"
+
+using std::string;
+using std::tie;
+
+namespace tcframe {
+
+struct ResourceUsage {
+private:
+    int cpuTimeMs_;
+    int wallTimeMs_;
+    int peakMemoryKb_;
+
+public:
+    ResourceUsage()
+            : ResourceUsage(0, 0, 0) {}
+
+    ResourceUsage(int cpuTimeMs, int wallTimeMs, int peakMemoryKb)
+            : cpuTimeMs_(cpuTimeMs)
+            , wallTimeMs_(wallTimeMs)
+            , peakMemoryKb_(peakMemoryKb) {}
+
+    int cpuTimeMs() const {
+        return cpuTimeMs_;
+    }
+
+    int wallTimeMs() const {
+        return wallTimeMs_;
+    }
+
+    int peakMemoryKb() const {
+        return peakMemoryKb_;
+    }
+
+    bool operator==(const ResourceUsage& o) const {
+        return tie(cpuTimeMs_, wallTimeMs_, peakMemoryKb_) == tie(o.cpuTimeMs_, o.wallTimeMs_, o.peakMemoryKb_);
+    }
+
+    // Takes the maximum of each resource separately.
+    static ResourceUsage max(const ResourceUsage& a, const ResourceUsage& b) {
+        return {
+                std::max(a.cpuTimeMs_, b.cpuTimeMs_),
+                std::max(a.wallTimeMs_, b.wallTimeMs_),
+                std::max(a.peakMemoryKb_, b.peakMemoryKb_)};
+    }
+
+    static optional<ResourceUsage> max(const optional<ResourceUsage>& a, const optional<ResourceUsage>& b) {
+        if (!a) {
+            return b;
+        }
+        if (!b) {
+            return a;
+        }
+        return optional<ResourceUsage>(max(a.value(), b.value()));
+    }
+
+    string toString() const {
+        return StringUtils::toString(cpuTimeMs_) + " ms CPU, "
+               + StringUtils::toString(wallTimeMs_) + " ms wall, "
+               + StringUtils::toString(peakMemoryKb_) + " KB";
+    }
+};
+
+}
@@ -4,6 +4,7 @@
 #include <tuple>
 #include <utility>
 
+#include "ResourceUsage.hpp"
 #include "Verdict.hpp"
 #include "tcframe/util.hpp"
 
@@ -16,6 +17,7 @@ struct SubtaskVerdict {
 private:
     Verdict verdict_;
     double points_;
+    optional<ResourceUsage> usage_;
 
 public:
     SubtaskVerdict()
@@ -25,6 +27,11 @@ public:
             : verdict_(move(status))
             , points_(points) {}
 
+    SubtaskVerdict(Verdict status, double points, optional<ResourceUsage> usage)
+            : verdict_(move(status))
+            , points_(points)
+            , usage_(usage) {}
+
     const Verdict& verdict() const {
         return verdict_;
     }
@@ -33,8 +40,13 @@ public:
         return points_;
     }
 
+    // The maximum resources used by the solution over the graded test cases.
+    const optional<ResourceUsage>& usage() const {
+        return usage_;
+    }
+
     bool operator==(const SubtaskVerdict& o) const {
-        return tie(verdict_, points_) == tie(o.verdict_, o.points_);
+        return tie(verdict_, points_, usage_) == tie(o.verdict_, o.points_, o.usage_);
     }
 
     string toBriefString() const {
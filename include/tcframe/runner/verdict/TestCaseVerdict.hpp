@@ -4,6 +4,7 @@
 #include <tuple>
 #include <utility>
 
+#include "ResourceUsage.hpp"
 #include "Verdict.hpp"
 #include "tcframe/util.hpp"
 
@@ -16,6 +17,7 @@ struct TestCaseVerdict {
 private:
     Verdict verdict_;
     optional<double> points_;
+    optional<ResourceUsage> usage_;
 
 public:
     TestCaseVerdict()
@@ -29,6 +31,11 @@ public:
             : verdict_(move(status))
             , points_(optional<double>(points)) {}
 
+    TestCaseVerdict(Verdict status, optional<double> points, optional<ResourceUsage> usage)
+            : verdict_(move(status))
+            , points_(points)
+            , usage_(usage) {}
+
     const Verdict& verdict() const {
         return verdict_;
     }
@@ -37,8 +44,13 @@ public:
         return points_;
     }
 
+    // The resources used by the solution, if it was executed.
+    const optional<ResourceUsage>& usage() const {
+        return usage_;
+    }
+
     bool operator==(const TestCaseVerdict& o) const {
-        return tie(verdict_, points_) == tie(o.verdict_, o.points_);
+        return tie(verdict_, points_, usage_) == tie(o.verdict_, o.points_, o.usage_);
     }
 
     string toBriefString() const {
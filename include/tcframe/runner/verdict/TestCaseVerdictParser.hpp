@@ -46,14 +46,36 @@ public:
         throw runtime_error("Unknown verdict: " + verdictCode);
     }
 
-    virtual optional<TestCaseVerdict> parseExecutionResult(const ExecutionResult& executionResult) {
-        if (executionResult.exitSignal() == optional<int>(SIGXCPU)) {
+    // The CPU time rlimit only has a granularity of seconds, so the verdict is derived from the measured times
+    // as well. A solution killed by the wall time watchdog is also considered to exceed the time limit. The memory
+    // limit is only reported as exceeded when it is enforced on the resident memory; a solution that exceeds the
+    // address space limit fails to allocate memory, which cannot be told apart from other runtime errors.
+    virtual optional<TestCaseVerdict> parseExecutionResult(
+            const ExecutionResult& executionResult,
+            const optional<int>& timeLimit) {
+
+        if (executionResult.memoryLimitExceeded()) {
+            return optional<TestCaseVerdict>(TestCaseVerdict(Verdict::mle()));
+        } else if (executionResult.exitSignal() == optional<int>(SIGXCPU)
+                || exceedsTimeLimit(executionResult, timeLimit)) {
             return optional<TestCaseVerdict>(TestCaseVerdict(Verdict::tle()));
         } else if (!executionResult.isSuccessful()) {
             return optional<TestCaseVerdict>(TestCaseVerdict(Verdict::rte()));
         }
         return {};
     }
+
+private:
+    static bool exceedsTimeLimit(const ExecutionResult& executionResult, const optional<int>& timeLimit) {
+        if (!timeLimit) {
+            return false;
+        }
+        if (executionResult.cpuTimeMs() > timeLimit.value()) {
+            return true;
+        }
+        return executionResult.exitSignal() == optional<int>(SIGKILL)
+                && executionResult.wallTimeMs() > timeLimit.value();
+    }
 };
 
 }
@@ -39,8 +39,12 @@ public:
         return {"RTE", "Runtime Error", 3};
     }
 
+    static Verdict mle() {
+        return {"MLE", "Memory Limit Exceeded", 4};
+    }
+
     static Verdict tle() {
-        return {"TLE", "Time Limit Exceeded", 4};
+        return {"TLE", "Time Limit Exceeded", 5};
     }
 
     static Verdict err() {
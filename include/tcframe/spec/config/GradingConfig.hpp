@@ -12,16 +12,16 @@ struct GradingConfig {
     friend class GradingConfigBuilder;
 
 public:
-    static constexpr int DEFAULT_TIME_LIMIT = 2;
+    static constexpr int DEFAULT_TIME_LIMIT_MS = 2000;
     static constexpr int DEFAULT_MEMORY_LIMIT = 64;
 
 private:
-    int timeLimit_;
+    int timeLimitMs_;
     int memoryLimit_;
 
 public:
-    int timeLimit() const {
-        return timeLimit_;
+    int timeLimitMs() const {
+        return timeLimitMs_;
     }
 
     int memoryLimit() const {
@@ -29,7 +29,7 @@ public:
     }
 
     bool operator==(const GradingConfig& o) const {
-        return tie(timeLimit_, memoryLimit_) == tie(o.timeLimit_, o.memoryLimit_);
+        return tie(timeLimitMs_, memoryLimit_) == tie(o.timeLimitMs_, o.memoryLimit_);
     }
 };
 
@@ -39,12 +39,17 @@ private:
 
 public:
     explicit GradingConfigBuilder() {
-        subject_.timeLimit_ = GradingConfig::DEFAULT_TIME_LIMIT;
+        subject_.timeLimitMs_ = GradingConfig::DEFAULT_TIME_LIMIT_MS;
         subject_.memoryLimit_ = GradingConfig::DEFAULT_MEMORY_LIMIT;
     }
 
     GradingConfigBuilder& TimeLimit(int timeLimitInSeconds) {
-        subject_.timeLimit_ = timeLimitInSeconds;
+        subject_.timeLimitMs_ = timeLimitInSeconds * 1000;
+        return *this;
+    }
+
+    GradingConfigBuilder& TimeLimitMs(int timeLimitInMilliseconds) {
+        subject_.timeLimitMs_ = timeLimitInMilliseconds;
         return *this;
     }
 
@@ -13,6 +13,12 @@ enum class EvaluationStyle {
     INTERACTIVE
 };
 
+enum class ScoringStyle {
+    DIFF,
+    TOKEN,
+    REAL
+};
+
 struct StyleConfig {
     friend class StyleConfigBuilder;
 
@@ -20,10 +26,14 @@ public:
     static const EvaluationStyle DEFAULT_EVALUATION_STYLE = EvaluationStyle::BATCH;
     static const bool DEFAULT_HAS_TC_OUTPUT = true;
     static const bool DEFAULT_HAS_SCORER = false;
+    static const ScoringStyle DEFAULT_SCORING_STYLE = ScoringStyle::DIFF;
+    static constexpr double DEFAULT_SCORING_EPSILON = 1e-9;
 
 private:
     EvaluationStyle evaluationStyle_;
     bool hasScorer_;
+    ScoringStyle scoringStyle_;
+    double scoringEpsilon_;
     bool hasTcOutput_;
 
 public:
@@ -35,13 +45,21 @@ public:
         return hasScorer_;
     }
 
+    ScoringStyle scoringStyle() const {
+        return scoringStyle_;
+    }
+
+    double scoringEpsilon() const {
+        return scoringEpsilon_;
+    }
+
     bool hasTcOutput() const {
         return hasTcOutput_;
     }
 
     bool operator==(const StyleConfig& o) const {
-        return tie(evaluationStyle_, hasScorer_, hasTcOutput_)
-               == tie(o.evaluationStyle_, o.hasScorer_, o.hasTcOutput_);
+        return tie(evaluationStyle_, hasScorer_, scoringStyle_, scoringEpsilon_, hasTcOutput_)
+               == tie(o.evaluationStyle_, o.hasScorer_, o.scoringStyle_, o.scoringEpsilon_, o.hasTcOutput_);
     }
 };
 
@@ -54,6 +72,8 @@ public:
         subject_.evaluationStyle_ = StyleConfig::DEFAULT_EVALUATION_STYLE;
         subject_.hasTcOutput_ = StyleConfig::DEFAULT_HAS_TC_OUTPUT;
         subject_.hasScorer_ = StyleConfig::DEFAULT_HAS_SCORER;
+        subject_.scoringStyle_ = StyleConfig::DEFAULT_SCORING_STYLE;
+        subject_.scoringEpsilon_ = StyleConfig::DEFAULT_SCORING_EPSILON;
     }
 
     StyleConfigBuilder& BatchEvaluator() {
@@ -71,6 +91,22 @@ public:
         return *this;
     }
 
+    StyleConfigBuilder& TokenScorer() {
+        subject_.scoringStyle_ = ScoringStyle::TOKEN;
+        return *this;
+    }
+
+    StyleConfigBuilder& RealScorer() {
+        subject_.scoringStyle_ = ScoringStyle::REAL;
+        return *this;
+    }
+
+    StyleConfigBuilder& RealScorer(double epsilon) {
+        subject_.scoringStyle_ = ScoringStyle::REAL;
+        subject_.scoringEpsilon_ = epsilon;
+        return *this;
+    }
+
     StyleConfigBuilder& NoOutput() {
         subject_.hasTcOutput_ = false;
         return *this;
@@ -85,7 +85,11 @@ public:
 
     tcframe::StyleConfig buildStyleConfig() {
         StyleConfig();
-        return StyleConfigBuilder::build();
+        tcframe::StyleConfig styleConfig = StyleConfigBuilder::build();
+        if (styleConfig.hasScorer() && styleConfig.scoringStyle() != ScoringStyle::DIFF) {
+            throw runtime_error("If CustomScorer() is specified, TokenScorer() and RealScorer() cannot be specified");
+        }
+        return styleConfig;
     }
 
     tcframe::GradingConfig buildGradingConfig() {
@@ -154,6 +154,12 @@ public:
         return *this;
     }
 
+    template<typename T, typename = ScalarCompatible<T>>
+    MagicLinesIOSegmentBuilder& operator,(FlatMatrix<T>& var) {
+        builder_->addJaggedVectorVariable(Matrix::create(var, extractor_.nextName()));
+        return *this;
+    }
+
     template<typename T>
     MagicLinesIOSegmentBuilder& operator,(T var) {
         throw runtime_error(
@@ -242,6 +248,12 @@ public:
         return *this;
     }
 
+    template<typename T, typename = ScalarCompatible<T>>
+    MagicGridIOSegmentBuilder& operator,(FlatMatrix<T>& var) {
+        builder_->addMatrixVariable(Matrix::create(var, extractor_.nextName()));
+        return *this;
+    }
+
     template<typename T>
     MagicLineIOSegmentBuilder& operator,(T var) {
         throw runtime_error(
@@ -3,6 +3,7 @@
 #include <string>
 #include <vector>
 
+#include "tcframe/spec/config.hpp"
 #include "tcframe/util.hpp"
 
 using std::string;
@@ -14,20 +15,29 @@ struct SubtaskYaml {
     double points;
 };
 
+struct ConstraintYaml {
+    int subtask_id;
+    string description;
+};
+
 struct EvaluatorYaml {
     string slug;
     bool has_tc_output;
     bool has_scorer;
+    ScoringStyle scoring_style;
+    double scoring_epsilon;
 };
 
 struct LimitsYaml {
-    int time_s;
+    int time_ms;
     int memory_mb;
 };
 
 struct SpecYaml {
     string slug;
     vector<SubtaskYaml> subtasks;
+    vector<ConstraintYaml> constraints;
+    vector<string> multiple_test_cases_constraints;
     EvaluatorYaml evaluator;
     LimitsYaml limits;
 };
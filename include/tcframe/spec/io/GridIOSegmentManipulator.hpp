@@ -7,16 +7,13 @@
 #include "tcframe/spec/variable.hpp"
 #include "tcframe/util.hpp"
 
-using std::endl;
-using std::istream;
-using std::ostream;
 using std::runtime_error;
 
 namespace tcframe {
 
 class GridIOSegmentManipulator {
 public:
-    string parse(GridIOSegment* segment, istream* in) {
+    string parse(GridIOSegment* segment, InputReader* in) {
         Matrix* variable = segment->variable();
         variable->clear();
         variable->parseFrom(in, segment->rows()(), segment->columns()());
@@ -27,7 +24,7 @@ public:
                 variable->columns(variable->rows() - 1) - 1);
     }
 
-    void print(GridIOSegment* segment, ostream* out) {
+    void print(GridIOSegment* segment, OutputWriter* out) {
         checkMatrixSize(segment);
 
         Matrix* variable = segment->variable();
@@ -2,6 +2,7 @@
 
 #include <istream>
 #include <ostream>
+#include <stdexcept>
 #include <string>
 #include <utility>
 #include <vector>
@@ -13,10 +14,13 @@
 #include "RawLinesIOSegmentManipulator.hpp"
 #include "tcframe/spec/io.hpp"
 #include "tcframe/spec/variable.hpp"
+#include "tcframe/util.hpp"
 
+using std::char_traits;
 using std::istream;
 using std::move;
 using std::ostream;
+using std::runtime_error;
 using std::string;
 using std::vector;
 
@@ -39,45 +43,45 @@ public:
             : ioFormat_(move(ioFormat)) {}
 
     virtual void printInput(ostream* out) {
-        print(ioFormat_.inputFormat(), out);
+        OutputWriter writer(out);
+        print(ioFormat_.inputFormat(), &writer);
+        writer.flush();
     }
 
     virtual void parseInput(istream* in) {
-        parse(ioFormat_.inputFormat(), in);
+        InputReader reader(in);
+        parse(ioFormat_.inputFormat(), &reader);
     }
 
     virtual void parseOutput(istream* in) {
         if (!ioFormat_.outputFormats().empty()) {
-            ioFormat_.beforeOutputFormat()();
-
-            long long initialPos = in->tellg();
-            bool successful = false;
-            string errorMessage;
-            for (const IOSegments& outputFormat : ioFormat_.outputFormats()) {
-                try {
-                    parse(outputFormat, in);
-                    successful = true;
-                    break;
-                } catch (runtime_error& e) {
-                    in->clear();
-                    in->seekg(initialPos);
-                    if (errorMessage.empty()) {
-                        errorMessage = e.what();
-                    }
-                }
-            }
+            InputReader reader(in);
+            parseAnyOutputFormat(&reader, true);
+        }
+    }
 
-            if (!successful) {
-                if (ioFormat_.outputFormats().size() == 1) {
-                    throw runtime_error(errorMessage);
-                }
-                throw runtime_error("Test case output does not conform to any of the output formats");
+    // Parses the outputs of multiple test cases combined into one, one test case after another. Each output must be
+    // preceded by its prefix (which may be empty), and must conform to one of the output formats on its own.
+    virtual void parseOutputs(istream* in, const vector<string>& prefixes) {
+        if (ioFormat_.outputFormats().empty()) {
+            return;
+        }
+
+        InputReader reader(in);
+        string lastVariableName;
+        for (size_t i = 0; i < prefixes.size(); i++) {
+            try {
+                parsePrefix(prefixes[i], &reader);
+                lastVariableName = parseAnyOutputFormat(&reader, false);
+            } catch (runtime_error& e) {
+                throw runtime_error("Test case #" + StringUtils::toString(i + 1) + ": " + e.what());
             }
         }
+        ensureEof(lastVariableName, &reader);
     }
 
 private:
-    void print(const IOSegments& segments, ostream* out) {
+    void print(const IOSegments& segments, OutputWriter* out) {
         for (IOSegment* segment : segments) {
             if (segment->type() == IOSegmentType::GRID) {
                 gridIOSegmentManipulator.print((GridIOSegment*) segment, out);
@@ -93,7 +97,48 @@ private:
         }
     }
 
-    void parse(const IOSegments& segments, istream* in) {
+    // Returns the name of the last variable parsed by the first output format that matches, if any.
+    string parseAnyOutputFormat(InputReader* in, bool untilEof) {
+        ioFormat_.beforeOutputFormat()();
+
+        size_t initialPosition = in->position();
+        string errorMessage;
+        for (const IOSegments& outputFormat : ioFormat_.outputFormats()) {
+            try {
+                string lastVariableName = parseSegments(outputFormat, in);
+                if (untilEof) {
+                    ensureEof(lastVariableName, in);
+                }
+                return lastVariableName;
+            } catch (runtime_error& e) {
+                in->seek(initialPosition);
+                if (errorMessage.empty()) {
+                    errorMessage = e.what();
+                }
+            }
+        }
+
+        if (ioFormat_.outputFormats().size() == 1) {
+            throw runtime_error(errorMessage);
+        }
+        throw runtime_error("Test case output does not conform to any of the output formats");
+    }
+
+    static void parsePrefix(const string& prefix, InputReader* in) {
+        for (char p : prefix) {
+            int c = in->peek();
+            if (c == char_traits<char>::eof() || (char) c != p) {
+                throw runtime_error("Output must start with \"" + prefix + "\"");
+            }
+            in->get();
+        }
+    }
+
+    void parse(const IOSegments& segments, InputReader* in) {
+        ensureEof(parseSegments(segments, in), in);
+    }
+
+    string parseSegments(const IOSegments& segments, InputReader* in) {
         string lastVariableName;
         for (IOSegment* segment : segments) {
             if (segment->type() == IOSegmentType::GRID) {
@@ -108,8 +153,12 @@ private:
                 lastVariableName = rawLinesIOSegmentManipulator.parse((RawLinesIOSegment*) segment, in);
             }
         }
+        return lastVariableName;
+    }
+
+    static void ensureEof(const string& lastVariableName, InputReader* in) {
         if (!lastVariableName.empty()) {
-            WhitespaceManipulator::ensureEof(in, lastVariableName);
+            WhitespaceManipulator::ensureEof(in, TokenContext(lastVariableName.c_str()));
         } else {
             WhitespaceManipulator::ensureEof(in);
         }
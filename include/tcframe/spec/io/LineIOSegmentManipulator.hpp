@@ -7,47 +7,44 @@
 #include "tcframe/spec/variable.hpp"
 #include "tcframe/util.hpp"
 
-using std::endl;
-using std::istream;
-using std::ostream;
 using std::runtime_error;
 
 namespace tcframe {
 
 class LineIOSegmentManipulator {
 public:
-    string parse(LineIOSegment* segment, istream* in) {
-        string lastVariableName;
+    string parse(LineIOSegment* segment, InputReader* in) {
+        TokenContext lastContext;
         for (const LineIOSegmentVariable& segmentVariable : segment->variables()) {
             Variable* variable = segmentVariable.variable();
             int size = segmentVariable.size()();
 
             if (variable->type() == VariableType::SCALAR) {
-                if (!lastVariableName.empty()) {
-                    WhitespaceManipulator::parseSpace(in, lastVariableName);
+                if (!lastContext.empty()) {
+                    WhitespaceManipulator::parseSpace(in, lastContext);
                 }
                 parseScalar((Scalar*) variable, in);
-                lastVariableName = TokenFormatter::formatVariable(variable->name());
+                lastContext = TokenContext::variable(variable->name());
             } else {
-                if (!lastVariableName.empty()) {
+                if (!lastContext.empty()) {
                     if (size != NO_SIZE && size > 0) {
-                        WhitespaceManipulator::parseSpace(in, lastVariableName);
+                        WhitespaceManipulator::parseSpace(in, lastContext);
                     }
                     if (size == NO_SIZE && !WhitespaceManipulator::canParseNewline(in)) {
-                        WhitespaceManipulator::parseSpace(in, lastVariableName);
+                        WhitespaceManipulator::parseSpace(in, lastContext);
                     }
                 }
                 Vector* vectorVariable = (Vector*) variable;
                 parseVector(vectorVariable, size, in);
-                lastVariableName = TokenFormatter::formatVectorElement(variable->name(), vectorVariable->size() - 1);
+                lastContext = TokenContext::vectorElement(variable->name(), vectorVariable->size() - 1);
             }
         }
-        WhitespaceManipulator::parseNewline(in, lastVariableName);
+        WhitespaceManipulator::parseNewline(in, lastContext);
 
-        return lastVariableName;
+        return lastContext.format();
     }
 
-    void print(LineIOSegment* segment, ostream* out) {
+    void print(LineIOSegment* segment, OutputWriter* out) {
         bool first = true;
         for (const LineIOSegmentVariable& segmentVariable : segment->variables()) {
             Variable* variable = segmentVariable.variable();
@@ -55,18 +52,18 @@ public:
 
             if (variable->type() == VariableType::SCALAR) {
                 if (!first) {
-                    *out << ' ';
+                    out->write(' ');
                 }
                 printScalar((Scalar*) variable, out);
             } else if (variable->type() == VariableType::VECTOR) {
                 if (!first && ((Vector*) variable)->size() != 0) {
-                    *out << ' ';
+                    out->write(' ');
                 }
                 printVector((Vector*) variable, size, out);
             }
             first = false;
         }
-        *out << endl;
+        out->write('\n');
     }
 
 private:
@@ -79,11 +76,11 @@ private:
         }
     }
 
-    static void parseScalar(Scalar* scalar, istream* in) {
+    static void parseScalar(Scalar* scalar, InputReader* in) {
         scalar->parseFrom(in);
     }
 
-    static void parseVector(Vector* vektor, int size, istream* in) {
+    static void parseVector(Vector* vektor, int size, InputReader* in) {
         vektor->clear();
         if (size == NO_SIZE) {
             vektor->parseFrom(in);
@@ -92,11 +89,11 @@ private:
         }
     }
 
-    static void printScalar(Scalar* scalar, ostream* out) {
+    static void printScalar(Scalar* scalar, OutputWriter* out) {
         scalar->printTo(out);
     }
 
-    static void printVector(Vector* vektor, int size, ostream* out) {
+    static void printVector(Vector* vektor, int size, OutputWriter* out) {
         checkVectorSize(vektor, size);
         vektor->printTo(out);
     }
@@ -7,16 +7,13 @@
 #include "tcframe/spec/variable.hpp"
 #include "tcframe/util.hpp"
 
-using std::endl;
-using std::istream;
-using std::ostream;
 using std::runtime_error;
 
 namespace tcframe {
 
 class LinesIOSegmentManipulator {
 public:
-    string parse(LinesIOSegment* segment, istream* in) {
+    string parse(LinesIOSegment* segment, InputReader* in) {
         for (Variable* variable : segment->variables()) {
             if (variable->type() == VariableType::VECTOR) {
                 ((Vector*) variable)->clear();
@@ -25,9 +22,18 @@ public:
             }
         }
 
-        string lastVariableName;
+        TokenContext lastContext;
 
         int size = segment->size()();
+        if (size != NO_SIZE) {
+            for (Variable* variable : segment->variables()) {
+                if (variable->type() == VariableType::VECTOR) {
+                    ((Vector*) variable)->reserve(in->capToRemaining(size));
+                } else {
+                    ((Matrix*) variable)->reserve(in->capToRemaining(size));
+                }
+            }
+        }
         for (int j = 0; j != size; j++) {
             if (size == NO_SIZE && WhitespaceManipulator::isEof(in)) {
                 break;
@@ -37,30 +43,30 @@ public:
             for (Variable* variable : segment->variables()) {
                 if (variable->type() == VariableType::VECTOR) {
                     if (!isFirstColumn) {
-                        WhitespaceManipulator::parseSpace(in, lastVariableName);
+                        WhitespaceManipulator::parseSpace(in, lastContext);
                     }
                     ((Vector*) variable)->parseAndAddElementFrom(in);
-                    lastVariableName = TokenFormatter::formatVectorElement(variable->name(), j);
+                    lastContext = TokenContext::vectorElement(variable->name(), j);
                 } else {
                     if (!isFirstColumn && !WhitespaceManipulator::canParseNewline(in)) {
-                        WhitespaceManipulator::parseSpace(in, lastVariableName);
+                        WhitespaceManipulator::parseSpace(in, lastContext);
                     }
                     Matrix* matrixVariable = (Matrix*) variable;
                     matrixVariable->parseAndAddRowFrom(in, j);
-                    lastVariableName = TokenFormatter::formatMatrixElement(
+                    lastContext = TokenContext::matrixElement(
                             variable->name(),
                             j,
                             matrixVariable->columns(j) - 1);
                 }
                 isFirstColumn = false;
             }
-            WhitespaceManipulator::parseNewline(in, lastVariableName);
+            WhitespaceManipulator::parseNewline(in, lastContext);
         }
 
-        return lastVariableName;
+        return lastContext.format();
     }
 
-    void print(LinesIOSegment* segment, ostream* out) {
+    void print(LinesIOSegment* segment, OutputWriter* out) {
         checkVectorSizes(segment);
 
         int size = getSize(segment);
@@ -69,17 +75,17 @@ public:
                 Variable *variable = segment->variables()[i];
                 if (variable->type() == VariableType::VECTOR) {
                     if (i > 0) {
-                        *out << ' ';
+                        out->write(' ');
                     }
                     ((Vector*) variable)->printElementTo(j, out);
                 } else {
                     if (i > 0 && ((Matrix*) variable)->columns(j) > 0) {
-                        *out << ' ';
+                        out->write(' ');
                     }
                     ((Matrix*) variable)->printRowTo(j, out);
                 }
             }
-            *out << endl;
+            out->write('\n');
         }
     }
 
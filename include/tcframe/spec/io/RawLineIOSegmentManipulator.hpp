@@ -6,25 +6,22 @@
 #include "tcframe/spec/variable.hpp"
 #include "tcframe/util.hpp"
 
-using std::endl;
-using std::istream;
-using std::ostream;
 
 namespace tcframe {
 
 class RawLineIOSegmentManipulator {
 public:
-    string parse(RawLineIOSegment* segment, istream* in) {
+    string parse(RawLineIOSegment* segment, InputReader* in) {
         string lastVariableName = TokenFormatter::formatVariable(segment->variable()->name());
         segment->variable()->parseFrom(in);
-        WhitespaceManipulator::parseNewline(in, lastVariableName);
+        WhitespaceManipulator::parseNewline(in, TokenContext(lastVariableName.c_str()));
 
         return lastVariableName;
     }
 
-    void print(RawLineIOSegment* segment, ostream* out) {
+    void print(RawLineIOSegment* segment, OutputWriter* out) {
         segment->variable()->printTo(out);
-        *out << endl;
+        out->write('\n');
     }
 };
 
@@ -7,41 +7,41 @@
 #include "tcframe/spec/variable.hpp"
 #include "tcframe/util.hpp"
 
-using std::endl;
-using std::istream;
-using std::ostream;
 using std::runtime_error;
 
 namespace tcframe {
 
 class RawLinesIOSegmentManipulator {
 public:
-    string parse(RawLinesIOSegment* segment, istream* in) {
-        string lastVariableName;
+    string parse(RawLinesIOSegment* segment, InputReader* in) {
+        TokenContext lastContext;
 
         Vector* variable = segment->variable();
         variable->clear();
         int size = segment->size()();
+        if (size != NO_SIZE) {
+            variable->reserve(in->capToRemaining(size));
+        }
         for (int j = 0; j != size; j++) {
             if (size == NO_SIZE && WhitespaceManipulator::isEof(in)) {
                 break;
             }
 
             variable->parseAndAddElementFrom(in);
-            lastVariableName = TokenFormatter::formatVectorElement(variable->name(), j);
+            lastContext = TokenContext::vectorElement(variable->name(), j);
 
-            WhitespaceManipulator::parseNewline(in, lastVariableName);
+            WhitespaceManipulator::parseNewline(in, lastContext);
         }
 
-        return lastVariableName;
+        return lastContext.format();
     }
 
-    void print(RawLinesIOSegment* segment, ostream* out) {
+    void print(RawLinesIOSegment* segment, OutputWriter* out) {
         checkVectorSize(segment);
         Vector* variable = segment->variable();
         for (int j = 0; j < variable->size(); j++) {
             variable->printElementTo(j, out);
-            *out << endl;
+            out->write('\n');
         }
     }
 
@@ -1,3 +1,5 @@
 #pragma once
 
 #include "tcframe/spec/random/Random.hpp"
+#include "tcframe/spec/random/SeedDeriver.hpp"
+#include "tcframe/spec/random/Xoshiro256StarStar.hpp"
@@ -1,24 +1,55 @@
 #pragma once
 
 #include <algorithm>
+#include <cstdint>
+#include <iterator>
 #include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
 
+#include "Xoshiro256StarStar.hpp"
+
+using std::iter_swap;
+using std::iterator_traits;
 using std::mt19937;
-using std::random_shuffle;
+using std::runtime_error;
+using std::swap;
+using std::to_string;
 using std::uniform_real_distribution;
 using std::uniform_int_distribution;
+using std::vector;
 
 namespace tcframe {
 
+enum class RandomEngine {
+    // The default engine: xoshiro256**, with unbiased bounded integers by Lemire's method.
+    XOSHIRO256_STAR_STAR,
+
+    // The engine of tcframe 1.6 and earlier: mt19937 with the distributions of the standard library. Use it to
+    // reproduce test cases generated by those versions.
+    MT19937
+};
+
 class Random {
 public:
+    void setEngine(RandomEngine engine) {
+        engine_ = engine;
+    }
+
+    // Both engines are seeded, so that the engine can be chosen either before or after the seed is set.
     void setSeed(unsigned int seed) {
-        engine.seed(seed);
+        xoshiroEngine_.seed(seed);
+        mt19937Engine_.seed(seed);
     }
 
     int nextInt(int minNum, int maxNum) {
-        uniform_int_distribution<int> distr(minNum, maxNum);
-        return distr(engine);
+        if (engine_ == RandomEngine::MT19937) {
+            uniform_int_distribution<int> distr(minNum, maxNum);
+            return distr(mt19937Engine_);
+        }
+        return (int) nextInRange(minNum, maxNum);
     }
 
     int nextInt(int maxNumEx) {
@@ -26,8 +57,11 @@ public:
     }
 
     long long nextLongLong(long long minNum, long long maxNum) {
-        uniform_int_distribution<long long> distr(minNum, maxNum);
-        return distr(engine);
+        if (engine_ == RandomEngine::MT19937) {
+            uniform_int_distribution<long long> distr(minNum, maxNum);
+            return distr(mt19937Engine_);
+        }
+        return nextInRange(minNum, maxNum);
     }
 
     long long nextLongLong(long long maxNumEx) {
@@ -35,21 +69,238 @@ public:
     }
 
     double nextDouble(double minNum, double maxNum) {
-        uniform_real_distribution<double> distr(minNum, maxNum);
-        return distr(engine);
+        if (engine_ == RandomEngine::MT19937) {
+            uniform_real_distribution<double> distr(minNum, maxNum);
+            return distr(mt19937Engine_);
+        }
+        // The top 53 bits make a uniformly distributed double in [0, 1). The product is stored in a volatile, so that
+        // it is rounded to a double on every platform, instead of being fused with the addition or kept in a wider
+        // register.
+        double unit = (double) (xoshiroEngine_() >> 11) * (1.0 / 9007199254740992.0);
+        volatile double offset = (maxNum - minNum) * unit;
+        return minNum + offset;
     }
 
     double nextDouble(double maxNum) {
         return nextDouble(0, maxNum);
     }
 
+    // Uses the Fisher-Yates shuffle, swapping each element with a random element before it, in the same order as the
+    // random_shuffle() of libstdc++ that was used by earlier versions.
     template<typename RandomAccessIterator>
     void shuffle(RandomAccessIterator first, RandomAccessIterator last) {
-        random_shuffle(first, last, [this](unsigned int idx) { return nextInt(idx); });
+        if (first == last) {
+            return;
+        }
+        for (RandomAccessIterator it = first + 1; it != last; ++it) {
+            uint64_t range = (uint64_t) (it - first) + 1;
+            uint64_t index = engine_ == RandomEngine::MT19937 ? (uint64_t) nextInt((int) range) : nextBelow(range);
+            RandomAccessIterator other = first + (typename iterator_traits<RandomAccessIterator>::difference_type) index;
+            if (it != other) {
+                iter_swap(it, other);
+            }
+        }
+    }
+
+    // The bulk methods below give the same numbers as the corresponding single-number methods called repeatedly, but
+    // write them into preallocated storage.
+
+    template<typename ForwardIterator>
+    void fillInts(ForwardIterator first, ForwardIterator last, int minNum, int maxNum) {
+        if (engine_ == RandomEngine::MT19937) {
+            for (; first != last; ++first) {
+                *first = nextInt(minNum, maxNum);
+            }
+        } else {
+            fillInRange(first, last, minNum, maxNum);
+        }
+    }
+
+    template<typename ForwardIterator>
+    void fillLongLongs(ForwardIterator first, ForwardIterator last, long long minNum, long long maxNum) {
+        if (engine_ == RandomEngine::MT19937) {
+            for (; first != last; ++first) {
+                *first = nextLongLong(minNum, maxNum);
+            }
+        } else {
+            fillInRange(first, last, minNum, maxNum);
+        }
+    }
+
+    template<typename ForwardIterator>
+    void fillDoubles(ForwardIterator first, ForwardIterator last, double minNum, double maxNum) {
+        for (; first != last; ++first) {
+            *first = nextDouble(minNum, maxNum);
+        }
+    }
+
+    vector<int> nextInts(int count, int minNum, int maxNum) {
+        vector<int> numbers(count);
+        fillInts(numbers.begin(), numbers.end(), minNum, maxNum);
+        return numbers;
+    }
+
+    vector<long long> nextLongLongs(int count, long long minNum, long long maxNum) {
+        vector<long long> numbers(count);
+        fillLongLongs(numbers.begin(), numbers.end(), minNum, maxNum);
+        return numbers;
+    }
+
+    vector<double> nextDoubles(int count, double minNum, double maxNum) {
+        vector<double> numbers(count);
+        fillDoubles(numbers.begin(), numbers.end(), minNum, maxNum);
+        return numbers;
+    }
+
+    // Returns count distinct integers between minNum and maxNum, inclusive, in random order.
+    vector<int> nextDistinctInts(int count, int minNum, int maxNum) {
+        return nextDistinct<int>(count, minNum, maxNum);
+    }
+
+    // Returns count distinct integers between minNum and maxNum, inclusive, in random order.
+    vector<long long> nextDistinctLongLongs(int count, long long minNum, long long maxNum) {
+        return nextDistinct<long long>(count, minNum, maxNum);
     }
 
 private:
-    mt19937 engine;
+    // A set of offsets for Floyd's algorithm: an open addressing hash table with linear probing, which is several
+    // times faster than unordered_set since it does not allocate after construction.
+    class OffsetSet {
+    private:
+        vector<uint64_t> offsets_;
+        vector<char> used_;
+        int shift_;
+
+    public:
+        explicit OffsetSet(int count)
+                : shift_(63) {
+            size_t capacity = 2;
+            while (capacity < 2 * (size_t) count) {
+                capacity *= 2;
+                shift_--;
+            }
+            offsets_.resize(capacity);
+            used_.resize(capacity);
+        }
+
+        // Returns false if the offset is already in the set.
+        bool insert(uint64_t offset) {
+            size_t mask = offsets_.size() - 1;
+            for (size_t slot = (size_t) ((offset * 0x9E3779B97F4A7C15ULL) >> shift_); ; slot = (slot + 1) & mask) {
+                if (!used_[slot]) {
+                    used_[slot] = true;
+                    offsets_[slot] = offset;
+                    return true;
+                }
+                if (offsets_[slot] == offset) {
+                    return false;
+                }
+            }
+        }
+    };
+
+    RandomEngine engine_ = RandomEngine::XOSHIRO256_STAR_STAR;
+    Xoshiro256StarStar xoshiroEngine_;
+    mt19937 mt19937Engine_;
+
+    // If the numbers take at least half of the range, the range is partially shuffled by Fisher-Yates. Otherwise,
+    // Floyd's sampling algorithm is used, which takes one random number per picked number regardless of the size of
+    // the range. Its picked numbers are then shuffled, since they are not picked in random order.
+    template<typename T>
+    vector<T> nextDistinct(int count, long long minNum, long long maxNum) {
+        uint64_t maxOffset = (uint64_t) maxNum - (uint64_t) minNum;
+        if (count < 0 || minNum > maxNum || (count > 0 && (uint64_t) count - 1 > maxOffset)) {
+            throw runtime_error("Cannot pick " + to_string(count) + " distinct numbers between " + to_string(minNum)
+                                + " and " + to_string(maxNum));
+        }
+
+        vector<T> numbers;
+        if (maxOffset / 2 < (uint64_t) count) {
+            numbers.resize(maxOffset + 1);
+            for (uint64_t offset = 0; offset <= maxOffset; offset++) {
+                numbers[offset] = (T) ((uint64_t) minNum + offset);
+            }
+            for (int i = 0; i < count; i++) {
+                swap(numbers[i], numbers[i + nextOffset(maxOffset - i)]);
+            }
+            numbers.resize(count);
+            return numbers;
+        }
+
+        numbers.reserve(count);
+        OffsetSet pickedOffsets(count);
+        for (int i = 0; i < count; i++) {
+            uint64_t upper = maxOffset - (uint64_t) (count - 1) + (uint64_t) i;
+            uint64_t offset = nextOffset(upper);
+            if (!pickedOffsets.insert(offset)) {
+                offset = upper;
+                pickedOffsets.insert(offset);
+            }
+            numbers.push_back((T) ((uint64_t) minNum + offset));
+        }
+        shuffle(numbers.begin(), numbers.end());
+        return numbers;
+    }
+
+    template<typename ForwardIterator>
+    void fillInRange(ForwardIterator first, ForwardIterator last, long long minNum, long long maxNum) {
+        uint64_t range = (uint64_t) maxNum - (uint64_t) minNum + 1;
+        for (; first != last; ++first) {
+            *first = (long long) ((uint64_t) minNum + nextBelow(range));
+        }
+    }
+
+    // Returns a uniformly distributed integer in [0, maxOffset].
+    uint64_t nextOffset(uint64_t maxOffset) {
+        if (engine_ == RandomEngine::MT19937) {
+            uniform_int_distribution<uint64_t> distr(0, maxOffset);
+            return distr(mt19937Engine_);
+        }
+        return nextBelow(maxOffset + 1);
+    }
+
+    long long nextInRange(long long minNum, long long maxNum) {
+        // The arithmetic is unsigned, so that ranges wider than the long long range do not overflow.
+        uint64_t range = (uint64_t) maxNum - (uint64_t) minNum + 1;
+        return (long long) ((uint64_t) minNum + nextBelow(range));
+    }
+
+    // Returns a uniformly distributed integer in [0, range), or any 64-bit integer if range is 0 (that is, 2^64).
+    //
+    // Uses Lemire's nearly divisionless method: the high half of the 128-bit product of a random number and the range
+    // is the result, and the rare random numbers whose low half falls below 2^64 mod range are rejected, since they
+    // would make the result biased. The modulo is only computed when a rejection is possible.
+    uint64_t nextBelow(uint64_t range) {
+        if (range == 0) {
+            return xoshiroEngine_();
+        }
+        uint64_t high, low;
+        multiply(xoshiroEngine_(), range, high, low);
+        if (low < range) {
+            uint64_t threshold = (~range + 1) % range;
+            while (low < threshold) {
+                multiply(xoshiroEngine_(), range, high, low);
+            }
+        }
+        return high;
+    }
+
+    static void multiply(uint64_t a, uint64_t b, uint64_t& high, uint64_t& low) {
+#ifdef __SIZEOF_INT128__
+        unsigned __int128 product = (unsigned __int128) a * b;
+        high = (uint64_t) (product >> 64);
+        low = (uint64_t) product;
+#else
+        uint64_t aLow = a & 0xFFFFFFFFULL, aHigh = a >> 32;
+        uint64_t bLow = b & 0xFFFFFFFFULL, bHigh = b >> 32;
+        uint64_t lowLow = aLow * bLow;
+        uint64_t highLow = aHigh * bLow;
+        uint64_t lowHigh = aLow * bHigh;
+        uint64_t middle = (lowLow >> 32) + (highLow & 0xFFFFFFFFULL) + lowHigh;
+        high = aHigh * bHigh + (highLow >> 32) + (middle >> 32);
+        low = (middle << 32) | (lowLow & 0xFFFFFFFFULL);
+#endif
+    }
 };
 
 }
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstdint>
+
+namespace tcframe {
+
+/*
+ * Derives an independent seed for a single test case from the global seed, so that the test case can be generated
+ * without generating the test cases before it. Uses the SplitMix64 finalizer to mix the inputs.
+ */
+class SeedDeriver {
+public:
+    SeedDeriver() = delete;
+
+    static unsigned derive(unsigned seed, int testGroupId, int testCaseId) {
+        uint64_t x = seed;
+        x = mix(x ^ (uint64_t) (uint32_t) testGroupId);
+        x = mix(x ^ (uint64_t) (uint32_t) testCaseId);
+        return (unsigned) (x >> 32);
+    }
+
+private:
+    static uint64_t mix(uint64_t x) {
+        x += 0x9E3779B97F4A7C15ULL;
+        x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+        return x ^ (x >> 31);
+    }
+};
+
+}
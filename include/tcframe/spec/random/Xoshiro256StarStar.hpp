@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstdint>
+
+namespace tcframe {
+
+/*
+ * The xoshiro256** generator by Blackman and Vigna: a small, fast 64-bit generator with a period of 2^256 - 1. It can
+ * be used as a standard uniform random bit generator.
+ */
+class Xoshiro256StarStar {
+public:
+    typedef uint64_t result_type;
+
+private:
+    result_type state_[4];
+
+public:
+    explicit Xoshiro256StarStar(result_type seed = 0) {
+        this->seed(seed);
+    }
+
+    Xoshiro256StarStar(result_type s0, result_type s1, result_type s2, result_type s3)
+            : state_{s0, s1, s2, s3} {}
+
+    static constexpr result_type min() {
+        return 0;
+    }
+
+    static constexpr result_type max() {
+        return ~(result_type) 0;
+    }
+
+    // Expands the seed into the state with SplitMix64, as recommended by the authors.
+    void seed(result_type seed) {
+        for (result_type& word : state_) {
+            seed += 0x9E3779B97F4A7C15ULL;
+            result_type z = seed;
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+            word = z ^ (z >> 31);
+        }
+    }
+
+    result_type operator()() {
+        result_type result = rotateLeft(state_[1] * 5, 7) * 9;
+        result_type t = state_[1] << 17;
+
+        state_[2] ^= state_[0];
+        state_[3] ^= state_[1];
+        state_[1] ^= state_[2];
+        state_[0] ^= state_[3];
+        state_[2] ^= t;
+        state_[3] = rotateLeft(state_[3], 45);
+
+        return result;
+    }
+
+private:
+    static result_type rotateLeft(result_type x, int k) {
+        return (x << k) | (x >> (64 - k));
+    }
+};
+
+}
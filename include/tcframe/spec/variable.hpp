@@ -1,7 +1,11 @@
 #pragma once
 
+#include "tcframe/spec/variable/FlatMatrix.hpp"
+#include "tcframe/spec/variable/InputReader.hpp"
 #include "tcframe/spec/variable/Matrix.hpp"
+#include "tcframe/spec/variable/OutputWriter.hpp"
 #include "tcframe/spec/variable/Scalar.hpp"
+#include "tcframe/spec/variable/TokenContext.hpp"
 #include "tcframe/spec/variable/TokenFormatter.hpp"
 #include "tcframe/spec/variable/Variable.hpp"
 #include "tcframe/spec/variable/Vector.hpp"
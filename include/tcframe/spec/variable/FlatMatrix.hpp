@@ -0,0 +1,90 @@
+#pragma once
+
+#include <type_traits>
+#include <vector>
+
+using std::is_same;
+using std::vector;
+
+namespace tcframe {
+
+template<typename T>
+class FlatMatrixImpl;
+
+// A matrix whose elements are stored contiguously in row-major order. It can be used in place of
+// vector<vector<T>> for large grids. Rows may have different lengths, for jagged vectors in lines segments.
+template<typename T>
+class FlatMatrix {
+    static_assert(!is_same<T, bool>::value, "FlatMatrix<bool> is not supported; use FlatMatrix<char> instead");
+
+    friend class FlatMatrixImpl<T>;
+
+private:
+    vector<T> values_;
+    vector<size_t> rowBegins_;
+
+public:
+    FlatMatrix()
+            : rowBegins_(1, 0) {}
+
+    FlatMatrix(int rows, int columns, const T& value = T())
+            : FlatMatrix() {
+        assign(rows, columns, value);
+    }
+
+    int rows() const {
+        return (int) rowBegins_.size() - 1;
+    }
+
+    int columns(int rowIndex) const {
+        return (int) (rowBegins_[rowIndex + 1] - rowBegins_[rowIndex]);
+    }
+
+    bool empty() const {
+        return rows() == 0;
+    }
+
+    T* operator[](int rowIndex) {
+        return values_.data() + rowBegins_[rowIndex];
+    }
+
+    const T* operator[](int rowIndex) const {
+        return values_.data() + rowBegins_[rowIndex];
+    }
+
+    T* data() {
+        return values_.data();
+    }
+
+    const T* data() const {
+        return values_.data();
+    }
+
+    void assign(int rows, int columns, const T& value = T()) {
+        values_.assign((size_t) rows * columns, value);
+        rowBegins_.resize(rows + 1);
+        for (int r = 0; r <= rows; r++) {
+            rowBegins_[r] = (size_t) r * columns;
+        }
+    }
+
+    void addRow(const vector<T>& row) {
+        values_.insert(values_.end(), row.begin(), row.end());
+        rowBegins_.push_back(values_.size());
+    }
+
+    void clear() {
+        values_.clear();
+        rowBegins_.assign(1, 0);
+    }
+
+    bool operator==(const FlatMatrix& o) const {
+        return values_ == o.values_ && rowBegins_ == o.rowBegins_;
+    }
+
+    bool operator!=(const FlatMatrix& o) const {
+        return !(*this == o);
+    }
+};
+
+}
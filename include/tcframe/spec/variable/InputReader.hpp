@@ -0,0 +1,294 @@
+#pragma once
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <istream>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+using std::char_traits;
+using std::enable_if;
+using std::is_floating_point;
+using std::is_integral;
+using std::is_same;
+using std::is_signed;
+using std::isinf;
+using std::istream;
+using std::memcpy;
+using std::move;
+using std::numeric_limits;
+using std::ostringstream;
+using std::string;
+using std::strtod;
+using std::strtof;
+using std::strtold;
+
+namespace tcframe {
+
+// Reads tokens from a contiguous in-memory buffer, as a faster replacement of istream extraction.
+class InputReader {
+private:
+    static const size_t MAX_REAL_LENGTH = 64;
+
+    string buffer_;
+    const char* begin_;
+    const char* end_;
+    const char* cursor_;
+
+public:
+    explicit InputReader(string buffer)
+            : buffer_(move(buffer)) {
+        reset();
+    }
+
+    explicit InputReader(istream* in) {
+        ostringstream out;
+        if (in->peek() != char_traits<char>::eof()) {
+            out << in->rdbuf();
+        }
+        buffer_ = out.str();
+        reset();
+    }
+
+    InputReader(const InputReader&) = delete;
+    InputReader& operator=(const InputReader&) = delete;
+
+    int peek() const {
+        if (cursor_ == end_) {
+            return char_traits<char>::eof();
+        }
+        return (unsigned char) *cursor_;
+    }
+
+    int get() {
+        if (cursor_ == end_) {
+            return char_traits<char>::eof();
+        }
+        return (unsigned char) *cursor_++;
+    }
+
+    // Caps a number of elements about to be read at the number of characters left, since each element takes at
+    // least one character. Used to reserve storage for sizes that come from the input itself.
+    int capToRemaining(int count) const {
+        return count > 0 && (size_t) count > remaining() ? (int) remaining() : count;
+    }
+
+    size_t remaining() const {
+        return (size_t) (end_ - cursor_);
+    }
+
+    size_t position() const {
+        return (size_t) (cursor_ - begin_);
+    }
+
+    void seek(size_t position) {
+        cursor_ = begin_ + position;
+    }
+
+    // Parses a value the way istream's operator>> would, assuming no leading whitespace.
+    // Returns false if the value cannot be parsed; the position is then left unchanged.
+    template<typename T>
+    bool read(T& var) {
+        return readValue(var);
+    }
+
+    // Reads at most maxLength non-whitespace characters.
+    string readToken(size_t maxLength) {
+        const char* tokenBegin = cursor_;
+        while (cursor_ < end_ && (size_t) (cursor_ - tokenBegin) < maxLength && !isWhitespace(*cursor_)) {
+            cursor_++;
+        }
+        return string(tokenBegin, cursor_);
+    }
+
+    // Copies at most count non-whitespace characters into dest as one block. Returns the number copied.
+    size_t readCharacters(char* dest, size_t count) {
+        const char* blockBegin = cursor_;
+        const char* blockEnd = (size_t) (end_ - cursor_) < count ? end_ : cursor_ + count;
+        while (cursor_ < blockEnd && !isWhitespace(*cursor_)) {
+            cursor_++;
+        }
+        size_t length = (size_t) (cursor_ - blockBegin);
+        memcpy(dest, blockBegin, length);
+        return length;
+    }
+
+    // Reads until the next newline, without consuming the newline itself.
+    void readLine(string& var) {
+        const char* lineBegin = cursor_;
+        while (cursor_ < end_ && *cursor_ != '\n') {
+            cursor_++;
+        }
+        var.assign(lineBegin, cursor_);
+    }
+
+private:
+    void reset() {
+        begin_ = buffer_.data();
+        end_ = begin_ + buffer_.size();
+        cursor_ = begin_;
+    }
+
+    bool readValue(string& var) {
+        const char* tokenBegin = cursor_;
+        while (cursor_ < end_ && !isWhitespace(*cursor_)) {
+            cursor_++;
+        }
+        var.assign(tokenBegin, cursor_);
+        return cursor_ > tokenBegin;
+    }
+
+    bool readValue(char& var) {
+        return readCharacter(var);
+    }
+
+    bool readValue(signed char& var) {
+        return readCharacter(var);
+    }
+
+    bool readValue(unsigned char& var) {
+        return readCharacter(var);
+    }
+
+    bool readValue(bool& var) {
+        const char* tokenBegin = cursor_;
+        long long value;
+        if (!readValue(value) || (value != 0 && value != 1)) {
+            cursor_ = tokenBegin;
+            return false;
+        }
+        var = value == 1;
+        return true;
+    }
+
+    template<typename T>
+    typename enable_if<is_integral<T>::value, bool>::type readValue(T& var) {
+        typedef unsigned long long UnsignedType;
+
+        const char* p = cursor_;
+        bool negative = false;
+        if (p < end_ && (*p == '-' || *p == '+')) {
+            negative = *p == '-';
+            p++;
+        }
+        if (p == end_ || !isDigit(*p)) {
+            return false;
+        }
+
+        UnsignedType limit;
+        if (!negative) {
+            limit = (UnsignedType) numeric_limits<T>::max();
+        } else if (is_signed<T>::value) {
+            limit = (UnsignedType) numeric_limits<T>::max() + 1;
+        } else {
+            limit = 0;
+        }
+
+        UnsignedType value = 0;
+        while (p < end_ && isDigit(*p)) {
+            UnsignedType digit = (UnsignedType) (*p - '0');
+            if (digit > limit || value > (limit - digit) / 10) {
+                return false;
+            }
+            value = value * 10 + digit;
+            p++;
+        }
+
+        var = negative ? (T) (0 - value) : (T) value;
+        cursor_ = p;
+        return true;
+    }
+
+    template<typename T>
+    typename enable_if<is_floating_point<T>::value, bool>::type readValue(T& var) {
+        const char* p = cursor_;
+        if (p < end_ && (*p == '-' || *p == '+')) {
+            p++;
+        }
+        const char* integerBegin = p;
+        p = skipDigits(p);
+        bool hasDigits = p > integerBegin;
+        if (p < end_ && *p == '.') {
+            const char* fractionBegin = ++p;
+            p = skipDigits(p);
+            hasDigits = hasDigits || p > fractionBegin;
+        }
+        if (!hasDigits) {
+            return false;
+        }
+        if (p < end_ && (*p == 'e' || *p == 'E')) {
+            p++;
+            if (p < end_ && (*p == '-' || *p == '+')) {
+                p++;
+            }
+            if (p == end_ || !isDigit(*p)) {
+                return false;
+            }
+            p = skipDigits(p);
+        }
+
+        // The scanned number is copied since the buffer is not terminated right after it.
+        size_t length = (size_t) (p - cursor_);
+        T value;
+        if (length < MAX_REAL_LENGTH) {
+            char number[MAX_REAL_LENGTH];
+            memcpy(number, cursor_, length);
+            number[length] = '\0';
+            value = toReal<T>(number);
+        } else {
+            value = toReal<T>(string(cursor_, p).c_str());
+        }
+        if (isinf(value)) {
+            return false;
+        }
+
+        var = value;
+        cursor_ = p;
+        return true;
+    }
+
+    template<typename T>
+    bool readCharacter(T& var) {
+        if (cursor_ == end_) {
+            return false;
+        }
+        var = (T) *cursor_++;
+        return true;
+    }
+
+    const char* skipDigits(const char* p) const {
+        while (p < end_ && isDigit(*p)) {
+            p++;
+        }
+        return p;
+    }
+
+    template<typename T>
+    static typename enable_if<is_same<T, float>::value, T>::type toReal(const char* number) {
+        return strtof(number, nullptr);
+    }
+
+    template<typename T>
+    static typename enable_if<is_same<T, double>::value, T>::type toReal(const char* number) {
+        return strtod(number, nullptr);
+    }
+
+    template<typename T>
+    static typename enable_if<is_same<T, long double>::value, T>::type toReal(const char* number) {
+        return strtold(number, nullptr);
+    }
+
+    static bool isDigit(char c) {
+        return c >= '0' && c <= '9';
+    }
+
+    static bool isWhitespace(char c) {
+        return c == ' ' || c == '\n' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+    }
+};
+
+}
@@ -1,18 +1,25 @@
 #pragma once
 
+#include <algorithm>
 #include <exception>
 #include <iostream>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
-#include "TokenFormatter.hpp"
+#include "FlatMatrix.hpp"
+#include "InputReader.hpp"
+#include "OutputWriter.hpp"
+#include "TokenContext.hpp"
 #include "Variable.hpp"
 #include "WhitespaceManipulator.hpp"
 
-using std::endl;
+using std::false_type;
 using std::iostream;
 using std::is_same;
-using std::ostream;
+using std::min;
+using std::move;
+using std::true_type;
 using std::vector;
 
 namespace tcframe {
@@ -27,13 +34,28 @@ public:
     virtual int rows() const = 0;
     virtual int columns(int rowIndex) const = 0;
     virtual void clear() = 0;
-    virtual void printTo(ostream* out) = 0;
-    virtual void printRowTo(int rowIndex, ostream* out) = 0;
-    virtual void parseFrom(istream* in, int rows, int columns) = 0;
-    virtual void parseAndAddRowFrom(istream* in, int rowIndex) = 0;
+    virtual void reserve(int rows) = 0;
+    virtual void printTo(OutputWriter* out) = 0;
+    virtual void printRowTo(int rowIndex, OutputWriter* out) = 0;
+    virtual void parseFrom(InputReader* in, int rows, int columns) = 0;
+    virtual void parseAndAddRowFrom(InputReader* in, int rowIndex) = 0;
 
     template<typename T, typename = ScalarCompatible<T>>
     static Matrix* create(vector<vector<T>>& var, string name);
+
+    template<typename T, typename = ScalarCompatible<T>>
+    static Matrix* create(FlatMatrix<T>& var, string name);
+
+protected:
+    // Reads a whole row of characters as one block. If the row is short, fails on its first missing element
+    // the same way as parsing it element by element would.
+    void parseCharactersFrom(InputReader* in, char* row, int columns, int rowIndex) {
+        size_t length = in->readCharacters(row, (size_t) columns);
+        if (length < (size_t) columns) {
+            char element;
+            Variable::parseValue(in, element, TokenContext::matrixElement(name(), rowIndex, (int) length));
+        }
+    }
 };
 
 template<typename T, typename = ScalarCompatible<T>>
@@ -62,52 +84,174 @@ public:
         var_->clear();
     }
 
-    void printTo(ostream* out) {
+    void reserve(int rows) {
+        if (rows > 0) {
+            var_->reserve(var_->size() + rows);
+        }
+    }
+
+    void printTo(OutputWriter* out) {
         for (int row = 0; row < var_->size(); row++) {
             printRowTo(row, out);
-            *out << endl;
+            out->write('\n');
         }
     }
 
-    void printRowTo(int rowIndex, ostream* out) {
-        for (int c = 0; c < (*var_)[rowIndex].size(); c++) {
-            if (c > 0 && hasSpaces_) {
-                *out << ' ';
-            }
-            *out << (*var_)[rowIndex][c];
-        }
+    void printRowTo(int rowIndex, OutputWriter* out) {
+        out->writeRow((*var_)[rowIndex], hasSpaces_);
     }
 
-    void parseFrom(istream* in, int rows, int columns) {
+    void parseFrom(InputReader* in, int rows, int columns) {
+        reserve(in->capToRemaining(rows));
         for (int r = 0; r < rows; r++) {
             vector<T> row;
-            for (int c = 0; c < columns; c++) {
-                if (c > 0 && hasSpaces_) {
-                    WhitespaceManipulator::parseSpace(in, TokenFormatter::formatMatrixElement(name(), r, c - 1));
-                }
-                T element;
-                Variable::parseValue(in, element, TokenFormatter::formatMatrixElement(name(), r, c));
-                row.push_back(element);
-            }
-            var_->push_back(row);
-            WhitespaceManipulator::parseNewline(in, TokenFormatter::formatMatrixElement(name(), r, columns - 1));
+            parseRowFrom(in, row, r, columns, is_same<T, char>());
+            var_->push_back(move(row));
+            WhitespaceManipulator::parseNewline(in, TokenContext::matrixElement(name(), r, columns - 1));
         }
     }
 
-    virtual void parseAndAddRowFrom(istream* in, int rowIndex) {
+    virtual void parseAndAddRowFrom(InputReader* in, int rowIndex) {
         vector<T> row;
         int c;
         for (c = 0; !WhitespaceManipulator::canParseNewline(in); c++) {
             if (c > 0 && hasSpaces_) {
                 WhitespaceManipulator::parseSpaceAfterMissingNewline(
                         in,
-                        TokenFormatter::formatMatrixElement(name(), rowIndex, c - 1));
+                        TokenContext::matrixElement(name(), rowIndex, c - 1));
+            }
+            T element;
+            Variable::parseValue(in, element, TokenContext::matrixElement(name(), rowIndex, c));
+            row.push_back(move(element));
+        }
+        var_->push_back(move(row));
+    }
+
+private:
+    void parseRowFrom(InputReader* in, vector<T>& row, int rowIndex, int columns, false_type) {
+        row.reserve(in->capToRemaining(columns));
+        for (int c = 0; c < columns; c++) {
+            if (c > 0 && hasSpaces_) {
+                WhitespaceManipulator::parseSpace(in, TokenContext::matrixElement(name(), rowIndex, c - 1));
             }
             T element;
-            Variable::parseValue(in, element, TokenFormatter::formatMatrixElement(name(), rowIndex, c));
-            row.push_back(element);
+            Variable::parseValue(in, element, TokenContext::matrixElement(name(), rowIndex, c));
+            row.push_back(move(element));
         }
-        var_->push_back(row);
+    }
+
+    // The row only needs room for the characters left, as a longer row fails to be parsed anyway.
+    void parseRowFrom(InputReader* in, vector<char>& row, int rowIndex, int columns, true_type) {
+        row.resize(in->capToRemaining(columns));
+        parseCharactersFrom(in, row.data(), columns, rowIndex);
+    }
+};
+
+template<typename T>
+class FlatMatrixImpl : public Matrix {
+private:
+    FlatMatrix<T>* var_;
+    bool hasSpaces_;
+
+public:
+    virtual ~FlatMatrixImpl() = default;
+
+    FlatMatrixImpl(FlatMatrix<T>& var, string name)
+            : Matrix(name)
+            , var_(&var)
+            , hasSpaces_(!is_same<T, char>::value) {}
+
+    int rows() const {
+        return var_->rows();
+    }
+
+    int columns(int rowIndex) const {
+        return var_->columns(rowIndex);
+    }
+
+    void clear() {
+        var_->clear();
+    }
+
+    void reserve(int rows) {
+        if (rows > 0) {
+            var_->rowBegins_.reserve(var_->rowBegins_.size() + rows);
+        }
+    }
+
+    void printTo(OutputWriter* out) {
+        for (int row = 0; row < var_->rows(); row++) {
+            printRowTo(row, out);
+            out->write('\n');
+        }
+    }
+
+    void printRowTo(int rowIndex, OutputWriter* out) {
+        out->writeRow((*var_)[rowIndex], (size_t) var_->columns(rowIndex), hasSpaces_);
+    }
+
+    void parseFrom(InputReader* in, int rows, int columns) {
+        size_t valuesSize = var_->values_.size();
+        size_t rowBeginsSize = var_->rowBegins_.size();
+        try {
+            reserve(in->capToRemaining(rows));
+            if (rows > 0 && columns > 0) {
+                var_->values_.reserve(valuesSize + min((size_t) rows * columns, in->remaining()));
+            }
+            for (int r = 0; r < rows; r++) {
+                parseRowFrom(in, r, columns, is_same<T, char>());
+                var_->rowBegins_.push_back(var_->values_.size());
+                WhitespaceManipulator::parseNewline(in, TokenContext::matrixElement(name(), r, columns - 1));
+            }
+        } catch (...) {
+            rollBack(valuesSize, rowBeginsSize);
+            throw;
+        }
+    }
+
+    virtual void parseAndAddRowFrom(InputReader* in, int rowIndex) {
+        size_t valuesSize = var_->values_.size();
+        try {
+            for (int c = 0; !WhitespaceManipulator::canParseNewline(in); c++) {
+                if (c > 0 && hasSpaces_) {
+                    WhitespaceManipulator::parseSpaceAfterMissingNewline(
+                            in,
+                            TokenContext::matrixElement(name(), rowIndex, c - 1));
+                }
+                T element;
+                Variable::parseValue(in, element, TokenContext::matrixElement(name(), rowIndex, c));
+                var_->values_.push_back(move(element));
+            }
+        } catch (...) {
+            rollBack(valuesSize, var_->rowBegins_.size());
+            throw;
+        }
+        var_->rowBegins_.push_back(var_->values_.size());
+    }
+
+private:
+    // Restores the matrix to its size before a failed parse.
+    void rollBack(size_t valuesSize, size_t rowBeginsSize) {
+        var_->values_.resize(valuesSize);
+        var_->rowBegins_.resize(rowBeginsSize);
+    }
+
+    void parseRowFrom(InputReader* in, int rowIndex, int columns, false_type) {
+        for (int c = 0; c < columns; c++) {
+            if (c > 0 && hasSpaces_) {
+                WhitespaceManipulator::parseSpace(in, TokenContext::matrixElement(name(), rowIndex, c - 1));
+            }
+            T element;
+            Variable::parseValue(in, element, TokenContext::matrixElement(name(), rowIndex, c));
+            var_->values_.push_back(move(element));
+        }
+    }
+
+    void parseRowFrom(InputReader* in, int rowIndex, int columns, true_type) {
+        vector<T>& values = var_->values_;
+        size_t rowBegin = values.size();
+        values.resize(rowBegin + in->capToRemaining(columns));
+        parseCharactersFrom(in, values.data() + rowBegin, columns, rowIndex);
     }
 };
 
@@ -116,4 +260,9 @@ Matrix* Matrix::create(vector<vector<T>>& var, string name) {
     return new MatrixImpl<T>(var, name);
 }
 
+template<typename T, typename>
+Matrix* Matrix::create(FlatMatrix<T>& var, string name) {
+    return new FlatMatrixImpl<T>(var, name);
+}
+
 }
@@ -0,0 +1,182 @@
+#pragma once
+
+#include <cstdio>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+using std::enable_if;
+using std::is_floating_point;
+using std::is_integral;
+using std::is_signed;
+using std::ostream;
+using std::snprintf;
+using std::string;
+using std::vector;
+
+namespace tcframe {
+
+// Buffers formatted values and writes them to the underlying stream in large blocks, as a faster replacement
+// of ostream insertion. Without an underlying stream, everything written is kept and available via str().
+class OutputWriter {
+private:
+    static const size_t BUFFER_SIZE = 1 << 16;
+    static const size_t MAX_NUMBER_LENGTH = 64;
+
+    ostream* out_;
+    string buffer_;
+
+public:
+    OutputWriter()
+            : out_(nullptr) {}
+
+    explicit OutputWriter(ostream* out)
+            : out_(out) {
+        buffer_.reserve(BUFFER_SIZE);
+    }
+
+    OutputWriter(const OutputWriter&) = delete;
+    OutputWriter& operator=(const OutputWriter&) = delete;
+
+    ~OutputWriter() {
+        flush();
+    }
+
+    // Formats a value the way ostream's operator<< would with the default flags.
+    template<typename T>
+    void write(const T& value) {
+        writeValue(value);
+        flushIfFull();
+    }
+
+    template<typename T>
+    void writeRow(const vector<T>& row, bool withSpaces) {
+        for (size_t i = 0; i < row.size(); i++) {
+            if (i > 0 && withSpaces) {
+                buffer_ += ' ';
+            }
+            writeValue(row[i]);
+        }
+        flushIfFull();
+    }
+
+    void writeRow(const vector<char>& row, bool withSpaces) {
+        writeRow(row.data(), row.size(), withSpaces);
+    }
+
+    template<typename T>
+    void writeRow(const T* row, size_t size, bool withSpaces) {
+        for (size_t i = 0; i < size; i++) {
+            if (i > 0 && withSpaces) {
+                buffer_ += ' ';
+            }
+            writeValue(row[i]);
+        }
+        flushIfFull();
+    }
+
+    void writeRow(const char* row, size_t size, bool withSpaces) {
+        if (withSpaces) {
+            writeRow<char>(row, size, true);
+        } else {
+            buffer_.append(row, size);
+            flushIfFull();
+        }
+    }
+
+    void flush() {
+        if (out_ != nullptr && !buffer_.empty()) {
+            out_->write(buffer_.data(), buffer_.size());
+            out_->flush();
+            buffer_.clear();
+        }
+    }
+
+    string str() const {
+        return buffer_;
+    }
+
+private:
+    void flushIfFull() {
+        if (out_ != nullptr && buffer_.size() >= BUFFER_SIZE) {
+            out_->write(buffer_.data(), buffer_.size());
+            buffer_.clear();
+        }
+    }
+
+    void writeValue(const string& value) {
+        buffer_ += value;
+    }
+
+    void writeValue(const char* value) {
+        buffer_ += value;
+    }
+
+    void writeValue(char value) {
+        buffer_ += value;
+    }
+
+    void writeValue(signed char value) {
+        buffer_ += (char) value;
+    }
+
+    void writeValue(unsigned char value) {
+        buffer_ += (char) value;
+    }
+
+    void writeValue(bool value) {
+        buffer_ += value ? '1' : '0';
+    }
+
+    template<typename T>
+    typename enable_if<is_integral<T>::value>::type writeValue(T value) {
+        static const char DIGIT_PAIRS[] =
+                "00010203040506070809"
+                "10111213141516171819"
+                "20212223242526272829"
+                "30313233343536373839"
+                "40414243444546474849"
+                "50515253545556575859"
+                "60616263646566676869"
+                "70717273747576777879"
+                "80818283848586878889"
+                "90919293949596979899";
+
+        unsigned long long magnitude = (unsigned long long) value;
+        bool negative = is_signed<T>::value && value < 0;
+        if (negative) {
+            magnitude = 0 - magnitude;
+        }
+
+        char digits[MAX_NUMBER_LENGTH];
+        char* end = digits + MAX_NUMBER_LENGTH;
+        char* begin = end;
+        while (magnitude >= 100) {
+            size_t pair = (size_t) (magnitude % 100) * 2;
+            magnitude /= 100;
+            *--begin = DIGIT_PAIRS[pair + 1];
+            *--begin = DIGIT_PAIRS[pair];
+        }
+        if (magnitude >= 10) {
+            size_t pair = (size_t) magnitude * 2;
+            *--begin = DIGIT_PAIRS[pair + 1];
+            *--begin = DIGIT_PAIRS[pair];
+        } else {
+            *--begin = (char) ('0' + magnitude);
+        }
+        if (negative) {
+            *--begin = '-';
+        }
+        buffer_.append(begin, end);
+    }
+
+    template<typename T>
+    typename enable_if<is_floating_point<T>::value>::type writeValue(T value) {
+        char number[MAX_NUMBER_LENGTH];
+        int length = snprintf(number, MAX_NUMBER_LENGTH, "%Lg", (long double) value);
+        buffer_.append(number, (size_t) length);
+    }
+};
+
+}
@@ -4,12 +4,12 @@
 #include <iostream>
 #include <string>
 
-#include "TokenFormatter.hpp"
+#include "InputReader.hpp"
+#include "OutputWriter.hpp"
+#include "TokenContext.hpp"
 #include "Variable.hpp"
 #include "WhitespaceManipulator.hpp"
 
-using std::istream;
-using std::ostream;
 using std::string;
 
 namespace tcframe {
@@ -21,8 +21,8 @@ public:
     explicit Scalar(string name)
             : Variable(name, VariableType::SCALAR) {}
 
-    virtual void printTo(ostream* out) = 0;
-    virtual void parseFrom(istream* in) = 0;
+    virtual void printTo(OutputWriter* out) = 0;
+    virtual void parseFrom(InputReader* in) = 0;
 
     template<typename T, typename = ScalarCompatible<T>>
     static Scalar* create(T& var, string name);
@@ -43,12 +43,12 @@ public:
             : Scalar(name)
             , var_(&var) {}
 
-    void printTo(ostream* out) {
-        *out << *var_;
+    void printTo(OutputWriter* out) {
+        out->write(*var_);
     }
 
-    void parseFrom(istream* in) {
-        Variable::parseValue(in, *var_, TokenFormatter::formatVariable(name()));
+    void parseFrom(InputReader* in) {
+        Variable::parseValue(in, *var_, TokenContext::variable(name()));
     }
 };
 
@@ -63,7 +63,7 @@ public:
             : ScalarImpl(var, name)
             , var_(&var) {}
 
-    void parseFrom(istream* in) {
+    void parseFrom(InputReader* in) {
         Variable::parseRawLine(in, *var_);
     }
 };
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <string>
+
+#include "TokenFormatter.hpp"
+
+using std::string;
+
+namespace tcframe {
+
+// Describes the token being parsed, for error messages. It is cheap to create and only formatted on
+// failure. The referenced strings must outlive the context, so it cannot be created from temporary strings.
+class TokenContext {
+private:
+    enum class Kind {
+        NONE,
+        TEXT,
+        VARIABLE,
+        VECTOR_ELEMENT,
+        MATRIX_ELEMENT
+    };
+
+    Kind kind_;
+    const char* text_;
+    const string* name_;
+    int rowIndex_;
+    int colIndex_;
+
+    TokenContext(Kind kind, const string* name, int rowIndex, int colIndex)
+            : kind_(kind)
+            , text_(nullptr)
+            , name_(name)
+            , rowIndex_(rowIndex)
+            , colIndex_(colIndex) {}
+
+public:
+    TokenContext()
+            : TokenContext(Kind::NONE, nullptr, 0, 0) {}
+
+    explicit TokenContext(const char* text)
+            : TokenContext(Kind::TEXT, nullptr, 0, 0) {
+        text_ = text;
+    }
+
+    static TokenContext variable(const string& name) {
+        return {Kind::VARIABLE, &name, 0, 0};
+    }
+
+    static TokenContext vectorElement(const string& name, int index) {
+        return {Kind::VECTOR_ELEMENT, &name, index, 0};
+    }
+
+    static TokenContext matrixElement(const string& name, int rowIndex, int colIndex) {
+        return {Kind::MATRIX_ELEMENT, &name, rowIndex, colIndex};
+    }
+
+    static TokenContext variable(string&&) = delete;
+    static TokenContext vectorElement(string&&, int) = delete;
+    static TokenContext matrixElement(string&&, int, int) = delete;
+
+    bool empty() const {
+        return kind_ == Kind::NONE;
+    }
+
+    string format() const {
+        switch (kind_) {
+            case Kind::TEXT:
+                return text_;
+            case Kind::VARIABLE:
+                return TokenFormatter::formatVariable(*name_);
+            case Kind::VECTOR_ELEMENT:
+                return TokenFormatter::formatVectorElement(*name_, rowIndex_);
+            case Kind::MATRIX_ELEMENT:
+                return TokenFormatter::formatMatrixElement(*name_, rowIndex_, colIndex_);
+            default:
+                return "";
+        }
+    }
+};
+
+}
@@ -7,6 +7,8 @@
 #include <type_traits>
 #include <utility>
 
+#include "InputReader.hpp"
+#include "TokenContext.hpp"
 #include "WhitespaceManipulator.hpp"
 
 using std::char_traits;
@@ -14,7 +16,6 @@ using std::enable_if;
 using std::is_arithmetic;
 using std::is_reference;
 using std::is_same;
-using std::istream;
 using std::move;
 using std::ostream;
 using std::runtime_error;
@@ -57,30 +58,19 @@ public:
 
     /* Visible for testing */
     template<typename T>
-    static void parseValue(istream* in, T& var, const string& context) {
+    static void parseValue(InputReader* in, T& var, const TokenContext& context) {
         WhitespaceManipulator::ensureNoEof(in, context);
         WhitespaceManipulator::ensureNoWhitespace(in, context);
 
-        long long currentPos = in->tellg();
-        *in >> var;
-
-        if (in->fail()) {
-            in->clear();
-            in->seekg(currentPos);
-            in->width(20);
-            string found;
-            *in >> found;
-
-            throw runtime_error("Cannot parse for " + context + ". Found: '" + found + "'");
+        if (!in->read(var)) {
+            string found = in->readToken(20);
+            throw runtime_error("Cannot parse for " + context.format() + ". Found: '" + found + "'");
         }
     }
 
     /* Visible for testing */
-    static void parseRawLine(istream* in, string& var) {
-        getline(*in, var);
-        if (!in->eof()) {
-            in->unget();
-        }
+    static void parseRawLine(InputReader* in, string& var) {
+        in->readLine(var);
     }
 
 protected:
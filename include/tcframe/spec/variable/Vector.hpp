@@ -2,14 +2,17 @@
 
 #include <exception>
 #include <iostream>
+#include <utility>
 #include <vector>
 
-#include "TokenFormatter.hpp"
+#include "InputReader.hpp"
+#include "OutputWriter.hpp"
+#include "TokenContext.hpp"
 #include "Variable.hpp"
 #include "WhitespaceManipulator.hpp"
 
 using std::iostream;
-using std::ostream;
+using std::move;
 using std::vector;
 
 namespace tcframe {
@@ -23,11 +26,12 @@ public:
 
     virtual int size() const = 0;
     virtual void clear() = 0;
-    virtual void printTo(ostream* out) = 0;
-    virtual void printElementTo(int index, ostream* out) = 0;
-    virtual void parseFrom(istream* in) = 0;
-    virtual void parseFrom(istream* in, int size) = 0;
-    virtual void parseAndAddElementFrom(istream* in) = 0;
+    virtual void reserve(int size) = 0;
+    virtual void printTo(OutputWriter* out) = 0;
+    virtual void printElementTo(int index, OutputWriter* out) = 0;
+    virtual void parseFrom(InputReader* in) = 0;
+    virtual void parseFrom(InputReader* in, int size) = 0;
+    virtual void parseAndAddElementFrom(InputReader* in) = 0;
 
     template<typename T, typename = ScalarCompatible<T>>
     static Vector* create(vector<T>& var, string name);
@@ -56,46 +60,46 @@ public:
         var_->clear();
     }
 
-    void printTo(ostream* out) {
-        bool first = true;
-        for (T& element : *var_) {
-            if (!first) {
-                *out << ' ';
-            }
-            first = false;
-            *out << element;
+    void reserve(int size) {
+        if (size > 0) {
+            var_->reserve(var_->size() + size);
         }
     }
 
-    void printElementTo(int index, ostream* out) {
-        *out << (*var_)[index];
+    void printTo(OutputWriter* out) {
+        out->writeRow(*var_, true);
+    }
+
+    void printElementTo(int index, OutputWriter* out) {
+        out->write((*var_)[index]);
     }
 
-    void parseFrom(istream* in) {
+    void parseFrom(InputReader* in) {
         for (int i = 0; !WhitespaceManipulator::canParseNewline(in); i++) {
             if (i > 0) {
                 WhitespaceManipulator::parseSpaceAfterMissingNewline(
                         in,
-                        TokenFormatter::formatVectorElement(name(), i - 1));
+                        TokenContext::vectorElement(name(), i - 1));
             }
             parseAndAddElementFrom(in);
         }
     }
 
-    void parseFrom(istream* in, int size) {
+    void parseFrom(InputReader* in, int size) {
+        reserve(in->capToRemaining(size));
         for (int i = 0; i < size; i++) {
             if (i > 0) {
-                WhitespaceManipulator::parseSpace(in, TokenFormatter::formatVectorElement(name(), i - 1));
+                WhitespaceManipulator::parseSpace(in, TokenContext::vectorElement(name(), i - 1));
             }
             parseAndAddElementFrom(in);
         }
     }
 
-    void parseAndAddElementFrom(istream* in) {
+    void parseAndAddElementFrom(InputReader* in) {
         int index = size();
         T element;
-        Variable::parseValue(in, element, TokenFormatter::formatVectorElement(name(), index));
-        var_->push_back(element);
+        Variable::parseValue(in, element, TokenContext::vectorElement(name(), index));
+        var_->push_back(move(element));
     }
 };
 
@@ -110,11 +114,11 @@ public:
             : VectorImpl(var, name)
             , var_(&var) {}
 
-    void parseAndAddElementFrom(istream* in) {
+    void parseAndAddElementFrom(InputReader* in) {
         int index = size();
         string element;
         Variable::parseRawLine(in, element);
-        var_->push_back(element);
+        var_->push_back(move(element));
     }
 };
 
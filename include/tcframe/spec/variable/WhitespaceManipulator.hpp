@@ -6,9 +6,10 @@
 #include <string>
 #include <type_traits>
 
+#include "InputReader.hpp"
+#include "TokenContext.hpp"
+
 using std::char_traits;
-using std::istream;
-using std::ostream;
 using std::runtime_error;
 using std::string;
 
@@ -18,53 +19,53 @@ class WhitespaceManipulator {
 public:
     WhitespaceManipulator() = delete;
 
-    static void parseSpace(istream* in, const string& context) {
+    static void parseSpace(InputReader* in, const TokenContext& context) {
         if (in->get() != ' ') {
-            throw runtime_error("Expected: <space> after " + context);
+            throw runtime_error("Expected: <space> after " + context.format());
         }
     }
 
-    static void parseSpaceAfterMissingNewline(istream* in, const string& context) {
+    static void parseSpaceAfterMissingNewline(InputReader* in, const TokenContext& context) {
         if (in->get() != ' ') {
-            throw runtime_error("Expected: <space> or <newline> after " + context);
+            throw runtime_error("Expected: <space> or <newline> after " + context.format());
         }
     }
 
-    static bool canParseNewline(istream* in) {
+    static bool canParseNewline(InputReader* in) {
         return in->peek() == '\n';
     }
 
-    static void parseNewline(istream* in, const string& context) {
+    static void parseNewline(InputReader* in, const TokenContext& context) {
         if (in->get() != '\n') {
-            throw runtime_error("Expected: <newline> after " + context);
+            throw runtime_error("Expected: <newline> after " + context.format());
         }
     }
 
-    static bool isEof(istream* in) {
+    static bool isEof(InputReader* in) {
         return in->peek() == char_traits<char>::eof();
     }
 
-    static void ensureEof(istream* in) {
+    static void ensureEof(InputReader* in) {
         if (in->peek() != char_traits<char>::eof()) {
             throw runtime_error("Expected: <EOF>");
         }
     }
 
-    static void ensureEof(istream* in, const string& context) {
+    static void ensureEof(InputReader* in, const TokenContext& context) {
         if (in->peek() != char_traits<char>::eof()) {
-            throw runtime_error("Expected: <EOF> after " + context);
+            throw runtime_error("Expected: <EOF> after " + context.format());
         }
     }
 
-    static void ensureNoEof(istream* in, const string& context) {
+    static void ensureNoEof(InputReader* in, const TokenContext& context) {
         if (in->peek() == char_traits<char>::eof()) {
-            throw runtime_error("Cannot parse for " + context + ". Found: <EOF>");
+            throw runtime_error("Cannot parse for " + context.format() + ". Found: <EOF>");
         }
     }
 
-    static void ensureNoWhitespace(istream* in, const string& context) {
+    static void ensureNoWhitespace(InputReader* in, const TokenContext& context) {
         if (isspace(in->peek())) {
-            throw runtime_error("Cannot parse for " + context + ". Found: <whitespace>");
+            throw runtime_error("Cannot parse for " + context.format() + ". Found: <whitespace>");
         }
     }
 };
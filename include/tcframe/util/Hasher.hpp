@@ -0,0 +1,116 @@
+#pragma once
+
+#include <fstream>
+#include <istream>
+#include <sstream>
+#include <string>
+#include <sys/stat.h>
+#include <vector>
+
+using std::ifstream;
+using std::ios;
+using std::istream;
+using std::istringstream;
+using std::streamsize;
+using std::string;
+using std::to_string;
+using std::vector;
+
+namespace tcframe {
+
+// Computes the 128-bit FNV-1a hash of values and file contents. It is fast, and wide enough that different contents
+// practically never get the same hash, but it is not meant to resist contents crafted to collide.
+class Hasher {
+private:
+    // The prime is 2^88 + 0x13b, and the hash is kept in two 64-bit halves.
+    static constexpr unsigned long long OFFSET_BASIS_HIGH = 0x6c62272e07bb0142ULL;
+    static constexpr unsigned long long OFFSET_BASIS_LOW = 0x62b821756295c58dULL;
+    static constexpr unsigned long long PRIME_LOW = 0x13bULL;
+    static constexpr int PRIME_SHIFT = 88 - 64;
+    static constexpr size_t CHUNK_SIZE = 1 << 16;
+
+    unsigned long long high_;
+    unsigned long long low_;
+
+public:
+    Hasher()
+            : high_(OFFSET_BASIS_HIGH)
+            , low_(OFFSET_BASIS_LOW) {}
+
+    // The length of the value is hashed as well, so that a sequence of values cannot be confused with another one
+    // with the same concatenation.
+    Hasher& add(const string& value) {
+        string length = to_string(value.size()) + ":";
+        addBytes(length.data(), length.size());
+        addBytes(value.data(), value.size());
+        return *this;
+    }
+
+    Hasher& addStream(istream* in) {
+        vector<char> chunk(CHUNK_SIZE);
+        while (in->read(chunk.data(), (streamsize) chunk.size()) || in->gcount() > 0) {
+            addBytes(chunk.data(), (size_t) in->gcount());
+        }
+        return *this;
+    }
+
+    // Returns false if the file cannot be read.
+    bool addFile(const string& filename) {
+        ifstream in(filename, ios::binary);
+        if (!in) {
+            return false;
+        }
+        addStream(&in);
+        return true;
+    }
+
+    // Identifies a command by itself and the contents of every argument of it that names a file, such as
+    // ./solution or Solution.py.
+    Hasher& addCommand(const string& command) {
+        add(command);
+
+        istringstream in(command);
+        string argument;
+        while (in >> argument) {
+            struct stat info;
+            if (stat(argument.c_str(), &info) == 0 && S_ISREG(info.st_mode)) {
+                addFile(argument);
+            }
+        }
+        return *this;
+    }
+
+    string hex() const {
+        return toHex(high_) + toHex(low_);
+    }
+
+private:
+    void addBytes(const char* bytes, size_t size) {
+        for (size_t i = 0; i < size; i++) {
+            low_ ^= (unsigned char) bytes[i];
+            multiplyByPrime();
+        }
+    }
+
+    // Computes hash * 0x13b + (hash << 88), modulo 2^128.
+    void multiplyByPrime() {
+        unsigned long long lowLow = (low_ & 0xffffffffULL) * PRIME_LOW;
+        unsigned long long lowHigh = (low_ >> 32) * PRIME_LOW;
+        unsigned long long carry = (lowHigh >> 32) + (((lowLow >> 32) + (lowHigh & 0xffffffffULL)) >> 32);
+
+        high_ = high_ * PRIME_LOW + carry + (low_ << PRIME_SHIFT);
+        low_ = lowLow + (lowHigh << 32);
+    }
+
+    static string toHex(unsigned long long value) {
+        static const char DIGITS[] = "0123456789abcdef";
+        string hex(16, '0');
+        for (int i = 15; i >= 0; i--) {
+            hex[i] = DIGITS[value & 15];
+            value >>= 4;
+        }
+        return hex;
+    }
+};
+
+}
@@ -3,6 +3,7 @@
 #include "BaseEteTests.cpp"
 
 using ::testing::Eq;
+using ::testing::HasSubstr;
 using ::testing::Test;
 using ::testing::UnorderedElementsAre;
 
@@ -112,6 +113,43 @@ TEST_F(GenerationEteTests, Subtasks) {
     ));
 }
 
+TEST_F(GenerationEteTests, Subtasks_OutputCache) {
+    ASSERT_THAT(execStatus("cd test-ete/subtasks && ../scripts/generate.sh --output-cache=cache"), Eq(0));
+    string output = exec("cd test-ete/subtasks && "
+                         "./runner --solution=./solution --output-cache=cache --jobs=2 --seed-per-test-case");
+
+    EXPECT_THAT(output, HasSubstr("Solution output cache: 5 hit(s), 0 miss(es)."));
+    EXPECT_THAT(ls("test-ete/subtasks/tc").size(), Eq(10u));
+    EXPECT_THAT(ls("test-ete/subtasks/cache").size(), Eq(5u));
+}
+
+TEST_F(GenerationEteTests, Subtasks_Incremental) {
+    ASSERT_THAT(execStatus("cd test-ete/subtasks && ../scripts/generate.sh --incremental --seed-per-test-case"), Eq(0));
+    string firstOutput = readFile("test-ete/subtasks/tc/subtasks_2_1.in");
+    string output = exec("cd test-ete/subtasks && ./runner --solution=./solution --incremental --seed-per-test-case");
+
+    EXPECT_THAT(output, HasSubstr("subtasks_2_1: OK (unchanged)"));
+    EXPECT_THAT(readFile("test-ete/subtasks/tc/subtasks_2_1.in"), Eq(firstOutput));
+    EXPECT_THAT(ls("test-ete/subtasks/tc").size(), Eq(10u));
+    EXPECT_THAT(readFile("test-ete/subtasks/tc/.generation_manifest"), HasSubstr("subtasks_2_1 "));
+}
+
+TEST_F(GenerationEteTests, Subtasks_Incremental_ChangedTestGroup) {
+    ASSERT_THAT(execStatus("rm -rf test-ete/changed_subtasks && "
+                           "cp -r test-ete/subtasks test-ete/changed_subtasks"), Eq(0));
+    ASSERT_THAT(execStatus("cd test-ete/changed_subtasks && "
+                           "../scripts/generate.sh --incremental --seed-per-test-case"), Eq(0));
+    ASSERT_THAT(execStatus("sed -i.bak 's/CASE(A = 20, B = 30)/CASE(A = 20, B = 31)/' "
+                           "test-ete/changed_subtasks/spec.cpp"), Eq(0));
+    string output = exec("cd test-ete/changed_subtasks && ../scripts/generate.sh --incremental --seed-per-test-case");
+
+    EXPECT_THAT(output, HasSubstr("subtasks_sample_1: OK (unchanged)"));
+    EXPECT_THAT(output, HasSubstr("subtasks_1_1: OK (unchanged)"));
+    EXPECT_THAT(output, HasSubstr("subtasks_1_2: OK (unchanged)"));
+    EXPECT_THAT(output, HasSubstr("subtasks_2_1: OK\n"));
+    EXPECT_THAT(readFile("test-ete/changed_subtasks/tc/subtasks_2_1.in"), Eq("20 31\n"));
+}
+
 TEST_F(GenerationEteTests, Multi) {
     ASSERT_THAT(execStatus("cd test-ete/multi && ../scripts/generate.sh"), Eq(0));
 
@@ -138,6 +176,54 @@ TEST_F(GenerationEteTests, Multi) {
             "6\n"));
 }
 
+TEST_F(GenerationEteTests, Multi_Jobs) {
+    ASSERT_THAT(execStatus("cd test-ete/multi && ../scripts/generate.sh --jobs=3 --seed-per-test-case"), Eq(0));
+
+    EXPECT_THAT(ls("test-ete/multi/tc"), UnorderedElementsAre(
+            "multi_sample.in",
+            "multi_sample.out",
+            "multi_1.in",
+            "multi_1.out",
+            "multi_2.in",
+            "multi_2.out"
+    ));
+
+    EXPECT_THAT(readFile("test-ete/multi/tc/multi_1.in"), Eq(
+            "2\n"
+            "1 3\n"
+            "2 4\n"));
+
+    EXPECT_THAT(readFile("test-ete/multi/tc/multi_sample.out"), Eq(
+            "6\n"
+            "11\n"));
+
+    EXPECT_THAT(readFile("test-ete/multi/tc/multi_1.out"), Eq(
+            "4\n"
+            "6\n"));
+}
+
+TEST_F(GenerationEteTests, Multi_Streaming) {
+    ASSERT_THAT(execStatus("cd test-ete/multi && ../scripts/generate.sh --stream"), Eq(0));
+
+    EXPECT_THAT(ls("test-ete/multi/tc"), UnorderedElementsAre(
+            "multi_sample.in",
+            "multi_sample.out",
+            "multi_1.in",
+            "multi_1.out",
+            "multi_2.in",
+            "multi_2.out"
+    ));
+
+    EXPECT_THAT(readFile("test-ete/multi/tc/multi_1.in"), Eq(
+            "2\n"
+            "1 3\n"
+            "2 4\n"));
+
+    EXPECT_THAT(readFile("test-ete/multi/tc/multi_1.out"), Eq(
+            "4\n"
+            "6\n"));
+}
+
 TEST_F(GenerationEteTests, Multi_NoOutput) {
     ASSERT_THAT(execStatus("cd test-ete/multi-no-output && ../scripts/generate-without-solution.sh"), Eq(0));
 
@@ -173,6 +259,31 @@ TEST_F(GenerationEteTests, Multi_WithOutputPrefix) {
             "6\n"));
 }
 
+TEST_F(GenerationEteTests, Multi_WithOutputPrefix_Streaming) {
+    ASSERT_THAT(execStatus("cd test-ete/multi-prefix && ../scripts/generate.sh --stream"), Eq(0));
+
+    EXPECT_THAT(ls("test-ete/multi-prefix/tc"), UnorderedElementsAre(
+            "multi-prefix_sample.in",
+            "multi-prefix_sample.out",
+            "multi-prefix_1.in",
+            "multi-prefix_1.out",
+            "multi-prefix_2.in",
+            "multi-prefix_2.out"
+    ));
+
+    EXPECT_THAT(readFile("test-ete/multi-prefix/tc/multi-prefix_sample.out"), Eq(
+            "Case\t\"$1\\\":\n"
+            "6\n"
+            "Case\t\"$2\\\":\n"
+            "11\n"));
+
+    EXPECT_THAT(readFile("test-ete/multi-prefix/tc/multi-prefix_1.out"), Eq(
+            "Case\t\"$1\\\":\n"
+            "4\n"
+            "Case\t\"$2\\\":\n"
+            "6\n"));
+}
+
 TEST_F(GenerationEteTests, Interactive) {
     ASSERT_THAT(execStatus("cd test-ete/interactive && ../scripts/generate.sh"), Eq(0));
 
@@ -3,6 +3,7 @@
 #include "BaseEteTests.cpp"
 
 using ::testing::AllOf;
+using ::testing::ContainsRegex;
 using ::testing::Eq;
 using ::testing::HasSubstr;
 using ::testing::Test;
@@ -49,6 +50,60 @@ TEST_F(GradingEteTests, Subtasks) {
             HasSubstr("Wrong Answer [70]")));
 }
 
+TEST_F(GradingEteTests, Subtasks_Threads) {
+    string result = exec("cd test-ete/subtasks && ../scripts/grade.sh --threads=3");
+    EXPECT_THAT(result, AllOf(
+            ContainsRegex("  subtasks_sample_1: Accepted \\([^)]*\\)\n"
+                          "  subtasks_sample_2: Wrong Answer \\([^)]*\\)\n"),
+            ContainsRegex("  subtasks_1_1: Accepted \\([^)]*\\)\n"
+                          "  subtasks_1_2: Accepted \\([^)]*\\)\n")));
+    EXPECT_THAT(result, HasSubstr("[ SLOWEST TEST CASES ]"));
+    EXPECT_THAT(result, AllOf(
+            HasSubstr("Subtask 1: Accepted [70]"),
+            HasSubstr("Subtask 2: Wrong Answer [0]"),
+            HasSubstr("Wrong Answer [70]")));
+}
+
+TEST_F(GradingEteTests, Subtasks_StopOnFirstFailure) {
+    string result = exec("cd test-ete/subtasks && ../scripts/grade.sh --stop-on-first-failure");
+    EXPECT_THAT(result, AllOf(
+            HasSubstr("subtasks_sample_2: Wrong Answer"),
+            HasSubstr("subtasks_1_1: Accepted"),
+            HasSubstr("subtasks_2_1: Skipped\n")));
+    EXPECT_THAT(result, AllOf(
+            HasSubstr("Subtask 1: Accepted [70]"),
+            HasSubstr("Subtask 2: Wrong Answer [0]"),
+            HasSubstr("Wrong Answer [70]")));
+}
+
+TEST_F(GradingEteTests, Subtasks_FailingFirst) {
+    exec("rm -f test-ete/subtasks/.tcframe_grading_history");
+    exec("cd test-ete/subtasks && ../scripts/grade.sh --order=failing-first");
+    string result = exec("cd test-ete/subtasks && ../scripts/grade.sh --order=failing-first --stop-on-first-failure");
+    // Both failing test cases only belong to subtask 2, so whichever of them is graded first skips the other one.
+    EXPECT_THAT(result, AllOf(
+            ContainsRegex("  subtasks_sample_1: Accepted \\([^)]*\\)\n"),
+            ContainsRegex("  subtasks_1_1: Accepted \\([^)]*\\)\n"
+                          "  subtasks_1_2: Accepted \\([^)]*\\)\n"),
+            ContainsRegex("subtasks_(sample_2|2_1): Skipped\n")));
+    EXPECT_THAT(result, HasSubstr("Wrong Answer [70]"));
+
+    string history = exec("cat test-ete/subtasks/.tcframe_grading_history");
+    EXPECT_THAT(history, AllOf(
+            HasSubstr("subtasks_sample_1 2 0 "),
+            HasSubstr("subtasks_1_1 2 0 ")));
+}
+
+TEST_F(GradingEteTests, Subtasks_Json) {
+    string result = exec("cd test-ete/subtasks && ../scripts/grade.sh --format=json");
+    EXPECT_THAT(result, AllOf(
+            ContainsRegex("\\{\"event\":\"test_case\",\"name\":\"subtasks_1_1\",\"verdict\":\"AC\",[^\n]*\\}\n"),
+            ContainsRegex("\\{\"event\":\"test_case\",\"name\":\"subtasks_2_1\",\"verdict\":\"WA\",[^\n]*\\}\n"),
+            HasSubstr("{\"event\":\"subtask\",\"id\":1,\"verdict\":\"AC\",\"points\":70,"),
+            HasSubstr("{\"event\":\"subtask\",\"id\":2,\"verdict\":\"WA\",\"points\":0,"),
+            HasSubstr("{\"event\":\"result\",\"verdict\":\"WA\",\"points\":70,")));
+}
+
 TEST_F(GradingEteTests, Interactive) {
     string result = exec("cd test-ete/interactive && ../scripts/grade-with-communicator.sh");
     EXPECT_THAT(result, AllOf(
@@ -0,0 +1,8 @@
+#include <bits/stdc++.h>
+using namespace std;
+
+int main() {
+    vector<char> data(64 << 20, 1);
+    this_thread::sleep_for(chrono::milliseconds(500));
+    return data[42] - 1;
+}
@@ -0,0 +1,121 @@
+#include "gmock/gmock.h"
+
+#include <cstdlib>
+#include <fstream>
+
+#include "tcframe/runner/generator/SolutionOutputCache.hpp"
+#include "tcframe/util.hpp"
+
+using ::testing::Eq;
+using ::testing::Test;
+
+using std::ifstream;
+using std::ofstream;
+
+namespace tcframe {
+
+class SolutionOutputCacheIntegrationTests : public Test {
+protected:
+    static constexpr const char* DIR = "test-integration/runner/generator/cache";
+
+    SolutionOutputCache cache;
+
+    GenerationOptions options = GenerationOptionsBuilder("foo")
+            .setSolutionCommand("cat " + dir("solution.txt"))
+            .setOutputCache(dir("cache"), 1)
+            .build();
+
+    void SetUp() {
+        system(("rm -rf " + string(DIR) + " && mkdir -p " + string(DIR)).c_str());
+        writeFile(dir("solution.txt"), "v1");
+    }
+
+    static string dir(const string& filename) {
+        return string(DIR) + "/" + filename;
+    }
+
+    static void writeFile(const string& filename, const string& contents) {
+        ofstream out(filename);
+        out << contents;
+    }
+
+    static string readFile(const string& filename) {
+        ifstream in(filename);
+        return StringUtils::streamToString(&in);
+    }
+};
+
+TEST_F(SolutionOutputCacheIntegrationTests, Restoring) {
+    writeFile(dir("1.in"), "1 2\n");
+    writeFile(dir("1.out"), "3\n");
+
+    EXPECT_FALSE(cache.restore(dir("1.in"), dir("restored.out"), options));
+    cache.store(dir("1.in"), dir("1.out"), options);
+    EXPECT_TRUE(cache.restore(dir("1.in"), dir("restored.out"), options));
+
+    EXPECT_THAT(readFile(dir("restored.out")), Eq("3\n"));
+    EXPECT_THAT(cache.statistics(), Eq(OutputCacheStatistics{1, 1}));
+}
+
+TEST_F(SolutionOutputCacheIntegrationTests, Restoring_Disabled) {
+    GenerationOptions disabledOptions = GenerationOptionsBuilder("foo")
+            .setSolutionCommand("cat " + dir("solution.txt"))
+            .build();
+    writeFile(dir("1.in"), "1 2\n");
+    writeFile(dir("1.out"), "3\n");
+
+    cache.store(dir("1.in"), dir("1.out"), disabledOptions);
+    EXPECT_FALSE(cache.restore(dir("1.in"), dir("restored.out"), disabledOptions));
+    EXPECT_THAT(cache.statistics(), Eq(OutputCacheStatistics{0, 0}));
+}
+
+TEST_F(SolutionOutputCacheIntegrationTests, Restoring_DifferentInput) {
+    writeFile(dir("1.in"), "1 2\n");
+    writeFile(dir("1.out"), "3\n");
+    writeFile(dir("2.in"), "1 3\n");
+
+    cache.store(dir("1.in"), dir("1.out"), options);
+    EXPECT_FALSE(cache.restore(dir("2.in"), dir("restored.out"), options));
+}
+
+TEST_F(SolutionOutputCacheIntegrationTests, Restoring_ChangedSolution) {
+    writeFile(dir("1.in"), "1 2\n");
+    writeFile(dir("1.out"), "3\n");
+    cache.store(dir("1.in"), dir("1.out"), options);
+
+    writeFile(dir("solution.txt"), "v2");
+    SolutionOutputCache newCache;
+    EXPECT_FALSE(newCache.restore(dir("1.in"), dir("restored.out"), options));
+}
+
+TEST_F(SolutionOutputCacheIntegrationTests, Eviction) {
+    string contents(600 * 1024, 'x');
+    for (const string& name : vector<string>{"1", "2", "3"}) {
+        writeFile(dir(name + ".in"), name);
+        writeFile(dir(name + ".out"), contents);
+        cache.store(dir(name + ".in"), dir(name + ".out"), options);
+    }
+    system(("touch -t 200001010000 " + dir("cache") + "/*").c_str());
+    EXPECT_TRUE(cache.restore(dir("2.in"), dir("restored.out"), options));
+
+    cache.evict(options);
+
+    EXPECT_FALSE(cache.restore(dir("1.in"), dir("restored.out"), options));
+    EXPECT_TRUE(cache.restore(dir("2.in"), dir("restored.out"), options));
+    EXPECT_FALSE(cache.restore(dir("3.in"), dir("restored.out"), options));
+}
+
+TEST_F(SolutionOutputCacheIntegrationTests, Eviction_TemporaryFiles) {
+    writeFile(dir("1.in"), "1");
+    writeFile(dir("1.out"), string(600 * 1024, 'x'));
+    cache.store(dir("1.in"), dir("1.out"), options);
+    writeFile(dir("cache/stale.out.123.tmp"), string(600 * 1024, 'x'));
+    system(("touch -t 200001010000 " + dir("cache/stale.out.123.tmp")).c_str());
+
+    cache.evict(options);
+
+    EXPECT_TRUE(cache.restore(dir("1.in"), dir("restored.out"), options));
+    EXPECT_FALSE(ifstream(dir("cache/stale.out.123.tmp")).good());
+}
+
+}
@@ -6,6 +6,9 @@
 #include "tcframe/util.hpp"
 
 using ::testing::Eq;
+using ::testing::Ge;
+using ::testing::Gt;
+using ::testing::Lt;
 using ::testing::Test;
 
 namespace tcframe {
@@ -42,6 +45,38 @@ TEST_F(OperatingSystemIntegrationTests, Execution_Successful) {
     EXPECT_THAT(result.standardError(), Eq("44\n"));
 }
 
+TEST_F(OperatingSystemIntegrationTests, Execution_Successful_WithArguments) {
+    ExecutionResult result = os.execute(ExecutionRequestBuilder()
+            .setCommand("echo  foo   bar")
+            .setOutputFilename("test-integration/os/arguments.out")
+            .build());
+
+    EXPECT_TRUE(result.isSuccessful());
+    EXPECT_THAT(readFile("test-integration/os/arguments.out"), Eq("foo bar\n"));
+}
+
+TEST_F(OperatingSystemIntegrationTests, Execution_Successful_WithShellSyntax) {
+    ExecutionResult result = os.execute(ExecutionRequestBuilder()
+            .setCommand("cat | tr 4 5 && echo 'x y' >&2")
+            .setInputFilename("test-integration/os/1.in")
+            .setOutputFilename("test-integration/os/shell.out")
+            .build());
+
+    EXPECT_TRUE(result.isSuccessful());
+    EXPECT_THAT(readFile("test-integration/os/shell.out"), Eq("52\n"));
+    EXPECT_THAT(result.standardError(), Eq("x y\n"));
+}
+
+TEST_F(OperatingSystemIntegrationTests, Execution_Failed_CommandNotFound) {
+    ExecutionResult result = os.execute(ExecutionRequestBuilder()
+            .setCommand("test-integration/os/nonexistent")
+            .build());
+
+    EXPECT_FALSE(result.isSuccessful());
+    EXPECT_THAT(result.exitCode(), Eq(optional<int>(127)));
+    EXPECT_FALSE(result.exitSignal());
+}
+
 TEST_F(OperatingSystemIntegrationTests, Execution_ExceededTimeLimits) {
     system(
             "g++ -o "
@@ -50,12 +85,14 @@ TEST_F(OperatingSystemIntegrationTests, Execution_ExceededTimeLimits) {
 
     ExecutionResult result = os.execute(ExecutionRequestBuilder()
             .setCommand("test-integration/os/program_tl")
-            .setTimeLimit(1)
+            .setTimeLimit(1000)
             .build());
 
     EXPECT_FALSE(result.isSuccessful());
     EXPECT_FALSE(result.exitCode());
     EXPECT_THAT(result.exitSignal(), Eq(optional<int>(SIGXCPU)));
+    EXPECT_THAT(result.cpuTimeMs(), Gt(0));
+    EXPECT_THAT(result.wallTimeMs(), Ge(result.cpuTimeMs()));
 }
 
 #ifndef __APPLE__
@@ -74,10 +111,73 @@ TEST_F(OperatingSystemIntegrationTests, Execution_ExceededMemoryLimits) {
     EXPECT_FALSE(result.isSuccessful());
     EXPECT_FALSE(result.exitCode());
     EXPECT_THAT(result.exitSignal(), Eq(optional<int>(SIGSEGV)));
+    EXPECT_FALSE(result.memoryLimitExceeded());
+}
+
+TEST_F(OperatingSystemIntegrationTests, Execution_ExceededResidentMemoryLimits) {
+    system(
+            "g++ -o "
+            "test-integration/os/program_ml-rss "
+            "test-integration/os/program_ml-rss.cpp");
+
+    ExecutionResult result = os.execute(ExecutionRequestBuilder()
+            .setCommand("test-integration/os/program_ml-rss")
+            .setMemoryLimit(16)
+            .setRssMemoryLimit(true)
+            .build());
+
+    EXPECT_FALSE(result.isSuccessful());
+    EXPECT_THAT(result.exitSignal(), Eq(optional<int>(SIGKILL)));
+    EXPECT_THAT(result.peakMemoryKb(), Gt(16 * 1024));
+    EXPECT_TRUE(result.memoryLimitExceeded());
+}
+
+TEST_F(OperatingSystemIntegrationTests, Execution_ExceededResidentMemoryLimits_WithShellSyntax) {
+    system(
+            "g++ -o "
+            "test-integration/os/program_ml-rss "
+            "test-integration/os/program_ml-rss.cpp");
+
+    ExecutionResult result = os.execute(ExecutionRequestBuilder()
+            .setCommand("test-integration/os/program_ml-rss | cat")
+            .setMemoryLimit(16)
+            .setRssMemoryLimit(true)
+            .build());
+
+    EXPECT_THAT(result.peakMemoryKb(), Gt(16 * 1024));
+    EXPECT_TRUE(result.memoryLimitExceeded());
+}
+
+TEST_F(OperatingSystemIntegrationTests, Execution_ResidentMemoryLimits_ExcludesRunner) {
+    vector<char> runnerMemory(256 * 1024 * 1024, 'x');
+
+    ExecutionResult result = os.execute(ExecutionRequestBuilder()
+            .setCommand("true")
+            .setMemoryLimit(16)
+            .setRssMemoryLimit(true)
+            .build());
+
+    EXPECT_TRUE(result.isSuccessful());
+    EXPECT_THAT(runnerMemory.back(), Eq('x'));
+    EXPECT_THAT(result.peakMemoryKb(), Lt(16 * 1024));
+    EXPECT_FALSE(result.memoryLimitExceeded());
 }
 
 #endif
 
+TEST_F(OperatingSystemIntegrationTests, Execution_PeakMemory_ExcludesRunner) {
+    vector<char> runnerMemory(256 * 1024 * 1024, 'x');
+
+    ExecutionResult result = os.execute(ExecutionRequestBuilder()
+            .setCommand("true")
+            .setMeasuresPeakMemory(true)
+            .build());
+
+    EXPECT_TRUE(result.isSuccessful());
+    EXPECT_THAT(runnerMemory.back(), Eq('x'));
+    EXPECT_THAT(result.peakMemoryKb(), Lt(64 * 1024));
+}
+
 TEST_F(OperatingSystemIntegrationTests,  Execution_Crashed_ExitCode) {
     system(
             "g++ -o "
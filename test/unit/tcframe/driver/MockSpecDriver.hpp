@@ -16,8 +16,10 @@ public:
     MOCK_METHOD0(hasMultipleTestCases, bool());
     MOCK_METHOD0(getMultipleTestCasesOutputPrefix, optional<string>());
     MOCK_METHOD2(generateTestCaseInput, void(const string&, ostream*));
+    MOCK_METHOD2(appendTestCaseInput, void(const string&, ostream*));
     MOCK_METHOD2(generateSampleTestCaseOutput, void(const string&, ostream*));
     MOCK_METHOD1(validateTestCaseOutput, void(istream*));
+    MOCK_METHOD2(validateMultipleTestCasesOutput, void(istream*, int));
     MOCK_METHOD1(validateMultipleTestCasesInput, void(int));
 };
 
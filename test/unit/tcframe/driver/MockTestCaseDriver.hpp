@@ -12,8 +12,10 @@ public:
             : TestCaseDriver(nullptr, nullptr, nullptr, MultipleTestCasesConfig()) {}
 
     MOCK_METHOD2(generateInput, void(const TestCase&, ostream*));
+    MOCK_METHOD2(appendInput, void(const TestCase&, ostream*));
     MOCK_METHOD2(generateSampleOutput, void(const TestCase&, ostream*));
     MOCK_METHOD1(validateOutput, void(istream*));
+    MOCK_METHOD2(validateMultipleTestCasesOutput, void(istream*, int));
     MOCK_METHOD1(validateMultipleTestCasesInput, void(int));
 };
 
@@ -62,6 +62,12 @@ TEST_F(SpecDriverTests, GenerateTestCaseInput) {
     driver.generateTestCaseInput("foo_2", &out);
 }
 
+TEST_F(SpecDriverTests, AppendTestCaseInput) {
+    ostringstream out;
+    EXPECT_CALL(testCaseDriver, appendInput(tc2, &out));
+    driver.appendTestCaseInput("foo_2", &out);
+}
+
 TEST_F(SpecDriverTests, GenerateSampleTestCaseOutput) {
     ostringstream out;
     EXPECT_CALL(testCaseDriver, generateSampleOutput(stc, &out));
@@ -74,6 +80,12 @@ TEST_F(SpecDriverTests, ValidateTestCaseOutput) {
     driver.validateTestCaseOutput(&in);
 }
 
+TEST_F(SpecDriverTests, ValidateMultipleTestCasesOutput) {
+    istringstream in;
+    EXPECT_CALL(testCaseDriver, validateMultipleTestCasesOutput(&in, 3));
+    driver.validateMultipleTestCasesOutput(&in, 3);
+}
+
 TEST_F(SpecDriverTests, ValidateMultipleTestCasesInput) {
     EXPECT_CALL(testCaseDriver, validateMultipleTestCasesInput(3));
     driver.validateMultipleTestCasesInput(3);
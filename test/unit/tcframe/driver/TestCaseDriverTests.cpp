@@ -157,6 +157,18 @@ TEST_F(TestCaseDriverTests, GenerateInput_MultipleTestCases_Official) {
     EXPECT_THAT(N, Eq(42));
 }
 
+TEST_F(TestCaseDriverTests, AppendInput_MultipleTestCases_Official) {
+    {
+        InSequence sequence;
+        EXPECT_CALL(verifier, verifyConstraints(set<int>{1, 2}));
+        EXPECT_CALL(rawIOManipulator, printLine(_, _)).Times(0);
+        EXPECT_CALL(ioManipulator, printInput(out));
+    }
+    N = 0;
+    driverWithMultipleTestCases.appendInput(officialTestCase, out);
+    EXPECT_THAT(N, Eq(42));
+}
+
 TEST_F(TestCaseDriverTests, GenerateSampleOutput_MultipleTestCases) {
     {
         InSequence sequence;
@@ -198,6 +210,18 @@ TEST_F(TestCaseDriverTests, ValidateOutput_MultipleTestCases_WithOutputPrefix_Fa
     }
 }
 
+TEST_F(TestCaseDriverTests, ValidateMultipleTestCasesOutput) {
+    istringstream in;
+    EXPECT_CALL(ioManipulator, parseOutputs(&in, vector<string>{"", ""}));
+    driverWithMultipleTestCases.validateMultipleTestCasesOutput(&in, 2);
+}
+
+TEST_F(TestCaseDriverTests, ValidateMultipleTestCasesOutput_WithOutputPrefix) {
+    istringstream in;
+    EXPECT_CALL(ioManipulator, parseOutputs(&in, vector<string>{"Case #1: ", "Case #2: "}));
+    driverWithMultipleTestCasesWithOutputPrefix.validateMultipleTestCasesOutput(&in, 2);
+}
+
 TEST_F(TestCaseDriverTests, ValidateMultipleTestCasesInput) {
     EXPECT_CALL(verifier, verifyMultipleTestCasesConstraints());
     driverWithMultipleTestCases.validateMultipleTestCasesInput(3);
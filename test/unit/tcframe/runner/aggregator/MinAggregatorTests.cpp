@@ -29,6 +29,18 @@ TEST_F(MinAggregatorTests, Aggregate_ZeroPoints) {
     EXPECT_THAT(aggregator.aggregate(verdicts, 70), Eq(SubtaskVerdict(Verdict::rte(), 0)));
 }
 
+TEST_F(MinAggregatorTests, Aggregate_ZeroPoints_MLE) {
+    vector<TestCaseVerdict> verdicts = {
+            TestCaseVerdict(Verdict::rte()),
+            TestCaseVerdict(Verdict::mle()),
+            TestCaseVerdict(Verdict::wa())};
+
+    EXPECT_THAT(aggregator.aggregate(verdicts, 70), Eq(SubtaskVerdict(Verdict::mle(), 0)));
+
+    verdicts.push_back(TestCaseVerdict(Verdict::tle()));
+    EXPECT_THAT(aggregator.aggregate(verdicts, 70), Eq(SubtaskVerdict(Verdict::tle(), 0)));
+}
+
 TEST_F(MinAggregatorTests, Aggregate_MinOKPoints) {
     vector<TestCaseVerdict> verdicts = {
             TestCaseVerdict(Verdict::ac()),
@@ -38,4 +50,12 @@ TEST_F(MinAggregatorTests, Aggregate_MinOKPoints) {
     EXPECT_THAT(aggregator.aggregate(verdicts, 70), Eq(SubtaskVerdict(Verdict::ok(), 20)));
 }
 
+TEST_F(MinAggregatorTests, ZeroesSubtask) {
+    EXPECT_FALSE(aggregator.zeroesSubtask(TestCaseVerdict(Verdict::ac())));
+    EXPECT_FALSE(aggregator.zeroesSubtask(TestCaseVerdict(Verdict::ok(), 20)));
+    EXPECT_TRUE(aggregator.zeroesSubtask(TestCaseVerdict(Verdict::ok(), 0)));
+    EXPECT_TRUE(aggregator.zeroesSubtask(TestCaseVerdict(Verdict::wa())));
+    EXPECT_TRUE(aggregator.zeroesSubtask(TestCaseVerdict(Verdict::tle())));
+}
+
 }
@@ -9,6 +9,7 @@ namespace tcframe {
 class MockTestCaseAggregator : public TestCaseAggregator {
 public:
     MOCK_METHOD2(aggregate, SubtaskVerdict(const vector<TestCaseVerdict>&, double));
+    MOCK_METHOD1(zeroesSubtask, bool(const TestCaseVerdict&));
 };
 
 }
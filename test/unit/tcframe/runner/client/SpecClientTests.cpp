@@ -71,6 +71,13 @@ TEST_F(SpecClientTests, GenerateTestCaseInput) {
     client.generateTestCaseInput("foo_1", "foo_1.out");
 }
 
+TEST_F(SpecClientTests, AppendTestCaseInput) {
+    ostringstream stream;
+    EXPECT_CALL(os, openForWriting(_)).Times(0);
+    EXPECT_CALL(specDriver, appendTestCaseInput("foo_1", &stream));
+    client.appendTestCaseInput("foo_1", &stream);
+}
+
 TEST_F(SpecClientTests, GenerateSampleTestCaseOutput) {
     {
         InSequence sequence;
@@ -92,6 +99,16 @@ TEST_F(SpecClientTests, ValidateTestCaseOutput) {
     client.validateTestCaseOutput("foo_1.out");
 }
 
+TEST_F(SpecClientTests, ValidateMultipleTestCasesOutput) {
+    {
+        InSequence sequence;
+        EXPECT_CALL(os, openForReading("foo_1.out"));
+        EXPECT_CALL(specDriver, validateMultipleTestCasesOutput(in, 3));
+        EXPECT_CALL(os, closeOpenedStream(in));
+    }
+    client.validateMultipleTestCasesOutput("foo_1.out", 3);
+}
+
 TEST_F(SpecClientTests, ValidateMultipleTestCasesInput) {
     EXPECT_CALL(specDriver, validateMultipleTestCasesInput(3));
     client.validateMultipleTestCasesInput(3);
@@ -15,27 +15,53 @@ TEST_F(ArgsParserTests, Parsing_AllOptions) {
             (char*) "./runner",
             (char*) "--brief",
             (char*) "--communicator=python Communicator.py",
+            (char*) "--format=json",
+            (char*) "--incremental",
+            (char*) "--jobs=8",
             (char*) "--memory-limit=128",
+            (char*) "--order=smallest-first",
             (char*) "--output=my/testdata",
+            (char*) "--output-cache=my/cache",
+            (char*) "--output-cache-size=64",
+            (char*) "--rss-memory-limit",
             (char*) "--scorer=python Scorer.py",
             (char*) "--seed=42",
+            (char*) "--seed-per-test-case",
             (char*) "--solution=python Sol.py",
+            (char*) "--stop-on-first-failure",
+            (char*) "--stream",
+            (char*) "--threads=4",
             (char*) "--time-limit=3",
+            (char*) "--time-limit-ms=2500",
             nullptr};
     int argc = sizeof(argv) / sizeof(char*) - 1;
 
     Args args = ArgsParser::parse(argc, argv);
     EXPECT_TRUE(args.brief());
+    EXPECT_TRUE(args.incremental());
+    EXPECT_FALSE(args.paranoidIncremental());
     EXPECT_FALSE(args.noMemoryLimit());
     EXPECT_FALSE(args.noTimeLimit());
+    EXPECT_TRUE(args.rssMemoryLimit());
+    EXPECT_TRUE(args.seedPerTestCase());
+    EXPECT_TRUE(args.stopOnFirstFailure());
+    EXPECT_TRUE(args.stream());
 
     EXPECT_THAT(args.communicator(), Eq(optional<string>("python Communicator.py")));
+    EXPECT_THAT(args.format(), Eq(Args::Format::JSON));
+    EXPECT_THAT(args.jobs(), Eq(optional<int>(8)));
     EXPECT_THAT(args.memoryLimit(), Eq(optional<int>(128)));
+    EXPECT_THAT(args.order(), Eq(GradingOrder::SMALLEST_FIRST));
     EXPECT_THAT(args.output(), Eq(optional<string>("my/testdata")));
+    EXPECT_THAT(args.runnerPath(), Eq("./runner"));
+    EXPECT_THAT(args.outputCache(), Eq(optional<string>("my/cache")));
+    EXPECT_THAT(args.outputCacheSize(), Eq(optional<int>(64)));
     EXPECT_THAT(args.scorer(), Eq(optional<string>("python Scorer.py")));
     EXPECT_THAT(args.seed(), Eq(optional<unsigned>(42)));
     EXPECT_THAT(args.solution(), Eq(optional<string>("python Sol.py")));
+    EXPECT_THAT(args.threads(), Eq(optional<int>(4)));
     EXPECT_THAT(args.timeLimit(), Eq(optional<int>(3)));
+    EXPECT_THAT(args.timeLimitMs(), Eq(optional<int>(2500)));
 }
 
 TEST_F(ArgsParserTests, Parsing_SomeOptions) {
@@ -52,9 +78,28 @@ TEST_F(ArgsParserTests, Parsing_SomeOptions) {
     EXPECT_FALSE(args.brief());
     EXPECT_TRUE(args.noMemoryLimit());
     EXPECT_TRUE(args.noTimeLimit());
+    EXPECT_FALSE(args.rssMemoryLimit());
+    EXPECT_FALSE(args.stopOnFirstFailure());
+    EXPECT_FALSE(args.stream());
+    EXPECT_THAT(args.format(), Eq(Args::Format::TEXT));
+    EXPECT_THAT(args.order(), Eq(GradingOrder::CANONICAL));
     EXPECT_THAT(args.output(), Eq(optional<string>("my/testdata")));
     EXPECT_THAT(args.seed(), Eq(optional<unsigned>(42)));
     EXPECT_THAT(args.solution(), Eq(optional<string>()));
+    EXPECT_THAT(args.timeLimitMs(), Eq(optional<int>()));
+}
+
+TEST_F(ArgsParserTests, Parsing_ParanoidIncremental) {
+    char* argv[] = {
+            (char*) "./runner",
+            (char*) "--incremental=paranoid",
+            (char*) "--seed-per-test-case",
+            nullptr};
+    int argc = sizeof(argv) / sizeof(char*) - 1;
+
+    Args args = ArgsParser::parse(argc, argv);
+    EXPECT_TRUE(args.incremental());
+    EXPECT_TRUE(args.paranoidIncremental());
 }
 
 TEST_F(ArgsParserTests, Parsing_MissingOptionArgument) {
@@ -72,6 +117,82 @@ TEST_F(ArgsParserTests, Parsing_MissingOptionArgument) {
     }
 }
 
+TEST_F(ArgsParserTests, Parsing_InvalidFormat) {
+    char* argv[] = {
+            (char*) "./runner",
+            (char*) "--format=xml",
+            nullptr};
+    int argc = sizeof(argv) / sizeof(char*) - 1;
+
+    try {
+        ArgsParser::parse(argc, argv);
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("tcframe: option --format must be either 'text' or 'json'"));
+    }
+}
+
+TEST_F(ArgsParserTests, Parsing_InvalidOrder) {
+    char* argv[] = {
+            (char*) "./runner",
+            (char*) "--order=random",
+            nullptr};
+    int argc = sizeof(argv) / sizeof(char*) - 1;
+
+    try {
+        ArgsParser::parse(argc, argv);
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq(
+                "tcframe: option --order must be either 'canonical', 'smallest-first', or 'failing-first'"));
+    }
+}
+
+TEST_F(ArgsParserTests, Parsing_InvalidIncrementalMode) {
+    char* argv[] = {
+            (char*) "./runner",
+            (char*) "--incremental=lazy",
+            nullptr};
+    int argc = sizeof(argv) / sizeof(char*) - 1;
+
+    try {
+        ArgsParser::parse(argc, argv);
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("tcframe: option --incremental only accepts 'paranoid'"));
+    }
+}
+
+TEST_F(ArgsParserTests, Parsing_JobsWithoutSeedPerTestCase) {
+    char* argv[] = {
+            (char*) "./runner",
+            (char*) "--jobs=8",
+            nullptr};
+    int argc = sizeof(argv) / sizeof(char*) - 1;
+
+    try {
+        ArgsParser::parse(argc, argv);
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("tcframe: option --jobs requires --seed-per-test-case"));
+    }
+}
+
+TEST_F(ArgsParserTests, Parsing_IncrementalWithoutSeedPerTestCase) {
+    char* argv[] = {
+            (char*) "./runner",
+            (char*) "--incremental",
+            nullptr};
+    int argc = sizeof(argv) / sizeof(char*) - 1;
+
+    try {
+        ArgsParser::parse(argc, argv);
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("tcframe: option --incremental requires --seed-per-test-case"));
+    }
+}
+
 TEST_F(ArgsParserTests, Parsing_InvalidOption) {
     char* argv[] = {
             (char*) "./runner",
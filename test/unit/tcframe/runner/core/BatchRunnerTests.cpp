@@ -19,27 +19,58 @@ protected:
         }
     };
 
+    class BatchWithTokenScorerProblemSpec : public ProblemSpec {
+    protected:
+        void StyleConfig() {
+            BatchEvaluator();
+            TokenScorer();
+        }
+    };
+
+    class BatchWithRealScorerProblemSpec : public ProblemSpec {
+    protected:
+        void StyleConfig() {
+            BatchEvaluator();
+            RealScorer(1e-6);
+        }
+    };
+
+    class BatchWithPreciseRealScorerProblemSpec : public ProblemSpec {
+    protected:
+        void StyleConfig() {
+            BatchEvaluator();
+            RealScorer(1.2345678e-9);
+        }
+    };
+
     class BatchTestSpec : public BaseTestSpec<BatchProblemSpec> {};
     class BatchWithCustomScorerTestSpec : public BaseTestSpec<BatchWithCustomScorerProblemSpec> {};
+    class BatchWithTokenScorerTestSpec : public BaseTestSpec<BatchWithTokenScorerProblemSpec> {};
+    class BatchWithRealScorerTestSpec : public BaseTestSpec<BatchWithRealScorerProblemSpec> {};
+    class BatchWithPreciseRealScorerTestSpec : public BaseTestSpec<BatchWithPreciseRealScorerProblemSpec> {};
 
     Runner<BatchProblemSpec> runner = createRunner(new BatchTestSpec());
     Runner<BatchWithCustomScorerProblemSpec> runnerWithCustomScorer = createRunner(new BatchWithCustomScorerTestSpec());
+    Runner<BatchWithTokenScorerProblemSpec> runnerWithTokenScorer = createRunner(new BatchWithTokenScorerTestSpec());
+    Runner<BatchWithRealScorerProblemSpec> runnerWithRealScorer = createRunner(new BatchWithRealScorerTestSpec());
+    Runner<BatchWithPreciseRealScorerProblemSpec> runnerWithPreciseRealScorer =
+            createRunner(new BatchWithPreciseRealScorerTestSpec());
 };
 
 TEST_F(BatchRunnerTests, Run_Generation_EvaluatorRegistry_NoCustomScorer) {
-    EXPECT_CALL(evaluatorRegistry, get("batch", _, Truly(HelperKeyIs("scorer", ""))));
+    EXPECT_CALL(evaluatorRegistry, get("batch", _, Truly(HelperKeyIs("scorer", "")), _));
     runner.run(argc, argv);
 }
 
 TEST_F(BatchRunnerTests, Run_Generation_EvaluatorRegistry_CustomScorer_Default) {
     EXPECT_CALL(evaluatorRegistry,
-                get("batch", _,  Truly(HelperKeyIs("scorer", string(RunnerDefaults::SCORER_COMMAND)))));
+                get("batch", _,  Truly(HelperKeyIs("scorer", string(RunnerDefaults::SCORER_COMMAND))), _));
 
     runnerWithCustomScorer.run(argc, argv);
 }
 
 TEST_F(BatchRunnerTests, Run_Generation_EvaluatorRegistry_CustomScorer_Args) {
-    EXPECT_CALL(evaluatorRegistry, get("batch", _, Truly(HelperKeyIs("scorer", "\"java Scorer\""))));
+    EXPECT_CALL(evaluatorRegistry, get("batch", _, Truly(HelperKeyIs("scorer", "\"java Scorer\"")), _));
     runnerWithCustomScorer.run(2, new char*[3]{
             (char*) "./runner",
             (char*) "--scorer=\"java Scorer\"",
@@ -47,7 +78,7 @@ TEST_F(BatchRunnerTests, Run_Generation_EvaluatorRegistry_CustomScorer_Args) {
 }
 
 TEST_F(BatchRunnerTests, Run_Grading_EvaluatorRegistry_NoCustomScorer) {
-    EXPECT_CALL(evaluatorRegistry, get("batch", _, Truly(HelperKeyIs("scorer", ""))));
+    EXPECT_CALL(evaluatorRegistry, get("batch", _, Truly(HelperKeyIs("scorer", "")), _));
     runner.run(2, new char*[3]{
             (char*) "./runner",
             (char*) "grade",
@@ -56,7 +87,7 @@ TEST_F(BatchRunnerTests, Run_Grading_EvaluatorRegistry_NoCustomScorer) {
 
 TEST_F(BatchRunnerTests, Run_Grading_EvaluatorRegistry_CustomScorer_Default) {
     EXPECT_CALL(evaluatorRegistry,
-                get("batch", _,  Truly(HelperKeyIs("scorer", string(RunnerDefaults::SCORER_COMMAND)))));
+                get("batch", _,  Truly(HelperKeyIs("scorer", string(RunnerDefaults::SCORER_COMMAND))), _));
 
     runnerWithCustomScorer.run(2, new char*[3]{
             (char*) "./runner",
@@ -65,7 +96,7 @@ TEST_F(BatchRunnerTests, Run_Grading_EvaluatorRegistry_CustomScorer_Default) {
 }
 
 TEST_F(BatchRunnerTests, Run_Grading_EvaluatorRegistry_CustomScorer_Args) {
-    EXPECT_CALL(evaluatorRegistry, get("batch", _, Truly(HelperKeyIs("scorer", "\"java Scorer\""))));
+    EXPECT_CALL(evaluatorRegistry, get("batch", _, Truly(HelperKeyIs("scorer", "\"java Scorer\"")), _));
     runnerWithCustomScorer.run(3, new char*[4]{
             (char*) "./runner",
             (char*) "./grade",
@@ -73,4 +104,51 @@ TEST_F(BatchRunnerTests, Run_Grading_EvaluatorRegistry_CustomScorer_Args) {
             nullptr});
 }
 
+TEST_F(BatchRunnerTests, Run_Grading_EvaluatorRegistry_NoCustomScorer_DiffScorer) {
+    EXPECT_CALL(evaluatorRegistry, get("batch", _, _, Property(
+            &EvaluatorConfig::builtInScorer, Eq(optional<ScoringStyle>(ScoringStyle::DIFF)))));
+    runner.run(2, new char*[3]{
+            (char*) "./runner",
+            (char*) "grade",
+            nullptr});
+}
+
+TEST_F(BatchRunnerTests, Run_Grading_EvaluatorRegistry_TokenScorer) {
+    EXPECT_CALL(evaluatorRegistry, get("batch", _, Truly(HelperKeyIs("scorer", "")), Property(
+            &EvaluatorConfig::builtInScorer, Eq(optional<ScoringStyle>(ScoringStyle::TOKEN)))));
+    runnerWithTokenScorer.run(2, new char*[3]{
+            (char*) "./runner",
+            (char*) "grade",
+            nullptr});
+}
+
+TEST_F(BatchRunnerTests, Run_Grading_EvaluatorRegistry_RealScorer) {
+    EXPECT_CALL(evaluatorRegistry, get("batch", _, _, AllOf(
+            Property(&EvaluatorConfig::builtInScorer, Eq(optional<ScoringStyle>(ScoringStyle::REAL))),
+            Property(&EvaluatorConfig::scorerEpsilon, Eq(1e-6)))));
+    runnerWithRealScorer.run(2, new char*[3]{
+            (char*) "./runner",
+            (char*) "grade",
+            nullptr});
+}
+
+TEST_F(BatchRunnerTests, Run_Grading_EvaluatorRegistry_RealScorer_PreciseEpsilon) {
+    EXPECT_CALL(evaluatorRegistry, get("batch", _, _, AllOf(
+            Property(&EvaluatorConfig::builtInScorer, Eq(optional<ScoringStyle>(ScoringStyle::REAL))),
+            Property(&EvaluatorConfig::scorerEpsilon, Eq(1.2345678e-9)))));
+    runnerWithPreciseRealScorer.run(2, new char*[3]{
+            (char*) "./runner",
+            (char*) "grade",
+            nullptr});
+}
+
+TEST_F(BatchRunnerTests, Run_Grading_EvaluatorRegistry_CustomScorer_NoBuiltInScorer) {
+    EXPECT_CALL(evaluatorRegistry, get("batch", _, _, Property(
+            &EvaluatorConfig::builtInScorer, Eq(optional<ScoringStyle>()))));
+    runnerWithCustomScorer.run(2, new char*[3]{
+            (char*) "./runner",
+            (char*) "grade",
+            nullptr});
+}
+
 }
@@ -42,7 +42,8 @@ TEST_F(InteractiveRunnerTests, Run_Generation_EvaluatorRegistry_Communicator_Def
     EXPECT_CALL(evaluatorRegistry, get(
             "interactive",
             _,
-            Truly(HelperKeyIs("communicator", RunnerDefaults::COMMUNICATOR_COMMAND))));
+            Truly(HelperKeyIs("communicator", RunnerDefaults::COMMUNICATOR_COMMAND)),
+            _));
 
     runner.run(argc, argv);
 }
@@ -51,7 +52,8 @@ TEST_F(InteractiveRunnerTests, Run_Generation_EvaluatorRegistry_Communicator_Arg
     EXPECT_CALL(evaluatorRegistry, get(
             "interactive",
             _,
-            Truly(HelperKeyIs("communicator",  "\"java Communicator\""))));
+            Truly(HelperKeyIs("communicator",  "\"java Communicator\"")),
+            _));
     
     runner.run(2, new char*[3]{
             (char*) "./runner",
@@ -63,7 +65,8 @@ TEST_F(InteractiveRunnerTests, Run_Grading_EvaluatorRegistry_Communicator_Defaul
     EXPECT_CALL(evaluatorRegistry, get(
             "interactive",
             _,
-            Truly(HelperKeyIs("communicator", RunnerDefaults::COMMUNICATOR_COMMAND))));
+            Truly(HelperKeyIs("communicator", RunnerDefaults::COMMUNICATOR_COMMAND)),
+            _));
 
     runner.run(2, new char*[3]{
             (char*) "./runner",
@@ -75,7 +78,8 @@ TEST_F(InteractiveRunnerTests, Run_Grading_EvaluatorRegistry_Communicator_Args)
     EXPECT_CALL(evaluatorRegistry, get(
             "interactive",
             _,
-            Truly(HelperKeyIs("communicator", "\"java Communicator\""))));
+            Truly(HelperKeyIs("communicator", "\"java Communicator\"")),
+            _));
 
     runner.run(3, new char*[4]{
             (char*) "./runner",
@@ -36,13 +36,25 @@ protected:
         }
     };
 
+    class ProblemSpecWithConstraints : public ProblemSpec {
+    protected:
+        int N;
+
+        void Constraints() {
+            CONS(1 <= N);
+        }
+    };
+
     class TestSpec : public BaseTestSpec<ProblemSpec> {};
     class TestSpecWithConfig : public BaseTestSpec<ProblemSpecWithConfig> {};
     class TestSpecWithSubtasks : public BaseTestSpec<ProblemSpecWithSubtasks> {};
+    class TestSpecWithConstraints : public BaseTestSpec<ProblemSpecWithConstraints> {};
 
     Runner<ProblemSpec> runner = BaseRunnerTests::createRunner(new TestSpec());
     Runner<ProblemSpecWithConfig> runnerWithConfig = BaseRunnerTests::createRunner(new TestSpecWithConfig());
     Runner<ProblemSpecWithSubtasks> runnerWithSubtasks = BaseRunnerTests::createRunner(new TestSpecWithSubtasks());
+    Runner<ProblemSpecWithConstraints> runnerWithConstraints =
+            BaseRunnerTests::createRunner(new TestSpecWithConstraints());
 };
 
 int RunnerTests::T;
@@ -116,6 +128,157 @@ TEST_F(RunnerTests, Run_Generation_UseArgsOptions) {
             nullptr});
 }
 
+TEST_F(RunnerTests, Run_Generation_Parallel) {
+    EXPECT_CALL(generator, generate(GenerationOptionsBuilder("slug")
+            .setSeed(RunnerDefaults::SEED)
+            .setSeedsPerTestCase(true)
+            .setSolutionCommand(RunnerDefaults::SOLUTION_COMMAND)
+            .setOutputDir(RunnerDefaults::OUTPUT_DIR)
+            .setHasTcOutput(StyleConfig::DEFAULT_HAS_TC_OUTPUT)
+            .setJobs(4)
+            .build()));
+
+    runner.run(3, new char*[4]{
+            (char*) "./runner",
+            (char*) "--jobs=4",
+            (char*) "--seed-per-test-case",
+            nullptr});
+}
+
+TEST_F(RunnerTests, Run_Generation_Streaming) {
+    EXPECT_CALL(generator, generate(GenerationOptionsBuilder("slug")
+            .setSeed(RunnerDefaults::SEED)
+            .setSolutionCommand(RunnerDefaults::SOLUTION_COMMAND)
+            .setOutputDir(RunnerDefaults::OUTPUT_DIR)
+            .setHasTcOutput(StyleConfig::DEFAULT_HAS_TC_OUTPUT)
+            .setStreamsMultipleTestCases(true)
+            .build()));
+
+    runner.run(2, new char*[3]{
+            (char*) "./runner",
+            (char*) "--stream",
+            nullptr});
+}
+
+TEST_F(RunnerTests, Run_Generation_OutputCache) {
+    EXPECT_CALL(generator, generate(GenerationOptionsBuilder("slug")
+            .setSeed(RunnerDefaults::SEED)
+            .setSolutionCommand(RunnerDefaults::SOLUTION_COMMAND)
+            .setOutputDir(RunnerDefaults::OUTPUT_DIR)
+            .setHasTcOutput(StyleConfig::DEFAULT_HAS_TC_OUTPUT)
+            .setOutputCache(".tccache", RunnerDefaults::OUTPUT_CACHE_SIZE_MB)
+            .build()));
+
+    runner.run(2, new char*[3]{
+            (char*) "./runner",
+            (char*) "--output-cache=.tccache",
+            nullptr});
+}
+
+TEST_F(RunnerTests, Run_Generation_OutputCache_WithSize) {
+    EXPECT_CALL(generator, generate(GenerationOptionsBuilder("slug")
+            .setSeed(RunnerDefaults::SEED)
+            .setSolutionCommand(RunnerDefaults::SOLUTION_COMMAND)
+            .setOutputDir(RunnerDefaults::OUTPUT_DIR)
+            .setHasTcOutput(StyleConfig::DEFAULT_HAS_TC_OUTPUT)
+            .setOutputCache(".tccache", 100)
+            .build()));
+
+    runner.run(3, new char*[4]{
+            (char*) "./runner",
+            (char*) "--output-cache=.tccache",
+            (char*) "--output-cache-size=100",
+            nullptr});
+}
+
+TEST_F(RunnerTests, Run_Generation_SeedPerTestCase) {
+    EXPECT_CALL(generator, generate(GenerationOptionsBuilder("slug")
+            .setSeed(RunnerDefaults::SEED)
+            .setSeedsPerTestCase(true)
+            .setSolutionCommand(RunnerDefaults::SOLUTION_COMMAND)
+            .setOutputDir(RunnerDefaults::OUTPUT_DIR)
+            .setHasTcOutput(StyleConfig::DEFAULT_HAS_TC_OUTPUT)
+            .build()));
+
+    runner.run(2, new char*[3]{
+            (char*) "./runner",
+            (char*) "--seed-per-test-case",
+            nullptr});
+}
+
+TEST_F(RunnerTests, Run_Generation_Incremental) {
+    Hasher hasher;
+    hasher.addCommand(RunnerDefaults::SOLUTION_COMMAND);
+
+    EXPECT_CALL(generator, generate(GenerationOptionsBuilder("slug")
+            .setSeed(RunnerDefaults::SEED)
+            .setSeedsPerTestCase(true)
+            .setSolutionCommand(RunnerDefaults::SOLUTION_COMMAND)
+            .setOutputDir(RunnerDefaults::OUTPUT_DIR)
+            .setHasTcOutput(StyleConfig::DEFAULT_HAS_TC_OUTPUT)
+            .setIncremental(hasher.hex())
+            .build()));
+
+    runner.run(3, new char*[4]{
+            (char*) "./runner",
+            (char*) "--incremental",
+            (char*) "--seed-per-test-case",
+            nullptr});
+}
+
+TEST_F(RunnerTests, Run_Generation_Incremental_WithConstraints) {
+    Hasher hasher;
+    hasher.add(StringUtils::toString(Subtask::MAIN_ID)).add("1 <= N");
+    hasher.addCommand(RunnerDefaults::SOLUTION_COMMAND);
+
+    EXPECT_CALL(generator, generate(GenerationOptionsBuilder("slug")
+            .setSeed(RunnerDefaults::SEED)
+            .setSeedsPerTestCase(true)
+            .setSolutionCommand(RunnerDefaults::SOLUTION_COMMAND)
+            .setOutputDir(RunnerDefaults::OUTPUT_DIR)
+            .setHasTcOutput(StyleConfig::DEFAULT_HAS_TC_OUTPUT)
+            .setIncremental(hasher.hex())
+            .build()));
+
+    runnerWithConstraints.run(3, new char*[4]{
+            (char*) "./runner",
+            (char*) "--incremental",
+            (char*) "--seed-per-test-case",
+            nullptr});
+}
+
+TEST_F(RunnerTests, Run_Generation_Incremental_Paranoid) {
+    Hasher hasher;
+    hasher.addCommand(RunnerDefaults::SOLUTION_COMMAND);
+    if (!hasher.addFile("/proc/self/exe")) {
+        hasher.addFile("./runner");
+    }
+
+    EXPECT_CALL(generator, generate(GenerationOptionsBuilder("slug")
+            .setSeed(RunnerDefaults::SEED)
+            .setSeedsPerTestCase(true)
+            .setSolutionCommand(RunnerDefaults::SOLUTION_COMMAND)
+            .setOutputDir(RunnerDefaults::OUTPUT_DIR)
+            .setHasTcOutput(StyleConfig::DEFAULT_HAS_TC_OUTPUT)
+            .setIncremental(hasher.hex())
+            .build()));
+
+    runner.run(3, new char*[4]{
+            (char*) "./runner",
+            (char*) "--incremental=paranoid",
+            (char*) "--seed-per-test-case",
+            nullptr});
+}
+
+TEST_F(RunnerTests, Run_Generation_JsonLogger) {
+    EXPECT_CALL(generatorFactory, create(_, _, _, WhenDynamicCastTo<JsonGeneratorLogger*>(NotNull()), NotNull()));
+
+    runner.run(2, new char*[3]{
+            (char*) "./runner",
+            (char*) "--format=json",
+            nullptr});
+}
+
 TEST_F(RunnerTests, Run_Grading) {
     EXPECT_CALL(grader, grade(_));
 
@@ -129,7 +292,7 @@ TEST_F(RunnerTests, Run_Grading) {
 
 TEST_F(RunnerTests, Run_Grading_UseDefaultOptions) {
     EXPECT_CALL(grader, grade(GradingOptionsBuilder("slug")
-            .setTimeLimit(GradingConfig::DEFAULT_TIME_LIMIT)
+            .setTimeLimit(GradingConfig::DEFAULT_TIME_LIMIT_MS)
             .setMemoryLimit(GradingConfig::DEFAULT_MEMORY_LIMIT)
             .setSolutionCommand(RunnerDefaults::SOLUTION_COMMAND)
             .setOutputDir(RunnerDefaults::OUTPUT_DIR)
@@ -145,7 +308,7 @@ TEST_F(RunnerTests, Run_Grading_UseConfigOptions) {
     EXPECT_CALL(grader, grade(GradingOptionsBuilder("slug")
             .setSolutionCommand(RunnerDefaults::SOLUTION_COMMAND)
             .setOutputDir(RunnerDefaults::OUTPUT_DIR)
-            .setTimeLimit(3)
+            .setTimeLimit(3000)
             .setMemoryLimit(128)
             .build()));
 
@@ -159,7 +322,7 @@ TEST_F(RunnerTests, Run_Grading_UseArgsOptions) {
     EXPECT_CALL(grader, grade(GradingOptionsBuilder("slug")
             .setSolutionCommand("\"java Solution\"")
             .setOutputDir("testdata")
-            .setTimeLimit(4)
+            .setTimeLimit(4000)
             .setMemoryLimit(256)
             .build()));
 
@@ -173,6 +336,53 @@ TEST_F(RunnerTests, Run_Grading_UseArgsOptions) {
             nullptr});
 }
 
+TEST_F(RunnerTests, Run_Grading_UseArgsOptions_TimeLimitMs) {
+    EXPECT_CALL(grader, grade(GradingOptionsBuilder("slug")
+            .setSolutionCommand(RunnerDefaults::SOLUTION_COMMAND)
+            .setOutputDir(RunnerDefaults::OUTPUT_DIR)
+            .setTimeLimit(1500)
+            .setMemoryLimit(128)
+            .build()));
+
+    runnerWithConfig.run(3, new char*[4]{
+            (char*) "./runner",
+            (char*) "grade",
+            (char*) "--time-limit-ms=1500",
+            nullptr});
+}
+
+TEST_F(RunnerTests, Run_Grading_UseArgsOptions_RssMemoryLimit) {
+    EXPECT_CALL(grader, grade(GradingOptionsBuilder("slug")
+            .setSolutionCommand(RunnerDefaults::SOLUTION_COMMAND)
+            .setOutputDir(RunnerDefaults::OUTPUT_DIR)
+            .setTimeLimit(3000)
+            .setMemoryLimit(128)
+            .setRssMemoryLimit(true)
+            .build()));
+
+    runnerWithConfig.run(3, new char*[4]{
+            (char*) "./runner",
+            (char*) "grade",
+            (char*) "--rss-memory-limit",
+            nullptr});
+}
+
+TEST_F(RunnerTests, Run_Grading_UseArgsOptions_StopOnFirstFailure) {
+    EXPECT_CALL(grader, grade(GradingOptionsBuilder("slug")
+            .setSolutionCommand(RunnerDefaults::SOLUTION_COMMAND)
+            .setOutputDir(RunnerDefaults::OUTPUT_DIR)
+            .setTimeLimit(3000)
+            .setMemoryLimit(128)
+            .setStopsOnFirstFailure(true)
+            .build()));
+
+    runnerWithConfig.run(3, new char*[4]{
+            (char*) "./runner",
+            (char*) "grade",
+            (char*) "--stop-on-first-failure",
+            nullptr});
+}
+
 TEST_F(RunnerTests, Run_Grading_UseArgsOptions_NoLimits) {
     EXPECT_CALL(grader, grade(GradingOptionsBuilder("slug")
             .setSolutionCommand("\"java Solution\"")
@@ -192,7 +402,7 @@ TEST_F(RunnerTests, Run_Grading_UseArgsOptions_NoLimits) {
 TEST_F(RunnerTests, Run_Grading_WithSubtasks) {
     EXPECT_CALL(grader, grade(GradingOptionsBuilder("slug")
             .setSubtaskPoints({70, 30})
-            .setTimeLimit(GradingConfig::DEFAULT_TIME_LIMIT)
+            .setTimeLimit(GradingConfig::DEFAULT_TIME_LIMIT_MS)
             .setMemoryLimit(GradingConfig::DEFAULT_MEMORY_LIMIT)
             .setSolutionCommand(RunnerDefaults::SOLUTION_COMMAND)
             .setOutputDir(RunnerDefaults::OUTPUT_DIR)
@@ -223,6 +433,54 @@ TEST_F(RunnerTests, Run_Grading_BriefLogger) {
             nullptr});
 }
 
+TEST_F(RunnerTests, Run_Grading_JsonLogger) {
+    EXPECT_CALL(graderLoggerFactory, create(_, _)).Times(0);
+    EXPECT_CALL(graderLoggerFactory, createJson(NotNull()));
+
+    runner.run(4, new char*[5]{
+            (char*) "./runner",
+            (char*) "grade",
+            (char*) "--brief",
+            (char*) "--format=json",
+            nullptr});
+}
+
+TEST_F(RunnerTests, Run_Grading_SingleThread) {
+    EXPECT_CALL(evaluatorRegistry, get(_, _, _, _, _)).Times(0);
+    EXPECT_CALL(graderFactory, create(_, _, _, _, _, SizeIs(0), _));
+
+    runner.run(2, new char*[3]{
+            (char*) "./runner",
+            (char*) "grade",
+            nullptr});
+}
+
+TEST_F(RunnerTests, Run_Grading_MultipleThreads) {
+    EXPECT_CALL(os, forceMakeDir("__tcframe_worker_1"));
+    EXPECT_CALL(os, forceMakeDir("__tcframe_worker_2"));
+    EXPECT_CALL(evaluatorRegistry, get("batch", _, _, _, "__tcframe_worker_1"));
+    EXPECT_CALL(evaluatorRegistry, get("batch", _, _, _, "__tcframe_worker_2"));
+    EXPECT_CALL(graderFactory, create(_, _, _, _, _, SizeIs(2), _));
+
+    runner.run(3, new char*[4]{
+            (char*) "./runner",
+            (char*) "grade",
+            (char*) "--threads=2",
+            nullptr});
+}
+
+TEST_F(RunnerTests, Run_Grading_Reordered) {
+    EXPECT_CALL(evaluatorRegistry, get(_, _, _, _, _)).Times(0);
+    EXPECT_CALL(graderFactory, create(_, _, _, _, _, SizeIs(0), NotNull()));
+    EXPECT_CALL(grader, grade(Property(&GradingOptions::order, Eq(GradingOrder::FAILING_FIRST))));
+
+    runner.run(3, new char*[4]{
+            (char*) "./runner",
+            (char*) "grade",
+            (char*) "--order=failing-first",
+            nullptr});
+}
+
 TEST_F(RunnerTests, Run_AggregatorRegistry) {
     EXPECT_CALL(aggregatorRegistry, getTestCaseAggregator(false));
     runner.run(2, new char*[3]{
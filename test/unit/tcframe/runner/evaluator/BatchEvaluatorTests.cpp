@@ -30,6 +30,7 @@ protected:
             .setSolutionCommand("python Sol.py")
             .setTimeLimit(3)
             .setMemoryLimit(128)
+            .setRssMemoryLimit(true)
             .build();
 
     BatchEvaluator evaluator = {&os, &testCaseVerdictParser, &scorer};
@@ -37,7 +38,7 @@ protected:
     void SetUp() {
         ON_CALL(os, execute(_))
                 .WillByDefault(Return(ExecutionResult()));
-        ON_CALL(testCaseVerdictParser, parseExecutionResult(_))
+        ON_CALL(testCaseVerdictParser, parseExecutionResult(_, _))
                 .WillByDefault(Return(optional<TestCaseVerdict>()));
         ON_CALL(scorer, score(_, _, _))
                 .WillByDefault(Return(ScoringResult(TestCaseVerdict(), ExecutionResult())));
@@ -51,6 +52,7 @@ TEST_F(BatchEvaluatorTests, Evaluation_AC) {
             .setOutputFilename(Evaluator::EVALUATION_OUT_FILENAME)
             .setTimeLimit(3)
             .setMemoryLimit(128)
+            .setRssMemoryLimit(true)
             .build();
     {
         InSequence sequence;
@@ -63,6 +65,19 @@ TEST_F(BatchEvaluatorTests, Evaluation_AC) {
             {{"solution", ExecutionResult()}, {"scorer", ExecutionResult()}})));
 }
 
+TEST_F(BatchEvaluatorTests, Evaluation_InSandbox) {
+    BatchEvaluator sandboxedEvaluator(&os, &testCaseVerdictParser, &scorer, "__tcframe_worker_1");
+    {
+        InSequence sequence;
+        EXPECT_CALL(os, execute(Property(
+                &ExecutionRequest::outputFilename,
+                Eq(optional<string>("__tcframe_worker_1/__tcframe_evaluation.out")))));
+        EXPECT_CALL(scorer, score("dir/foo_1.in", "dir/foo_1.out", "__tcframe_worker_1/__tcframe_evaluation.out"));
+    }
+
+    sandboxedEvaluator.evaluate("dir/foo_1.in", "dir/foo_1.out", options);
+}
+
 TEST_F(BatchEvaluatorTests, Evaluation_FromScorer) {
     ON_CALL(scorer, score(_, _, _))
             .WillByDefault(Return(ScoringResult(TestCaseVerdict(Verdict::wa()), ExecutionResult())));
@@ -78,7 +93,7 @@ TEST_F(BatchEvaluatorTests, Evaluation_FromScorer) {
 }
 
 TEST_F(BatchEvaluatorTests, Evaluation_FromSolution) {
-    ON_CALL(testCaseVerdictParser, parseExecutionResult(_))
+    ON_CALL(testCaseVerdictParser, parseExecutionResult(_, _))
             .WillByDefault(Return(optional<TestCaseVerdict>(TestCaseVerdict(Verdict::rte()))));
     {
         InSequence sequence;
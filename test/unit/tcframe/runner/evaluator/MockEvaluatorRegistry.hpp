@@ -11,7 +11,17 @@ public:
     MockEvaluatorRegistry()
             : EvaluatorRegistry(nullptr) {}
 
-    MOCK_METHOD3(get, Evaluator*(const string&, OperatingSystem*, const map<string, string>&));
+    MOCK_METHOD4(get, Evaluator*(
+            const string&,
+            OperatingSystem*,
+            const map<string, string>&,
+            const EvaluatorConfig&));
+    MOCK_METHOD5(get, Evaluator*(
+            const string&,
+            OperatingSystem*,
+            const map<string, string>&,
+            const EvaluatorConfig&,
+            const string&));
 };
 
 }
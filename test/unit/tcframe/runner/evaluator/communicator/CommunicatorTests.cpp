@@ -29,7 +29,7 @@ protected:
     void SetUp() {
         ON_CALL(os, execute(_)).WillByDefault(Return(ExecutionResultBuilder().setStandardError("AC\n").build()));
         ON_CALL(os, openForReading(_)).WillByDefault(Return(new istringstream()));
-        ON_CALL(testCaseVerdictParser, parseExecutionResult(_)).WillByDefault(Return(optional<TestCaseVerdict>()));
+        ON_CALL(testCaseVerdictParser, parseExecutionResult(_, _)).WillByDefault(Return(optional<TestCaseVerdict>()));
         ON_CALL(testCaseVerdictParser, parseStream(_)).WillByDefault(Return(TestCaseVerdict(Verdict::ac())));
     }
 };
@@ -45,7 +45,7 @@ TEST_F(CommunicatorTests, Communication_Crashed) {
             .setStandardError("crashed")
             .build();
     ON_CALL(os, execute(_)).WillByDefault(Return(executionResult));
-    ON_CALL(testCaseVerdictParser, parseExecutionResult(_))
+    ON_CALL(testCaseVerdictParser, parseExecutionResult(_, _))
             .WillByDefault(Return(optional<TestCaseVerdict>(TestCaseVerdict(Verdict::rte()))));
 
     EXPECT_THAT(communicator.communicate("1.in", options), Eq(
@@ -54,7 +54,7 @@ TEST_F(CustomScorerTests, Scoring_UnknownVerdict) {
 
     EXPECT_THAT(scorer.score("1.in", "1.out", "eval.out"), Eq(
             ScoringResult(TestCaseVerdict(Verdict::err()), ExecutionResultBuilder()
-                    .setStandardError("bogus\nerr").build())));
+                    .setStandardError("err\nbogus").build())));
 }
 
 }
@@ -0,0 +1,114 @@
+#include "gmock/gmock.h"
+#include "../../../mock.hpp"
+
+#include <map>
+#include <sstream>
+
+#include "../../os/MockOperatingSystem.hpp"
+#include "tcframe/runner/evaluator/scorer/DiffScorer.hpp"
+
+using ::testing::_;
+using ::testing::Eq;
+using ::testing::Invoke;
+using ::testing::IsEmpty;
+using ::testing::Test;
+
+using std::ios;
+using std::istringstream;
+using std::map;
+
+namespace tcframe {
+
+class DiffScorerTests : public Test {
+protected:
+    MOCK(OperatingSystem) os;
+
+    map<string, string> files;
+
+    DiffScorer scorer = DiffScorer(&os);
+
+    void SetUp() {
+        ON_CALL(os, openForReading(_)).WillByDefault(Invoke([&] (const string& filename) {
+            if (!files.count(filename)) {
+                auto in = new istringstream();
+                in->setstate(ios::failbit);
+                return in;
+            }
+            return new istringstream(files[filename]);
+        }));
+    }
+
+    ScoringResult score(const string& expected, const string& received) {
+        files["1.out"] = expected;
+        files["eval.out"] = received;
+        return scorer.score("1.in", "1.out", "eval.out");
+    }
+};
+
+TEST_F(DiffScorerTests, Scoring_AC) {
+    ScoringResult result = score("yes\n1 2 3\n", "yes\n1 2 3\n");
+
+    EXPECT_THAT(result.verdict(), Eq(TestCaseVerdict(Verdict::ac())));
+    EXPECT_THAT(result.executionResult().standardError(), IsEmpty());
+}
+
+TEST_F(DiffScorerTests, Scoring_AC_Large) {
+    string output(300000, 'x');
+    ScoringResult result = score(output, output);
+
+    EXPECT_THAT(result.verdict(), Eq(TestCaseVerdict(Verdict::ac())));
+}
+
+TEST_F(DiffScorerTests, Scoring_WA) {
+    ScoringResult result = score("a\nb\nc\nd\ne\n", "a\nb\nc\nx\ne\n");
+
+    EXPECT_THAT(result.verdict(), Eq(TestCaseVerdict(Verdict::wa())));
+    EXPECT_THAT(result.executionResult().standardError(), Eq(
+            "Diff:\n"
+            " 02    b\n"
+            " 03    c\n"
+            "(expected) [line 04]    d\n"
+            "(received) [line 04]    x\n"));
+}
+
+TEST_F(DiffScorerTests, Scoring_WA_AfterFirstChunk) {
+    string prefix = string(100000, 'x') + "\n";
+    ScoringResult result = score(prefix + "1 2 3\n", prefix + "1 4 5\n");
+
+    EXPECT_THAT(result.verdict(), Eq(TestCaseVerdict(Verdict::wa())));
+    EXPECT_THAT(result.executionResult().standardError(), Eq(
+            "Diff:\n"
+            " 01    " + string(100000, 'x') + "\n"
+            "(expected) [line 02]    1 2 3\n"
+            "(received) [line 02]    1 4 5\n"));
+}
+
+TEST_F(DiffScorerTests, Scoring_WA_MissingLine) {
+    ScoringResult result = score("1\n2\n", "1\n");
+
+    EXPECT_THAT(result.verdict(), Eq(TestCaseVerdict(Verdict::wa())));
+    EXPECT_THAT(result.executionResult().standardError(), Eq(
+            "Diff:\n"
+            " 01    1\n"
+            "(expected) [line 02]    2\n"));
+}
+
+TEST_F(DiffScorerTests, Scoring_WA_ExtraLine) {
+    ScoringResult result = score("1\n", "1\n2\n");
+
+    EXPECT_THAT(result.verdict(), Eq(TestCaseVerdict(Verdict::wa())));
+    EXPECT_THAT(result.executionResult().standardError(), Eq(
+            "Diff:\n"
+            " 01    1\n"
+            "(received) [line 02]    2\n"));
+}
+
+TEST_F(DiffScorerTests, Scoring_ERR_MissingOutput) {
+    files["eval.out"] = "1\n";
+    ScoringResult result = scorer.score("1.in", "1.out", "eval.out");
+
+    EXPECT_THAT(result.verdict(), Eq(TestCaseVerdict(Verdict::err())));
+    EXPECT_THAT(result.executionResult().standardError(), Eq("Cannot open file: 1.out"));
+}
+
+}
@@ -0,0 +1,95 @@
+#include "gmock/gmock.h"
+#include "../../../mock.hpp"
+
+#include <map>
+#include <sstream>
+
+#include "../../os/MockOperatingSystem.hpp"
+#include "tcframe/runner/evaluator/scorer/RealScorer.hpp"
+
+using ::testing::_;
+using ::testing::Eq;
+using ::testing::Invoke;
+using ::testing::IsEmpty;
+using ::testing::Test;
+
+using std::istringstream;
+using std::map;
+
+namespace tcframe {
+
+class RealScorerTests : public Test {
+protected:
+    MOCK(OperatingSystem) os;
+
+    map<string, string> files;
+
+    RealScorer scorer = RealScorer(&os, 1e-6);
+
+    void SetUp() {
+        ON_CALL(os, openForReading(_)).WillByDefault(Invoke([&] (const string& filename) {
+            return new istringstream(files[filename]);
+        }));
+    }
+
+    ScoringResult score(const string& expected, const string& received) {
+        files["1.out"] = expected;
+        files["eval.out"] = received;
+        return scorer.score("1.in", "1.out", "eval.out");
+    }
+};
+
+TEST_F(RealScorerTests, Scoring_AC) {
+    ScoringResult result = score("3.14159265\n", "3.14159265\n");
+
+    EXPECT_THAT(result.verdict(), Eq(TestCaseVerdict(Verdict::ac())));
+    EXPECT_THAT(result.executionResult().standardError(), IsEmpty());
+}
+
+TEST_F(RealScorerTests, Scoring_AC_WithinAbsoluteError) {
+    ScoringResult result = score("0.5 2\n", "0.5000009 2.0000001\n");
+
+    EXPECT_THAT(result.verdict(), Eq(TestCaseVerdict(Verdict::ac())));
+}
+
+TEST_F(RealScorerTests, Scoring_AC_WithinRelativeError) {
+    ScoringResult result = score("1000000000\n", "1000000900.5\n");
+
+    EXPECT_THAT(result.verdict(), Eq(TestCaseVerdict(Verdict::ac())));
+}
+
+TEST_F(RealScorerTests, Scoring_AC_NonNumericTokens) {
+    ScoringResult result = score("Case #1: 2.5\n", "Case   #1:  2.50000\n");
+
+    EXPECT_THAT(result.verdict(), Eq(TestCaseVerdict(Verdict::ac())));
+}
+
+TEST_F(RealScorerTests, Scoring_WA) {
+    ScoringResult result = score("1.5\n0.25\n", "1.5\n0.2501\n");
+
+    EXPECT_THAT(result.verdict(), Eq(TestCaseVerdict(Verdict::wa())));
+    EXPECT_THAT(result.executionResult().standardError(), Eq(
+            "Token mismatch at token 2:\n"
+            "(expected) [line 02]    0.25\n"
+            "(received) [line 02]    0.2501\n"));
+}
+
+TEST_F(RealScorerTests, Scoring_WA_NotANumber) {
+    ScoringResult result = score("1.5\n", "1.5x\n");
+
+    EXPECT_THAT(result.verdict(), Eq(TestCaseVerdict(Verdict::wa())));
+}
+
+TEST_F(RealScorerTests, Scoring_WA_NonNumericTokens) {
+    ScoringResult result = score("YES\n", "yes\n");
+
+    EXPECT_THAT(result.verdict(), Eq(TestCaseVerdict(Verdict::wa())));
+}
+
+TEST_F(RealScorerTests, Scoring_WA_MissingToken) {
+    ScoringResult result = score("1 2\n", "1\n");
+
+    EXPECT_THAT(result.verdict(), Eq(TestCaseVerdict(Verdict::wa())));
+}
+
+}
@@ -0,0 +1,117 @@
+#include "gmock/gmock.h"
+#include "../../../mock.hpp"
+
+#include <map>
+#include <sstream>
+
+#include "../../os/MockOperatingSystem.hpp"
+#include "tcframe/runner/evaluator/scorer/TokenScorer.hpp"
+
+using ::testing::_;
+using ::testing::Eq;
+using ::testing::Invoke;
+using ::testing::IsEmpty;
+using ::testing::Test;
+
+using std::ios;
+using std::istringstream;
+using std::map;
+
+namespace tcframe {
+
+class TokenScorerTests : public Test {
+protected:
+    MOCK(OperatingSystem) os;
+
+    map<string, string> files;
+
+    TokenScorer scorer = TokenScorer(&os);
+
+    void SetUp() {
+        ON_CALL(os, openForReading(_)).WillByDefault(Invoke([&] (const string& filename) {
+            if (!files.count(filename)) {
+                auto in = new istringstream();
+                in->setstate(ios::failbit);
+                return in;
+            }
+            return new istringstream(files[filename]);
+        }));
+    }
+
+    ScoringResult score(const string& expected, const string& received) {
+        files["1.out"] = expected;
+        files["eval.out"] = received;
+        return scorer.score("1.in", "1.out", "eval.out");
+    }
+};
+
+TEST_F(TokenScorerTests, Scoring_AC) {
+    ScoringResult result = score("yes\n1 2 3\n", "yes\n1 2 3\n");
+
+    EXPECT_THAT(result.verdict(), Eq(TestCaseVerdict(Verdict::ac())));
+    EXPECT_THAT(result.executionResult().standardError(), IsEmpty());
+}
+
+TEST_F(TokenScorerTests, Scoring_AC_DifferentWhitespaces) {
+    ScoringResult result = score("yes\n1 2 3\n", "  yes 1\t2\r\n3  \n\n\n");
+
+    EXPECT_THAT(result.verdict(), Eq(TestCaseVerdict(Verdict::ac())));
+    EXPECT_THAT(result.executionResult().standardError(), IsEmpty());
+}
+
+TEST_F(TokenScorerTests, Scoring_AC_Empty) {
+    ScoringResult result = score("", "\n \n");
+
+    EXPECT_THAT(result.verdict(), Eq(TestCaseVerdict(Verdict::ac())));
+}
+
+TEST_F(TokenScorerTests, Scoring_AC_LongTokensAcrossChunks) {
+    string output = string(100000, 'x') + " " + string(100000, 'y') + "\n";
+    ScoringResult result = score(output, " " + output);
+
+    EXPECT_THAT(result.verdict(), Eq(TestCaseVerdict(Verdict::ac())));
+}
+
+TEST_F(TokenScorerTests, Scoring_WA) {
+    ScoringResult result = score("a b\nc d\n", "a b\n\nc x\n");
+
+    EXPECT_THAT(result.verdict(), Eq(TestCaseVerdict(Verdict::wa())));
+    EXPECT_THAT(result.executionResult().standardError(), Eq(
+            "Token mismatch at token 4:\n"
+            "(expected) [line 02]    d\n"
+            "(received) [line 03]    x\n"));
+}
+
+TEST_F(TokenScorerTests, Scoring_WA_LongTokensAcrossChunks) {
+    ScoringResult result = score(string(100000, 'x') + "y\n", string(100000, 'x') + "z\n");
+
+    EXPECT_THAT(result.verdict(), Eq(TestCaseVerdict(Verdict::wa())));
+}
+
+TEST_F(TokenScorerTests, Scoring_WA_MissingToken) {
+    ScoringResult result = score("1 2\n", "1\n");
+
+    EXPECT_THAT(result.verdict(), Eq(TestCaseVerdict(Verdict::wa())));
+    EXPECT_THAT(result.executionResult().standardError(), Eq(
+            "Token mismatch at token 2:\n"
+            "(expected) [line 01]    2\n"));
+}
+
+TEST_F(TokenScorerTests, Scoring_WA_ExtraToken) {
+    ScoringResult result = score("1\n", "1\n2\n");
+
+    EXPECT_THAT(result.verdict(), Eq(TestCaseVerdict(Verdict::wa())));
+    EXPECT_THAT(result.executionResult().standardError(), Eq(
+            "Token mismatch at token 2:\n"
+            "(received) [line 02]    2\n"));
+}
+
+TEST_F(TokenScorerTests, Scoring_ERR_MissingOutput) {
+    files["eval.out"] = "1\n";
+    ScoringResult result = scorer.score("1.in", "1.out", "eval.out");
+
+    EXPECT_THAT(result.verdict(), Eq(TestCaseVerdict(Verdict::err())));
+    EXPECT_THAT(result.executionResult().standardError(), Eq("Cannot open file: 1.out"));
+}
+
+}
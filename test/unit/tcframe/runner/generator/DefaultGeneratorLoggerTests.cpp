@@ -66,6 +66,12 @@ TEST_F(DefaultGeneratorLoggerTests, TestCaseResult_Failed_WithoutDescription) {
     logger.logTestCaseFailedResult(optional<string>());
 }
 
+TEST_F(DefaultGeneratorLoggerTests, TestCaseResult_Unchanged) {
+    EXPECT_CALL(engine, logParagraph(0, "OK (unchanged)"));
+
+    logger.logTestCaseUnchangedResult();
+}
+
 TEST_F(DefaultGeneratorLoggerTests, MultipleTestCasesCombinationIntroduction) {
     EXPECT_CALL(engine, logHangingParagraph(1, "Combining test cases into a single file (foo_3): "));
 
@@ -87,4 +93,13 @@ TEST_F(DefaultGeneratorLoggerTests, MultipleTestCasesCombinationResult_Failed) {
     logger.logMultipleTestCasesCombinationFailedResult();
 }
 
+TEST_F(DefaultGeneratorLoggerTests, OutputCacheStatistics) {
+    {
+        InSequence sequence;
+        EXPECT_CALL(engine, logParagraph(0, ""));
+        EXPECT_CALL(engine, logParagraph(0, "Solution output cache: 3 hit(s), 2 miss(es)."));
+    }
+    logger.logOutputCacheStatistics(3, 2);
+}
+
 }
@@ -0,0 +1,46 @@
+#include "gmock/gmock.h"
+
+#include <sstream>
+
+#include "tcframe/runner/generator/GenerationManifest.hpp"
+
+using ::testing::Eq;
+using ::testing::Test;
+
+using std::istringstream;
+using std::ostringstream;
+
+namespace tcframe {
+
+class GenerationManifestTests : public Test {};
+
+TEST_F(GenerationManifestTests, Get) {
+    GenerationManifest manifest;
+    manifest.put("foo_1", {"abc", "def"});
+
+    EXPECT_THAT(manifest.get("foo_1"), Eq(optional<GenerationManifestEntry>({"abc", "def"})));
+    EXPECT_FALSE(manifest.get("foo_2"));
+}
+
+TEST_F(GenerationManifestTests, ReadAndWrite) {
+    GenerationManifest manifest;
+    manifest.put("foo_2", {"123", "456"});
+    manifest.put("foo_1", {"abc", "def"});
+
+    ostringstream out;
+    manifest.write(&out);
+    EXPECT_THAT(out.str(), Eq("foo_1 abc def\nfoo_2 123 456\n"));
+
+    istringstream in(out.str());
+    EXPECT_THAT(GenerationManifest::read(&in), Eq(manifest));
+}
+
+TEST_F(GenerationManifestTests, Read_Malformed) {
+    istringstream in("foo_1 abc def\nfoo_2\n");
+    GenerationManifest manifest = GenerationManifest::read(&in);
+
+    EXPECT_TRUE(manifest.get("foo_1"));
+    EXPECT_FALSE(manifest.get("foo_2"));
+}
+
+}
@@ -1,22 +1,33 @@
 #include "gmock/gmock.h"
 #include "../../mock.hpp"
 
+#include <map>
+#include <sstream>
+#include <vector>
+
 #include "../client/MockSpecClient.hpp"
 #include "../os/MockOperatingSystem.hpp"
 #include "../../util/TestUtils.hpp"
 #include "MockGeneratorLogger.hpp"
+#include "MockSolutionOutputCache.hpp"
 #include "MockTestCaseGenerator.hpp"
 #include "tcframe/runner/generator/Generator.hpp"
 
 using ::testing::_;
+using ::testing::AnyNumber;
 using ::testing::Eq;
 using ::testing::InSequence;
+using ::testing::Invoke;
 using ::testing::Pointee;
 using ::testing::Return;
 using ::testing::Test;
 using ::testing::Throw;
 using ::testing::WhenDynamicCastTo;
 
+using std::istringstream;
+using std::map;
+using std::ostringstream;
+
 namespace tcframe {
 
 class GeneratorTests : public Test {
@@ -26,6 +37,7 @@ protected:
     MOCK(TestCaseGenerator) testCaseGenerator;
     MOCK(OperatingSystem) os;
     MOCK(GeneratorLogger) logger;
+    MOCK(SolutionOutputCache) outputCache;
 
     TestCase stc1 = TestUtils::newTestCase("foo_sample_1");
     TestCase stc2 = TestUtils::newTestCase("foo_sample_2");
@@ -48,15 +60,117 @@ protected:
             .setHasTcOutput(true)
             .build();
 
-    Generator generator = {&specClient, &testCaseGenerator, &os, &logger};
+    GenerationOptions parallelOptions = GenerationOptionsBuilder(options)
+            .setJobs(2)
+            .setSeedsPerTestCase(true)
+            .build();
+
+    GenerationOptions seedPerTestCaseOptions = GenerationOptionsBuilder(options)
+            .setSeedsPerTestCase(true)
+            .build();
+
+    GenerationOptions streamingOptions = GenerationOptionsBuilder(options)
+            .setStreamsMultipleTestCases(true)
+            .build();
+
+    GenerationOptions parallelStreamingOptions = GenerationOptionsBuilder(streamingOptions)
+            .setJobs(2)
+            .setSeedsPerTestCase(true)
+            .build();
+
+    GenerationOptions cachedOptions = GenerationOptionsBuilder(options)
+            .setOutputCache("cache", 64)
+            .build();
+
+    GenerationOptions parallelCachedOptions = GenerationOptionsBuilder(cachedOptions)
+            .setJobs(2)
+            .setSeedsPerTestCase(true)
+            .build();
+
+    GenerationOptions incrementalOptions = GenerationOptionsBuilder(options)
+            .setIncremental("build")
+            .setSeedsPerTestCase(true)
+            .build();
+
+    GenerationOptions parallelIncrementalOptions = GenerationOptionsBuilder(incrementalOptions)
+            .setJobs(2)
+            .setSeedsPerTestCase(true)
+            .build();
+
+    // Incremental generation identifies test cases by their data, so they need to have some.
+    TestCase istc1 = TestCaseBuilder()
+            .setName("foo_sample_1")
+            .setData(new SampleTestCaseData("1\n", "2\n"))
+            .build();
+    TestCase itc1 = newOfficialTestCase("foo_1_1", "N = 1");
+    TestCase itc2 = newOfficialTestCase("foo_1_2", "N = 2");
+    TestCase itc3 = newOfficialTestCase("foo_2_1", "N = 3");
+
+    TestSuite incrementalTestSuite = TestSuite({
+            TestGroup(TestGroup::SAMPLE_ID, {istc1}),
+            TestGroup(1, {itc1, itc2}),
+            TestGroup(2, {itc3})});
+
+    Generator generator = {&specClient, &testCaseGenerator, &os, &logger, &outputCache};
+
+    // Forked processes are simulated by running their tasks immediately; they "finish" in reverse order.
+    vector<pair<int, bool>> finishedProcesses;
+    int lastPid = 0;
+
+    map<string, ostringstream*> writtenFiles;
 
     void SetUp() {
+        ON_CALL(os, forkProcess(_, _)).WillByDefault(Invoke(
+                [&] (const function<bool()>& task, const string&) {
+                    finishedProcesses.push_back({++lastPid, task()});
+                    return lastPid;
+                }));
+        ON_CALL(os, waitForAnyProcess()).WillByDefault(Invoke([&] {
+            pair<int, bool> process = finishedProcesses.back();
+            finishedProcesses.pop_back();
+            return process;
+        }));
+        ON_CALL(os, openForReading(_)).WillByDefault(Invoke([] (const string& filename) {
+            return new istringstream("output of " + filename);
+        }));
+        ON_CALL(os, openForWriting(_)).WillByDefault(Invoke([&] (const string& filename) {
+            return writtenFiles[filename] = new ostringstream();
+        }));
+        ON_CALL(os, openForReading("dir/.generation_manifest")).WillByDefault(Invoke([] (const string&) {
+            return new istringstream("");
+        }));
+
         ON_CALL(specClient, hasMultipleTestCases())
                 .WillByDefault(Return(false));
         ON_CALL(specClient, getMultipleTestCasesOutputPrefix())
                 .WillByDefault(Return(optional<string>()));
         ON_CALL(testCaseGenerator, generate(_, _))
                 .WillByDefault(Return(true));
+        ON_CALL(testCaseGenerator, appendInput(_, _))
+                .WillByDefault(Return(true));
+    }
+
+    static TestCase newOfficialTestCase(string name, string description) {
+        return TestCaseBuilder()
+                .setName(name)
+                .setDescription(description)
+                .setData(new OfficialTestCaseData([]{}))
+                .build();
+    }
+
+    // Runs an incremental generation, whose manifest is then read by the next one.
+    GenerationManifest generatePreviously(const GenerationOptions& options) {
+        generator.generate(options);
+        string manifest = writtenFiles["dir/.generation_manifest"]->str();
+        ON_CALL(os, openForReading("dir/.generation_manifest")).WillByDefault(Invoke([=] (const string&) {
+            return new istringstream(manifest);
+        }));
+        return readWrittenManifest();
+    }
+
+    GenerationManifest readWrittenManifest() {
+        istringstream in(writtenFiles["dir/.generation_manifest"]->str());
+        return GenerationManifest::read(&in);
     }
 };
 
@@ -123,6 +237,33 @@ TEST_F(GeneratorTests, Generation_MultipleTestCases) {
     EXPECT_TRUE(generator.generate(options));
 }
 
+TEST_F(GeneratorTests, Generation_MultipleTestCases_Combination) {
+    ON_CALL(specClient, getTestSuite())
+            .WillByDefault(Return(simpleTestSuite));
+    ON_CALL(specClient, hasMultipleTestCases())
+            .WillByDefault(Return(true));
+    ON_CALL(specClient, getMultipleTestCasesOutputPrefix())
+            .WillByDefault(Return(optional<string>("Case #%d: ")));
+    ON_CALL(os, openForReading("dir/foo_sample_1.in"))
+            .WillByDefault(Invoke([] (const string&) {return new istringstream("1\n1 2\n");}));
+    ON_CALL(os, openForReading("dir/foo_sample_2.in"))
+            .WillByDefault(Invoke([] (const string&) {return new istringstream("1\n3 4\n");}));
+    ON_CALL(os, openForReading("dir/foo_sample_1.out"))
+            .WillByDefault(Invoke([] (const string&) {return new istringstream("Case #1: 3\n");}));
+    ON_CALL(os, openForReading("dir/foo_sample_2.out"))
+            .WillByDefault(Invoke([] (const string&) {return new istringstream("Case #1: 7\n");}));
+
+    EXPECT_CALL(os, execute(_)).Times(0);
+    EXPECT_CALL(os, removeFile("dir/foo_sample_1.in"));
+    EXPECT_CALL(os, removeFile("dir/foo_sample_1.out"));
+    EXPECT_CALL(os, removeFile("dir/foo_sample_2.in"));
+    EXPECT_CALL(os, removeFile("dir/foo_sample_2.out"));
+
+    EXPECT_TRUE(generator.generate(options));
+    EXPECT_THAT(writtenFiles["dir/foo_sample.in"]->str(), Eq("2\n1 2\n3 4\n"));
+    EXPECT_THAT(writtenFiles["dir/foo_sample.out"]->str(), Eq("Case #1: 3\nCase #2: 7\n"));
+}
+
 TEST_F(GeneratorTests, Generation_MultipleTestCases_MultipleTestGroups) {
     ON_CALL(specClient, getTestSuite())
             .WillByDefault(Return(testSuite));
@@ -159,4 +300,440 @@ TEST_F(GeneratorTests, Generation_MultipleTestCases_Failed_Verification) {
     EXPECT_FALSE(generator.generate(options));
 }
 
+TEST_F(GeneratorTests, Generation_SeedPerTestCase) {
+    ON_CALL(specClient, getTestSuite())
+            .WillByDefault(Return(testSuite));
+    {
+        InSequence sequence;
+        EXPECT_CALL(os, forceMakeDir("dir"));
+
+        EXPECT_CALL(specClient, setSeed(SeedDeriver::derive(42, TestGroup::SAMPLE_ID, 1)));
+        EXPECT_CALL(testCaseGenerator, generate(stc1, seedPerTestCaseOptions));
+        EXPECT_CALL(specClient, setSeed(SeedDeriver::derive(42, TestGroup::SAMPLE_ID, 2)));
+        EXPECT_CALL(testCaseGenerator, generate(stc2, seedPerTestCaseOptions));
+        EXPECT_CALL(specClient, setSeed(SeedDeriver::derive(42, 1, 1)));
+        EXPECT_CALL(testCaseGenerator, generate(tc1, seedPerTestCaseOptions));
+        EXPECT_CALL(specClient, setSeed(SeedDeriver::derive(42, 1, 2)));
+        EXPECT_CALL(testCaseGenerator, generate(tc2, seedPerTestCaseOptions));
+        EXPECT_CALL(specClient, setSeed(SeedDeriver::derive(42, 2, 1)));
+        EXPECT_CALL(testCaseGenerator, generate(tc3, seedPerTestCaseOptions));
+
+        EXPECT_CALL(logger, logSuccessfulResult());
+    }
+    EXPECT_CALL(specClient, setSeed(42)).Times(0);
+    EXPECT_CALL(os, forkProcess(_, _)).Times(0);
+
+    EXPECT_TRUE(generator.generate(seedPerTestCaseOptions));
+}
+
+TEST_F(GeneratorTests, Generation_Parallel) {
+    ON_CALL(specClient, getTestSuite())
+            .WillByDefault(Return(testSuite));
+    {
+        InSequence sequence;
+        EXPECT_CALL(logger, logIntroduction());
+        EXPECT_CALL(os, forceMakeDir("dir"));
+
+        EXPECT_CALL(logger, logTestGroupIntroduction(TestGroup::SAMPLE_ID));
+        EXPECT_CALL(logger, logWorkerOutput("output of __tcframe_generation_0.out"));
+        EXPECT_CALL(logger, logTestGroupIntroduction(1));
+        EXPECT_CALL(logger, logWorkerOutput("output of __tcframe_generation_1.out"));
+        EXPECT_CALL(logger, logWorkerOutput("output of __tcframe_generation_2.out"));
+        EXPECT_CALL(logger, logTestGroupIntroduction(2));
+        EXPECT_CALL(logger, logWorkerOutput("output of __tcframe_generation_3.out"));
+
+        EXPECT_CALL(logger, logSuccessfulResult());
+    }
+    EXPECT_CALL(os, forkProcess(_, _)).Times(4);
+    EXPECT_CALL(specClient, setSeed(42)).Times(0);
+    EXPECT_CALL(specClient, setSeed(SeedDeriver::derive(42, TestGroup::SAMPLE_ID, 1)));
+    EXPECT_CALL(specClient, setSeed(SeedDeriver::derive(42, TestGroup::SAMPLE_ID, 2)));
+    EXPECT_CALL(specClient, setSeed(SeedDeriver::derive(42, 1, 1)));
+    EXPECT_CALL(specClient, setSeed(SeedDeriver::derive(42, 1, 2)));
+    EXPECT_CALL(specClient, setSeed(SeedDeriver::derive(42, 2, 1)));
+    EXPECT_CALL(testCaseGenerator, generate(stc1, parallelOptions));
+    EXPECT_CALL(testCaseGenerator, generate(stc2, parallelOptions));
+    EXPECT_CALL(testCaseGenerator, generate(tc1, parallelOptions));
+    EXPECT_CALL(testCaseGenerator, generate(tc2, parallelOptions));
+    EXPECT_CALL(testCaseGenerator, generate(tc3, parallelOptions));
+
+    EXPECT_TRUE(generator.generate(parallelOptions));
+}
+
+TEST_F(GeneratorTests, Generation_OutputCache) {
+    ON_CALL(specClient, getTestSuite())
+            .WillByDefault(Return(simpleTestSuite));
+    ON_CALL(outputCache, statistics())
+            .WillByDefault(Return(OutputCacheStatistics{3, 1}));
+    {
+        InSequence sequence;
+        EXPECT_CALL(testCaseGenerator, generate(stc1, cachedOptions));
+        EXPECT_CALL(testCaseGenerator, generate(stc2, cachedOptions));
+        EXPECT_CALL(outputCache, evict(cachedOptions));
+        EXPECT_CALL(logger, logOutputCacheStatistics(3, 1));
+        EXPECT_CALL(logger, logSuccessfulResult());
+    }
+    EXPECT_TRUE(generator.generate(cachedOptions));
+}
+
+TEST_F(GeneratorTests, Generation_Parallel_OutputCache) {
+    ON_CALL(specClient, getTestSuite())
+            .WillByDefault(Return(simpleTestSuite));
+    ON_CALL(os, openForReading("__tcframe_generation_0.cache"))
+            .WillByDefault(Return(new istringstream("2 1\n")));
+    EXPECT_CALL(outputCache, statistics())
+            .WillOnce(Return(OutputCacheStatistics{1, 1}))
+            .WillOnce(Return(OutputCacheStatistics{3, 2}))
+            .WillOnce(Return(OutputCacheStatistics{3, 2}));
+    EXPECT_CALL(os, removeFile(_)).Times(AnyNumber());
+    {
+        InSequence sequence;
+        EXPECT_CALL(logger, logWorkerOutput("output of __tcframe_generation_0.out"));
+        EXPECT_CALL(os, removeFile("__tcframe_generation_0.cache"));
+        EXPECT_CALL(outputCache, addStatistics(OutputCacheStatistics{2, 1}));
+        EXPECT_CALL(outputCache, evict(parallelCachedOptions));
+        EXPECT_CALL(logger, logOutputCacheStatistics(3, 2));
+        EXPECT_CALL(logger, logSuccessfulResult());
+    }
+    EXPECT_TRUE(generator.generate(parallelCachedOptions));
+    EXPECT_THAT(writtenFiles["__tcframe_generation_0.cache"]->str(), Eq("2 1\n"));
+}
+
+TEST_F(GeneratorTests, Generation_Parallel_Failed) {
+    ON_CALL(specClient, getTestSuite())
+            .WillByDefault(Return(testSuite));
+    ON_CALL(testCaseGenerator, generate(tc2, _))
+            .WillByDefault(Return(false));
+
+    EXPECT_CALL(logger, logFailedResult());
+
+    EXPECT_FALSE(generator.generate(parallelOptions));
+}
+
+TEST_F(GeneratorTests, Generation_Parallel_MultipleTestCases) {
+    ON_CALL(specClient, getTestSuite())
+            .WillByDefault(Return(testSuite));
+    ON_CALL(specClient, hasMultipleTestCases())
+            .WillByDefault(Return(true));
+    {
+        InSequence sequence;
+        EXPECT_CALL(logger, logTestGroupIntroduction(TestGroup::SAMPLE_ID));
+        EXPECT_CALL(logger, logWorkerOutput(_));
+        EXPECT_CALL(logger, logMultipleTestCasesCombinationIntroduction("foo_sample"));
+        EXPECT_CALL(logger, logTestGroupIntroduction(1));
+        EXPECT_CALL(logger, logWorkerOutput(_));
+        EXPECT_CALL(logger, logWorkerOutput(_));
+        EXPECT_CALL(logger, logMultipleTestCasesCombinationIntroduction("foo_1"));
+        EXPECT_CALL(logger, logTestGroupIntroduction(2));
+        EXPECT_CALL(logger, logWorkerOutput(_));
+        EXPECT_CALL(logger, logMultipleTestCasesCombinationIntroduction("foo_2"));
+    }
+    EXPECT_TRUE(generator.generate(parallelOptions));
+}
+
+TEST_F(GeneratorTests, Generation_Streaming) {
+    ON_CALL(specClient, getTestSuite())
+            .WillByDefault(Return(testSuite));
+    ON_CALL(specClient, hasMultipleTestCases())
+            .WillByDefault(Return(true));
+    EXPECT_CALL(os, openForWriting(_)).Times(AnyNumber());
+    {
+        InSequence sequence;
+        EXPECT_CALL(logger, logTestGroupIntroduction(TestGroup::SAMPLE_ID));
+        EXPECT_CALL(testCaseGenerator, generate(stc1, streamingOptions));
+        EXPECT_CALL(testCaseGenerator, generate(stc2, streamingOptions));
+        EXPECT_CALL(logger, logMultipleTestCasesCombinationIntroduction("foo_sample"));
+        EXPECT_CALL(specClient, validateMultipleTestCasesInput(2));
+        EXPECT_CALL(logger, logMultipleTestCasesCombinationSuccessfulResult());
+
+        EXPECT_CALL(logger, logTestGroupIntroduction(1));
+        EXPECT_CALL(os, openForWriting("dir/foo_1.in"));
+        EXPECT_CALL(testCaseGenerator, appendInput(tc1, _));
+        EXPECT_CALL(testCaseGenerator, appendInput(tc2, _));
+        EXPECT_CALL(logger, logMultipleTestCasesCombinationIntroduction("foo_1"));
+        EXPECT_CALL(specClient, validateMultipleTestCasesInput(2));
+        EXPECT_CALL(testCaseGenerator, generateOutput("dir/foo_1.in", "dir/foo_1.out", streamingOptions));
+        EXPECT_CALL(specClient, validateMultipleTestCasesOutput("dir/foo_1.out", 2));
+        EXPECT_CALL(logger, logMultipleTestCasesCombinationSuccessfulResult());
+
+        EXPECT_CALL(logger, logTestGroupIntroduction(2));
+        EXPECT_CALL(os, openForWriting("dir/foo_2.in"));
+        EXPECT_CALL(testCaseGenerator, appendInput(tc3, _));
+        EXPECT_CALL(logger, logMultipleTestCasesCombinationIntroduction("foo_2"));
+        EXPECT_CALL(specClient, validateMultipleTestCasesInput(1));
+        EXPECT_CALL(testCaseGenerator, generateOutput("dir/foo_2.in", "dir/foo_2.out", streamingOptions));
+        EXPECT_CALL(specClient, validateMultipleTestCasesOutput("dir/foo_2.out", 1));
+        EXPECT_CALL(logger, logMultipleTestCasesCombinationSuccessfulResult());
+
+        EXPECT_CALL(logger, logSuccessfulResult());
+    }
+    EXPECT_CALL(testCaseGenerator, generate(tc1, _)).Times(0);
+
+    EXPECT_TRUE(generator.generate(streamingOptions));
+    EXPECT_THAT(writtenFiles["dir/foo_1.in"]->str(), Eq("2\n"));
+    EXPECT_THAT(writtenFiles["dir/foo_2.in"]->str(), Eq("1\n"));
+}
+
+TEST_F(GeneratorTests, Generation_Streaming_Failed) {
+    ON_CALL(specClient, getTestSuite())
+            .WillByDefault(Return(testSuite));
+    ON_CALL(specClient, hasMultipleTestCases())
+            .WillByDefault(Return(true));
+    ON_CALL(testCaseGenerator, appendInput(tc1, _))
+            .WillByDefault(Return(false));
+    EXPECT_CALL(os, removeFile(_)).Times(AnyNumber());
+    EXPECT_CALL(logger, logMultipleTestCasesCombinationIntroduction(_)).Times(AnyNumber());
+    EXPECT_CALL(testCaseGenerator, generateOutput(_, _, _)).Times(AnyNumber());
+    {
+        InSequence sequence;
+        EXPECT_CALL(testCaseGenerator, appendInput(tc1, _));
+        EXPECT_CALL(testCaseGenerator, appendInput(tc2, _));
+        EXPECT_CALL(os, removeFile("dir/foo_1.in"));
+        EXPECT_CALL(testCaseGenerator, appendInput(tc3, _));
+        EXPECT_CALL(logger, logFailedResult());
+    }
+    EXPECT_CALL(logger, logMultipleTestCasesCombinationIntroduction("foo_1")).Times(0);
+    EXPECT_CALL(testCaseGenerator, generateOutput("dir/foo_1.in", _, _)).Times(0);
+
+    EXPECT_FALSE(generator.generate(streamingOptions));
+}
+
+TEST_F(GeneratorTests, Generation_Streaming_InvalidOutput) {
+    ON_CALL(specClient, getTestSuite())
+            .WillByDefault(Return(testSuite));
+    ON_CALL(specClient, hasMultipleTestCases())
+            .WillByDefault(Return(true));
+    runtime_error e("Test case #2: Expected: <EOF> after 'res'");
+    ON_CALL(specClient, validateMultipleTestCasesOutput("dir/foo_1.out", 2))
+            .WillByDefault(Throw(e));
+    EXPECT_CALL(logger, logMultipleTestCasesCombinationIntroduction(_)).Times(AnyNumber());
+    EXPECT_CALL(logger, logMultipleTestCasesCombinationSuccessfulResult()).Times(AnyNumber());
+    EXPECT_CALL(testCaseGenerator, generateOutput(_, _, _)).Times(AnyNumber());
+    EXPECT_CALL(specClient, validateMultipleTestCasesOutput(_, _)).Times(AnyNumber());
+    {
+        InSequence sequence;
+        EXPECT_CALL(logger, logMultipleTestCasesCombinationIntroduction("foo_1"));
+        EXPECT_CALL(testCaseGenerator, generateOutput("dir/foo_1.in", "dir/foo_1.out", streamingOptions));
+        EXPECT_CALL(specClient, validateMultipleTestCasesOutput("dir/foo_1.out", 2));
+        EXPECT_CALL(logger, logMultipleTestCasesCombinationFailedResult());
+        EXPECT_CALL(logger, logError(_));
+        EXPECT_CALL(logger, logFailedResult());
+    }
+
+    EXPECT_FALSE(generator.generate(streamingOptions));
+}
+
+TEST_F(GeneratorTests, Generation_Parallel_Streaming) {
+    ON_CALL(specClient, getTestSuite())
+            .WillByDefault(Return(testSuite));
+    ON_CALL(specClient, hasMultipleTestCases())
+            .WillByDefault(Return(true));
+    {
+        InSequence sequence;
+        EXPECT_CALL(logger, logTestGroupIntroduction(TestGroup::SAMPLE_ID));
+        EXPECT_CALL(logger, logWorkerOutput("output of __tcframe_generation_0.out"));
+        EXPECT_CALL(logger, logMultipleTestCasesCombinationIntroduction("foo_sample"));
+        EXPECT_CALL(logger, logTestGroupIntroduction(1));
+        EXPECT_CALL(logger, logWorkerOutput("output of __tcframe_generation_1.out"));
+        EXPECT_CALL(logger, logTestGroupIntroduction(2));
+        EXPECT_CALL(logger, logWorkerOutput("output of __tcframe_generation_2.out"));
+        EXPECT_CALL(logger, logSuccessfulResult());
+    }
+    EXPECT_CALL(os, forkProcess(_, _)).Times(3);
+    EXPECT_CALL(logger, logMultipleTestCasesCombinationIntroduction("foo_1"));
+    EXPECT_CALL(logger, logMultipleTestCasesCombinationIntroduction("foo_2"));
+    EXPECT_CALL(specClient, setSeed(SeedDeriver::derive(42, 1, 1)));
+    EXPECT_CALL(specClient, setSeed(SeedDeriver::derive(42, 1, 2)));
+    EXPECT_CALL(specClient, setSeed(SeedDeriver::derive(42, 2, 1)));
+    EXPECT_CALL(specClient, setSeed(SeedDeriver::derive(42, TestGroup::SAMPLE_ID, 1)));
+    EXPECT_CALL(specClient, setSeed(SeedDeriver::derive(42, TestGroup::SAMPLE_ID, 2)));
+    EXPECT_CALL(testCaseGenerator, appendInput(tc1, _));
+    EXPECT_CALL(testCaseGenerator, appendInput(tc2, _));
+    EXPECT_CALL(testCaseGenerator, appendInput(tc3, _));
+    EXPECT_CALL(testCaseGenerator, generateOutput("dir/foo_1.in", "dir/foo_1.out", parallelStreamingOptions));
+    EXPECT_CALL(testCaseGenerator, generateOutput("dir/foo_2.in", "dir/foo_2.out", parallelStreamingOptions));
+
+    EXPECT_TRUE(generator.generate(parallelStreamingOptions));
+}
+
+TEST_F(GeneratorTests, Generation_Incremental) {
+    ON_CALL(specClient, getTestSuite())
+            .WillByDefault(Return(incrementalTestSuite));
+    {
+        InSequence sequence;
+        EXPECT_CALL(logger, logIntroduction());
+        EXPECT_CALL(os, makeDir("dir"));
+
+        EXPECT_CALL(logger, logTestGroupIntroduction(TestGroup::SAMPLE_ID));
+        EXPECT_CALL(specClient, setSeed(SeedDeriver::derive(42, TestGroup::SAMPLE_ID, 1)));
+        EXPECT_CALL(testCaseGenerator, generate(istc1, incrementalOptions));
+        EXPECT_CALL(logger, logTestGroupIntroduction(1));
+        EXPECT_CALL(specClient, setSeed(SeedDeriver::derive(42, 1, 1)));
+        EXPECT_CALL(testCaseGenerator, generate(itc1, incrementalOptions));
+        EXPECT_CALL(specClient, setSeed(SeedDeriver::derive(42, 1, 2)));
+        EXPECT_CALL(testCaseGenerator, generate(itc2, incrementalOptions));
+        EXPECT_CALL(logger, logTestGroupIntroduction(2));
+        EXPECT_CALL(specClient, setSeed(SeedDeriver::derive(42, 2, 1)));
+        EXPECT_CALL(testCaseGenerator, generate(itc3, incrementalOptions));
+
+        EXPECT_CALL(logger, logSuccessfulResult());
+    }
+    EXPECT_CALL(os, forceMakeDir(_)).Times(0);
+    EXPECT_CALL(os, removeFile(_)).Times(0);
+    EXPECT_CALL(specClient, setSeed(42)).Times(0);
+
+    EXPECT_TRUE(generator.generate(incrementalOptions));
+
+    istringstream in("output of dir/foo_1_1.in");
+    istringstream out("output of dir/foo_1_1.out");
+    GenerationManifest manifest = readWrittenManifest();
+    EXPECT_THAT(manifest.entries().size(), Eq(4u));
+    EXPECT_THAT(manifest.get("foo_1_1").value().checksum, Eq(Hasher().addStream(&in).addStream(&out).hex()));
+}
+
+TEST_F(GeneratorTests, Generation_Incremental_Unchanged) {
+    ON_CALL(specClient, getTestSuite())
+            .WillByDefault(Return(incrementalTestSuite));
+    GenerationManifest previousManifest = generatePreviously(incrementalOptions);
+    {
+        InSequence sequence;
+        EXPECT_CALL(logger, logTestGroupIntroduction(TestGroup::SAMPLE_ID));
+        EXPECT_CALL(logger, logTestCaseIntroduction("foo_sample_1"));
+        EXPECT_CALL(logger, logTestCaseUnchangedResult());
+        EXPECT_CALL(logger, logTestGroupIntroduction(1));
+        EXPECT_CALL(logger, logTestCaseIntroduction("foo_1_1"));
+        EXPECT_CALL(logger, logTestCaseUnchangedResult());
+        EXPECT_CALL(logger, logTestCaseIntroduction("foo_1_2"));
+        EXPECT_CALL(logger, logTestCaseUnchangedResult());
+        EXPECT_CALL(logger, logTestGroupIntroduction(2));
+        EXPECT_CALL(logger, logTestCaseIntroduction("foo_2_1"));
+        EXPECT_CALL(logger, logTestCaseUnchangedResult());
+        EXPECT_CALL(logger, logSuccessfulResult());
+    }
+    EXPECT_CALL(testCaseGenerator, generate(_, _)).Times(0);
+    EXPECT_CALL(specClient, setSeed(_)).Times(0);
+
+    EXPECT_TRUE(generator.generate(incrementalOptions));
+    EXPECT_THAT(readWrittenManifest(), Eq(previousManifest));
+}
+
+TEST_F(GeneratorTests, Generation_Incremental_Changed) {
+    ON_CALL(specClient, getTestSuite())
+            .WillByDefault(Return(incrementalTestSuite));
+    generatePreviously(incrementalOptions);
+
+    TestCase changedTc2 = newOfficialTestCase("foo_1_2", "N = 20");
+    ON_CALL(specClient, getTestSuite())
+            .WillByDefault(Return(TestSuite({
+                    TestGroup(TestGroup::SAMPLE_ID, {istc1}),
+                    TestGroup(1, {itc1, changedTc2}),
+                    TestGroup(2, {itc3})})));
+    ON_CALL(os, openForReading("dir/foo_2_1.in"))
+            .WillByDefault(Invoke([] (const string&) {return new istringstream("modified");}));
+
+    EXPECT_CALL(testCaseGenerator, generate(_, _)).Times(0);
+    EXPECT_CALL(specClient, setSeed(SeedDeriver::derive(42, 1, 2)));
+    EXPECT_CALL(testCaseGenerator, generate(changedTc2, incrementalOptions));
+    EXPECT_CALL(specClient, setSeed(SeedDeriver::derive(42, 2, 1)));
+    EXPECT_CALL(testCaseGenerator, generate(itc3, incrementalOptions));
+    EXPECT_CALL(logger, logTestCaseUnchangedResult()).Times(2);
+
+    EXPECT_TRUE(generator.generate(incrementalOptions));
+}
+
+TEST_F(GeneratorTests, Generation_Incremental_ChangedTestGroup) {
+    ON_CALL(specClient, getTestSuite())
+            .WillByDefault(Return(incrementalTestSuite));
+    generatePreviously(incrementalOptions);
+
+    TestCase changedTc3 = newOfficialTestCase("foo_2_1", "N = 30");
+    TestCase newTc4 = newOfficialTestCase("foo_2_2", "N = 4");
+    ON_CALL(specClient, getTestSuite())
+            .WillByDefault(Return(TestSuite({
+                    TestGroup(TestGroup::SAMPLE_ID, {istc1}),
+                    TestGroup(1, {itc1, itc2}),
+                    TestGroup(2, {changedTc3, newTc4})})));
+
+    EXPECT_CALL(testCaseGenerator, generate(_, _)).Times(0);
+    EXPECT_CALL(testCaseGenerator, generate(changedTc3, incrementalOptions));
+    EXPECT_CALL(testCaseGenerator, generate(newTc4, incrementalOptions));
+    EXPECT_CALL(logger, logTestCaseUnchangedResult()).Times(3);
+    EXPECT_CALL(os, removeFile(_)).Times(0);
+
+    EXPECT_TRUE(generator.generate(incrementalOptions));
+}
+
+TEST_F(GeneratorTests, Generation_Incremental_ChangedBuild) {
+    ON_CALL(specClient, getTestSuite())
+            .WillByDefault(Return(incrementalTestSuite));
+    generatePreviously(incrementalOptions);
+
+    GenerationOptions rebuiltOptions = GenerationOptionsBuilder(options)
+            .setIncremental("rebuilt")
+            .build();
+
+    EXPECT_CALL(testCaseGenerator, generate(_, rebuiltOptions)).Times(4);
+    EXPECT_CALL(logger, logTestCaseUnchangedResult()).Times(0);
+
+    EXPECT_TRUE(generator.generate(rebuiltOptions));
+}
+
+TEST_F(GeneratorTests, Generation_Incremental_StaleFiles) {
+    ON_CALL(specClient, getTestSuite())
+            .WillByDefault(Return(incrementalTestSuite));
+    generatePreviously(incrementalOptions);
+
+    ON_CALL(specClient, getTestSuite())
+            .WillByDefault(Return(TestSuite({
+                    TestGroup(TestGroup::SAMPLE_ID, {istc1}),
+                    TestGroup(1, {itc1, itc2})})));
+
+    EXPECT_CALL(os, removeFile(_)).Times(0);
+    EXPECT_CALL(os, removeFile("dir/foo_2_1.in"));
+    EXPECT_CALL(os, removeFile("dir/foo_2_1.out"));
+
+    EXPECT_TRUE(generator.generate(incrementalOptions));
+    EXPECT_FALSE(readWrittenManifest().get("foo_2_1"));
+}
+
+TEST_F(GeneratorTests, Generation_Incremental_Failed) {
+    ON_CALL(specClient, getTestSuite())
+            .WillByDefault(Return(incrementalTestSuite));
+    ON_CALL(testCaseGenerator, generate(itc3, _))
+            .WillByDefault(Return(false));
+
+    EXPECT_FALSE(generator.generate(incrementalOptions));
+    EXPECT_TRUE(readWrittenManifest().entries().empty());
+}
+
+TEST_F(GeneratorTests, Generation_Parallel_Incremental_Unchanged) {
+    ON_CALL(specClient, getTestSuite())
+            .WillByDefault(Return(incrementalTestSuite));
+    GenerationManifest previousManifest = generatePreviously(parallelIncrementalOptions);
+
+    EXPECT_CALL(os, forkProcess(_, _)).Times(0);
+    EXPECT_CALL(logger, logWorkerOutput(_)).Times(0);
+    EXPECT_CALL(logger, logTestCaseUnchangedResult()).Times(4);
+    EXPECT_CALL(logger, logSuccessfulResult());
+
+    EXPECT_TRUE(generator.generate(parallelIncrementalOptions));
+    EXPECT_THAT(readWrittenManifest(), Eq(previousManifest));
+}
+
+TEST_F(GeneratorTests, Generation_MultipleTestCases_Incremental_Unchanged) {
+    ON_CALL(specClient, getTestSuite())
+            .WillByDefault(Return(incrementalTestSuite));
+    ON_CALL(specClient, hasMultipleTestCases())
+            .WillByDefault(Return(true));
+    GenerationManifest previousManifest = generatePreviously(incrementalOptions);
+
+    EXPECT_CALL(testCaseGenerator, generate(_, _)).Times(0);
+    EXPECT_CALL(logger, logMultipleTestCasesCombinationIntroduction(_)).Times(0);
+    EXPECT_CALL(logger, logTestCaseUnchangedResult()).Times(4);
+
+    EXPECT_TRUE(generator.generate(incrementalOptions));
+    EXPECT_THAT(previousManifest.entries().size(), Eq(3u));
+    EXPECT_TRUE(previousManifest.get("foo_1"));
+}
+
 }
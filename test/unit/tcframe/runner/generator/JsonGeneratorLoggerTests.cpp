@@ -0,0 +1,91 @@
+#include "gmock/gmock.h"
+#include "../../mock.hpp"
+
+#include "../logger/MockJsonLoggerEngine.hpp"
+#include "tcframe/runner/generator/JsonGeneratorLogger.hpp"
+
+using ::testing::Test;
+
+namespace tcframe {
+
+class JsonGeneratorLoggerTests : public Test {
+protected:
+    MOCK(JsonLoggerEngine) engine;
+
+    JsonGeneratorLogger logger = JsonGeneratorLogger(&engine);
+};
+
+TEST_F(JsonGeneratorLoggerTests, Introduction) {
+    EXPECT_CALL(engine, logObject(JsonObject().add("event", "generation")));
+    logger.logIntroduction();
+}
+
+TEST_F(JsonGeneratorLoggerTests, SuccessfulResult) {
+    EXPECT_CALL(engine, logObject(JsonObject()
+            .add("event", "result")
+            .add("status", "OK")));
+    logger.logSuccessfulResult();
+}
+
+TEST_F(JsonGeneratorLoggerTests, FailedResult) {
+    EXPECT_CALL(engine, logObject(JsonObject()
+            .add("event", "result")
+            .add("status", "FAILED")));
+    logger.logFailedResult();
+}
+
+TEST_F(JsonGeneratorLoggerTests, TestCaseSuccessfulResult) {
+    EXPECT_CALL(engine, logObject(JsonObject()
+            .add("event", "test_case")
+            .add("name", "foo_1")
+            .add("status", "OK")));
+    logger.logTestCaseIntroduction("foo_1");
+    logger.logTestCaseSuccessfulResult();
+}
+
+TEST_F(JsonGeneratorLoggerTests, TestCaseFailedResult) {
+    EXPECT_CALL(engine, logObject(JsonObject()
+            .add("event", "test_case")
+            .add("name", "foo_1")
+            .add("status", "FAILED")
+            .add("description", "N = 1")));
+    logger.logTestCaseIntroduction("foo_1");
+    logger.logTestCaseFailedResult(optional<string>("N = 1"));
+}
+
+TEST_F(JsonGeneratorLoggerTests, TestCaseFailedResult_WithoutDescription) {
+    EXPECT_CALL(engine, logObject(JsonObject()
+            .add("event", "test_case")
+            .add("name", "foo_sample_1")
+            .add("status", "FAILED")));
+    logger.logTestCaseIntroduction("foo_sample_1");
+    logger.logTestCaseFailedResult(optional<string>());
+}
+
+TEST_F(JsonGeneratorLoggerTests, TestCaseUnchangedResult) {
+    EXPECT_CALL(engine, logObject(JsonObject()
+            .add("event", "test_case")
+            .add("name", "foo_1")
+            .add("status", "UNCHANGED")));
+    logger.logTestCaseIntroduction("foo_1");
+    logger.logTestCaseUnchangedResult();
+}
+
+TEST_F(JsonGeneratorLoggerTests, MultipleTestCasesCombination) {
+    EXPECT_CALL(engine, logObject(JsonObject()
+            .add("event", "combination")
+            .add("name", "foo_1")
+            .add("status", "FAILED")));
+    logger.logMultipleTestCasesCombinationIntroduction("foo_1");
+    logger.logMultipleTestCasesCombinationFailedResult();
+}
+
+TEST_F(JsonGeneratorLoggerTests, OutputCacheStatistics) {
+    EXPECT_CALL(engine, logObject(JsonObject()
+            .add("event", "output_cache")
+            .add("hits", 3)
+            .add("misses", 2)));
+    logger.logOutputCacheStatistics(3, 2);
+}
+
+}
@@ -9,14 +9,19 @@ namespace tcframe {
 class MockGenerator : public Generator {
 public:
     MockGenerator()
-            : Generator(nullptr, nullptr, nullptr, nullptr) {}
+            : Generator(nullptr, nullptr, nullptr, nullptr, nullptr) {}
 
     MOCK_METHOD1(generate, bool(const GenerationOptions&));
 };
 
 class MockGeneratorFactory : public GeneratorFactory {
 public:
-    MOCK_METHOD4(create, Generator*(SpecClient*, TestCaseGenerator*, OperatingSystem*, GeneratorLogger*));
+    MOCK_METHOD5(create, Generator*(
+            SpecClient*,
+            TestCaseGenerator*,
+            OperatingSystem*,
+            GeneratorLogger*,
+            SolutionOutputCache*));
 };
 
 }
@@ -15,10 +15,13 @@ public:
     MOCK_METHOD0(logSuccessfulResult, void());
     MOCK_METHOD0(logFailedResult, void());
     MOCK_METHOD0(logTestCaseSuccessfulResult, void());
+    MOCK_METHOD0(logTestCaseUnchangedResult, void());
     MOCK_METHOD1(logTestCaseFailedResult, void(const optional<string>&));
     MOCK_METHOD1(logMultipleTestCasesCombinationIntroduction, void(const string&));
     MOCK_METHOD0(logMultipleTestCasesCombinationSuccessfulResult, void());
     MOCK_METHOD0(logMultipleTestCasesCombinationFailedResult, void());
+    MOCK_METHOD1(logWorkerOutput, void(const string&));
+    MOCK_METHOD2(logOutputCacheStatistics, void(int, int));
     MOCK_METHOD1(logError, void(runtime_error*));
 };
 
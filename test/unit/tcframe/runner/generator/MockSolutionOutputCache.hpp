@@ -0,0 +1,18 @@
+#pragma once
+
+#include "gmock/gmock.h"
+
+#include "tcframe/runner/generator/SolutionOutputCache.hpp"
+
+namespace tcframe {
+
+class MockSolutionOutputCache : public SolutionOutputCache {
+public:
+    MOCK_METHOD3(restore, bool(const string&, const string&, const GenerationOptions&));
+    MOCK_METHOD3(store, void(const string&, const string&, const GenerationOptions&));
+    MOCK_METHOD1(evict, void(const GenerationOptions&));
+    MOCK_METHOD0(statistics, OutputCacheStatistics());
+    MOCK_METHOD1(addStatistics, void(const OutputCacheStatistics&));
+};
+
+}
@@ -9,9 +9,11 @@ namespace tcframe {
 class MockTestCaseGenerator : public TestCaseGenerator {
 public:
     MockTestCaseGenerator()
-            : TestCaseGenerator(nullptr, nullptr, nullptr) {}
+            : TestCaseGenerator(nullptr, nullptr, nullptr, nullptr) {}
 
     MOCK_METHOD2(generate, bool(const TestCase&, const GenerationOptions&));
+    MOCK_METHOD2(appendInput, bool(const TestCase&, ostream*));
+    MOCK_METHOD3(generateOutput, void(const string&, const string&, const GenerationOptions&));
 };
 
 }
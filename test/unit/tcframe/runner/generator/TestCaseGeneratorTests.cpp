@@ -7,6 +7,7 @@
 #include "../client/MockSpecClient.hpp"
 #include "../evaluator/MockEvaluator.hpp"
 #include "MockGeneratorLogger.hpp"
+#include "MockSolutionOutputCache.hpp"
 #include "tcframe/runner/generator/TestCaseGenerator.hpp"
 
 using ::testing::_;
@@ -33,6 +34,7 @@ protected:
     MOCK(SpecClient) specClient;
     MOCK(Evaluator) evaluator;
     MOCK(GeneratorLogger) logger;
+    MOCK(SolutionOutputCache) outputCache;
 
     TestCase sampleTestCase = TestCaseBuilder()
             .setName("foo_sample_1")
@@ -60,7 +62,7 @@ protected:
             .setSolutionCommand("python Sol.py")
             .build();
 
-    TestCaseGenerator generator = {&specClient, &evaluator, &logger};
+    TestCaseGenerator generator = {&specClient, &evaluator, &logger, &outputCache};
 
     void SetUp() {
         ON_CALL(evaluator, generate(_, _, _))
@@ -202,6 +204,7 @@ TEST_F(TestCaseGeneratorTests, Generation_Failed_OutputGeneration) {
                 WhenDynamicCastTo<FormattedError*>(Pointee(
                         ExecutionResults::asFormattedError({{"solution", executionResult}})))));
     }
+    EXPECT_CALL(outputCache, store(_, _, _)).Times(0);
     EXPECT_FALSE(generator.generate(officialTestCase, options));
 }
 
@@ -217,4 +220,47 @@ TEST_F(TestCaseGeneratorTests, Generation_Failed_OutputValidation) {
     EXPECT_FALSE(generator.generate(officialTestCase, options));
 }
 
+TEST_F(TestCaseGeneratorTests, AppendingInput) {
+    ostringstream out;
+    {
+        InSequence sequence;
+        EXPECT_CALL(logger, logTestCaseIntroduction("foo_1"));
+        EXPECT_CALL(specClient, appendTestCaseInput("foo_1", &out));
+        EXPECT_CALL(logger, logTestCaseSuccessfulResult());
+    }
+    EXPECT_CALL(evaluator, generate(_, _, _)).Times(0);
+    EXPECT_TRUE(generator.appendInput(officialTestCase, &out));
+}
+
+TEST_F(TestCaseGeneratorTests, AppendingInput_Failed) {
+    string message = "input error";
+    ON_CALL(specClient, appendTestCaseInput(_, _))
+            .WillByDefault(Throw(runtime_error(message)));
+    {
+        InSequence sequence;
+        EXPECT_CALL(logger, logTestCaseFailedResult(optional<string>("N = 42")));
+        EXPECT_CALL(logger, logError(Truly(SimpleErrorMessageIs(message))));
+    }
+    ostringstream out;
+    EXPECT_FALSE(generator.appendInput(officialTestCase, &out));
+}
+
+TEST_F(TestCaseGeneratorTests, OutputGeneration) {
+    {
+        InSequence sequence;
+        EXPECT_CALL(outputCache, restore("dir/foo_1.in", "dir/foo_1.out", options));
+        EXPECT_CALL(evaluator, generate("dir/foo_1.in", "dir/foo_1.out", evaluationOptions));
+        EXPECT_CALL(outputCache, store("dir/foo_1.in", "dir/foo_1.out", options));
+    }
+    generator.generateOutput("dir/foo_1.in", "dir/foo_1.out", options);
+}
+
+TEST_F(TestCaseGeneratorTests, OutputGeneration_Cached) {
+    ON_CALL(outputCache, restore("dir/foo_1.in", "dir/foo_1.out", options))
+            .WillByDefault(Return(true));
+    EXPECT_CALL(evaluator, generate(_, _, _)).Times(0);
+    EXPECT_CALL(outputCache, store(_, _, _)).Times(0);
+    generator.generateOutput("dir/foo_1.in", "dir/foo_1.out", options);
+}
+
 }
@@ -0,0 +1,56 @@
+#include "gmock/gmock.h"
+#include "../../mock.hpp"
+
+#include "MockGraderLogger.hpp"
+#include "tcframe/runner/grader/BufferedGraderLogger.hpp"
+
+using ::testing::_;
+using ::testing::InSequence;
+using ::testing::Invoke;
+using ::testing::Test;
+
+namespace tcframe {
+
+class BufferedGraderLoggerTests : public Test {
+protected:
+    MOCK(GraderLogger) logger;
+
+    BufferedGraderLogger bufferedLogger;
+};
+
+TEST_F(BufferedGraderLoggerTests, Replay) {
+    bufferedLogger.logTestGroupIntroduction(2);
+    bufferedLogger.logTestCaseIntroduction("foo_2_1");
+    bufferedLogger.logTestCaseVerdict(TestCaseVerdict(Verdict::wa()));
+    {
+        FormattedError error({{0, "scorer: Diff:"}});
+        bufferedLogger.logError(&error);
+    }
+    bufferedLogger.logTestCaseIntroduction("foo_2_2");
+    bufferedLogger.logTestCaseSkipped();
+
+    auto entries = bufferedLogger.release();
+    {
+        InSequence sequence;
+        EXPECT_CALL(logger, logTestGroupIntroduction(2));
+        EXPECT_CALL(logger, logTestCaseIntroduction("foo_2_1"));
+        EXPECT_CALL(logger, logTestCaseVerdict(TestCaseVerdict(Verdict::wa())));
+        EXPECT_CALL(logger, logError(_)).WillOnce(Invoke([] (runtime_error* e) {
+            auto formattedE = dynamic_cast<FormattedError*>(e);
+            ASSERT_NE(formattedE, nullptr);
+            EXPECT_EQ(*formattedE, FormattedError({{0, "scorer: Diff:"}}));
+        }));
+        EXPECT_CALL(logger, logTestCaseIntroduction("foo_2_2"));
+        EXPECT_CALL(logger, logTestCaseSkipped());
+    }
+    BufferedGraderLogger::replay(entries, &logger);
+}
+
+TEST_F(BufferedGraderLoggerTests, Release_ClearsEntries) {
+    bufferedLogger.logTestCaseIntroduction("foo_1");
+    bufferedLogger.release();
+
+    EXPECT_TRUE(bufferedLogger.release().empty());
+}
+
+}
@@ -4,6 +4,7 @@
 #include "../logger/MockLoggerEngine.hpp"
 #include "tcframe/runner/grader/DefaultGraderLogger.hpp"
 
+using ::testing::_;
 using ::testing::InSequence;
 using ::testing::Test;
 
@@ -28,6 +29,21 @@ TEST_F(DefaultGraderLoggerTests, TestCaseVerdict) {
     logger.logTestCaseVerdict(TestCaseVerdict(Verdict::ac()));
 }
 
+TEST_F(DefaultGraderLoggerTests, TestCaseVerdict_WithUsage) {
+    EXPECT_CALL(engine, logParagraph(0, Verdict::ac().name() + " (100 ms CPU, 120 ms wall, 2048 KB)"));
+
+    logger.logTestCaseVerdict(TestCaseVerdict(
+            Verdict::ac(),
+            optional<double>(),
+            optional<ResourceUsage>(ResourceUsage(100, 120, 2048))));
+}
+
+TEST_F(DefaultGraderLoggerTests, TestCaseSkipped) {
+    EXPECT_CALL(engine, logParagraph(0, "Skipped"));
+
+    logger.logTestCaseSkipped();
+}
+
 TEST_F(DefaultGraderLoggerTests, Result) {
     SubtaskVerdict verdict(Verdict::ac(), 100);
     {
@@ -56,4 +72,35 @@ TEST_F(DefaultGraderLoggerTests, Result_WithSubtasks) {
             verdict);
 }
 
+TEST_F(DefaultGraderLoggerTests, Result_WithUsage) {
+    optional<ResourceUsage> usage1(ResourceUsage(300, 320, 1024));
+    optional<ResourceUsage> usage2(ResourceUsage(100, 500, 4096));
+    optional<ResourceUsage> usage3(ResourceUsage(300, 350, 2048));
+    optional<ResourceUsage> maxUsage(ResourceUsage(300, 500, 4096));
+
+    SubtaskVerdict verdict(Verdict::ac(), 100, maxUsage);
+    {
+        InSequence sequence;
+        EXPECT_CALL(engine, logHangingParagraph(1, "foo_1: "));
+        EXPECT_CALL(engine, logParagraph(0, _));
+        EXPECT_CALL(engine, logHangingParagraph(1, "foo_2: "));
+        EXPECT_CALL(engine, logParagraph(0, _));
+        EXPECT_CALL(engine, logHangingParagraph(1, "foo_3: "));
+        EXPECT_CALL(engine, logParagraph(0, _));
+        EXPECT_CALL(engine, logHeading("VERDICT"));
+        EXPECT_CALL(engine, logParagraph(1, verdict.toString() + " (max: 300 ms CPU, 500 ms wall, 4096 KB)"));
+        EXPECT_CALL(engine, logHeading("SLOWEST TEST CASES"));
+        EXPECT_CALL(engine, logParagraph(1, "foo_3: 300 ms CPU, 350 ms wall, 2048 KB"));
+        EXPECT_CALL(engine, logParagraph(1, "foo_1: 300 ms CPU, 320 ms wall, 1024 KB"));
+        EXPECT_CALL(engine, logParagraph(1, "foo_2: 100 ms CPU, 500 ms wall, 4096 KB"));
+    }
+    logger.logTestCaseIntroduction("foo_1");
+    logger.logTestCaseVerdict(TestCaseVerdict(Verdict::ac(), optional<double>(), usage1));
+    logger.logTestCaseIntroduction("foo_2");
+    logger.logTestCaseVerdict(TestCaseVerdict(Verdict::ac(), optional<double>(), usage2));
+    logger.logTestCaseIntroduction("foo_3");
+    logger.logTestCaseVerdict(TestCaseVerdict(Verdict::ac(), optional<double>(), usage3));
+    logger.logResult({{Subtask::MAIN_ID, verdict}}, verdict);
+}
+
 }
@@ -5,13 +5,17 @@
 #include "../aggregator/MockSubtaskAggregator.hpp"
 #include "../aggregator/MockTestCaseAggregator.hpp"
 #include "../client/MockSpecClient.hpp"
+#include "MockGradingScheduler.hpp"
 #include "MockTestCaseGrader.hpp"
 #include "MockGraderLogger.hpp"
 #include "tcframe/runner/grader/Grader.hpp"
 
 using ::testing::_;
+using ::testing::AnyNumber;
 using ::testing::Eq;
 using ::testing::InSequence;
+using ::testing::Invoke;
+using ::testing::NotNull;
 using ::testing::Property;
 using ::testing::Return;
 using ::testing::StartsWith;
@@ -78,6 +82,22 @@ protected:
 
     Grader grader = {&specClient, &testCaseGrader, &testCaseAggregator, &subtaskAggregator, &logger};
 
+    MOCK(TestCaseGrader) workerTestCaseGrader1;
+    MOCK(TestCaseGrader) workerTestCaseGrader2;
+    BufferedGraderLogger workerLogger1;
+    BufferedGraderLogger workerLogger2;
+
+    Grader parallelGrader = {&specClient, &testCaseGrader, &testCaseAggregator, &subtaskAggregator, &logger, {
+            GradingWorker(&workerTestCaseGrader1, &workerLogger1),
+            GradingWorker(&workerTestCaseGrader2, &workerLogger2)}, nullptr};
+
+    map<string, TestCaseVerdict> verdictsByName = {
+            {"foo_sample_1", stc1Verdict},
+            {"foo_sample_2", stc2Verdict},
+            {"foo_1_1", tc1Verdict},
+            {"foo_2_1", tc2Verdict},
+            {"foo_3_1", tc3Verdict}};
+
     void SetUp() {
         ON_CALL(specClient, hasMultipleTestCases())
                 .WillByDefault(Return(false));
@@ -90,6 +110,19 @@ protected:
         ON_CALL(testCaseGrader, grade(tc1, _)).WillByDefault(Return(tc1Verdict));
         ON_CALL(testCaseGrader, grade(tc2, _)).WillByDefault(Return(tc2Verdict));
         ON_CALL(testCaseGrader, grade(tc3, _)).WillByDefault(Return(tc3Verdict));
+
+        // The worker graders run on other threads, so the verdicts are only looked up, never inserted.
+        const map<string, TestCaseVerdict>& verdicts = verdictsByName;
+        ON_CALL(workerTestCaseGrader1, grade(_, _)).WillByDefault(Invoke(
+                [&] (const TestCase& testCase, const GradingOptions&) {
+                    workerLogger1.logTestCaseIntroduction(testCase.name());
+                    return verdicts.at(testCase.name());
+                }));
+        ON_CALL(workerTestCaseGrader2, grade(_, _)).WillByDefault(Invoke(
+                [&] (const TestCase& testCase, const GradingOptions&) {
+                    workerLogger2.logTestCaseIntroduction(testCase.name());
+                    return verdicts.at(testCase.name());
+                }));
     }
 };
 
@@ -121,6 +154,28 @@ TEST_F(GraderTests, Grading) {
     grader.grade(options);
 }
 
+TEST_F(GraderTests, Grading_WithUsage) {
+    optional<ResourceUsage> usageA(ResourceUsage(100, 300, 1024));
+    optional<ResourceUsage> usageB(ResourceUsage(200, 250, 512));
+    optional<ResourceUsage> maxUsage(ResourceUsage(200, 300, 1024));
+    TestCaseVerdict tcAVerdictWithUsage(Verdict::ac(), optional<double>(), usageA);
+    TestCaseVerdict tcBVerdictWithUsage(Verdict::ac(), optional<double>(), usageB);
+    SubtaskVerdict mainSubtaskVerdictWithUsage(Verdict::ac(), Subtask::MAIN_POINTS, maxUsage);
+
+    ON_CALL(specClient, getTestSuite())
+            .WillByDefault(Return(testSuiteWithoutSample));
+    ON_CALL(testCaseGrader, grade(tcA, _)).WillByDefault(Return(tcAVerdictWithUsage));
+    ON_CALL(testCaseGrader, grade(tcB, _)).WillByDefault(Return(tcBVerdictWithUsage));
+    ON_CALL(testCaseAggregator, aggregate(_, _)).WillByDefault(Return(mainSubtaskVerdict));
+    ON_CALL(subtaskAggregator, aggregate(_)).WillByDefault(Return(mainSubtaskVerdict));
+
+    EXPECT_CALL(subtaskAggregator, aggregate(vector<SubtaskVerdict>{mainSubtaskVerdictWithUsage}));
+    EXPECT_CALL(logger, logResult(
+            map<int, SubtaskVerdict>{{Subtask::MAIN_ID, mainSubtaskVerdictWithUsage}},
+            mainSubtaskVerdictWithUsage));
+    grader.grade(options);
+}
+
 TEST_F(GraderTests, Grading_MultipleTestCases) {
     ON_CALL(specClient, getTestSuite())
             .WillByDefault(Return(testSuite));
@@ -236,4 +291,232 @@ TEST_F(GraderTests, Grading_WithSubtasks_MultipleTestCases) {
     grader.grade(optionsWithSubtasks);
 }
 
+TEST_F(GraderTests, Grading_Parallel) {
+    ON_CALL(specClient, getTestSuite())
+            .WillByDefault(Return(testSuiteWithSubtasks));
+    {
+        InSequence sequence;
+        EXPECT_CALL(logger, logIntroduction("python Sol.py"));
+        EXPECT_CALL(logger, logTestGroupIntroduction(TestGroup::SAMPLE_ID));
+        EXPECT_CALL(logger, logTestCaseIntroduction("foo_sample_1"));
+        EXPECT_CALL(logger, logTestCaseIntroduction("foo_sample_2"));
+        EXPECT_CALL(logger, logTestGroupIntroduction(1));
+        EXPECT_CALL(logger, logTestCaseIntroduction("foo_1_1"));
+        EXPECT_CALL(logger, logTestCaseIntroduction("foo_2_1"));
+        EXPECT_CALL(logger, logTestGroupIntroduction(2));
+        EXPECT_CALL(logger, logTestCaseIntroduction("foo_3_1"));
+
+        EXPECT_CALL(testCaseAggregator, aggregate(vector<TestCaseVerdict>{stc1Verdict, tc1Verdict, tc2Verdict}, 40))
+                .WillOnce(Return(subtask1Verdict));
+        EXPECT_CALL(testCaseAggregator, aggregate(
+                vector<TestCaseVerdict>{stc1Verdict, stc2Verdict, tc1Verdict, tc2Verdict, tc3Verdict}, 50))
+                .WillOnce(Return(subtask2Verdict));
+        EXPECT_CALL(subtaskAggregator, aggregate(vector<SubtaskVerdict>{subtask1Verdict, subtask2Verdict}))
+                .WillOnce(Return(verdict));
+
+        EXPECT_CALL(logger, logResult(
+                map<int, SubtaskVerdict>{{1, subtask1Verdict}, {2, subtask2Verdict}},
+                verdict));
+    }
+    EXPECT_CALL(testCaseGrader, grade(_, _)).Times(0);
+
+    parallelGrader.grade(optionsWithSubtasks);
+}
+
+TEST_F(GraderTests, Grading_WithSubtasks_StopOnFirstFailure) {
+    GradingOptions stoppingOptions = GradingOptionsBuilder(optionsWithSubtasks)
+            .setStopsOnFirstFailure(true)
+            .build();
+    TestCaseVerdict stc2WaVerdict(Verdict::wa());
+    TestCaseVerdict tc1WaVerdict(Verdict::rte());
+
+    ON_CALL(specClient, getTestSuite())
+            .WillByDefault(Return(testSuiteWithSubtasks));
+    ON_CALL(testCaseGrader, grade(stc2, _)).WillByDefault(Return(stc2WaVerdict));
+    ON_CALL(testCaseGrader, grade(tc1, _)).WillByDefault(Return(tc1WaVerdict));
+    ON_CALL(testCaseAggregator, zeroesSubtask(stc2WaVerdict)).WillByDefault(Return(true));
+    ON_CALL(testCaseAggregator, zeroesSubtask(tc1WaVerdict)).WillByDefault(Return(true));
+    {
+        InSequence sequence;
+        EXPECT_CALL(logger, logIntroduction("python Sol.py"));
+        EXPECT_CALL(logger, logTestGroupIntroduction(TestGroup::SAMPLE_ID));
+        EXPECT_CALL(testCaseGrader, grade(stc1, stoppingOptions));
+        EXPECT_CALL(testCaseGrader, grade(stc2, stoppingOptions));
+        EXPECT_CALL(logger, logTestGroupIntroduction(1));
+        EXPECT_CALL(testCaseGrader, grade(tc1, stoppingOptions));
+        EXPECT_CALL(logger, logTestCaseIntroduction("foo_2_1"));
+        EXPECT_CALL(logger, logTestCaseSkipped());
+        EXPECT_CALL(logger, logTestGroupIntroduction(2));
+        EXPECT_CALL(logger, logTestCaseIntroduction("foo_3_1"));
+        EXPECT_CALL(logger, logTestCaseSkipped());
+
+        EXPECT_CALL(testCaseAggregator, aggregate(vector<TestCaseVerdict>{stc1Verdict, tc1WaVerdict}, 40))
+                .WillOnce(Return(subtask1Verdict));
+        EXPECT_CALL(testCaseAggregator, aggregate(
+                vector<TestCaseVerdict>{stc1Verdict, stc2WaVerdict, tc1WaVerdict}, 50))
+                .WillOnce(Return(subtask2Verdict));
+        EXPECT_CALL(subtaskAggregator, aggregate(vector<SubtaskVerdict>{subtask1Verdict, subtask2Verdict}))
+                .WillOnce(Return(verdict));
+
+        EXPECT_CALL(logger, logResult(
+                map<int, SubtaskVerdict>{{1, subtask1Verdict}, {2, subtask2Verdict}},
+                verdict));
+    }
+    EXPECT_CALL(testCaseGrader, grade(tc2, _)).Times(0);
+    EXPECT_CALL(testCaseGrader, grade(tc3, _)).Times(0);
+
+    grader.grade(stoppingOptions);
+}
+
+TEST_F(GraderTests, Grading_Parallel_StopOnFirstFailure) {
+    GradingOptions stoppingOptions = GradingOptionsBuilder(optionsWithSubtasks)
+            .setStopsOnFirstFailure(true)
+            .build();
+    TestCaseVerdict stc2WaVerdict(Verdict::wa());
+    TestCaseVerdict tc1WaVerdict(Verdict::rte());
+    verdictsByName["foo_sample_2"] = stc2WaVerdict;
+    verdictsByName["foo_1_1"] = tc1WaVerdict;
+
+    ON_CALL(specClient, getTestSuite())
+            .WillByDefault(Return(testSuiteWithSubtasks));
+    ON_CALL(testCaseAggregator, zeroesSubtask(stc2WaVerdict)).WillByDefault(Return(true));
+    ON_CALL(testCaseAggregator, zeroesSubtask(tc1WaVerdict)).WillByDefault(Return(true));
+    {
+        InSequence sequence;
+        EXPECT_CALL(logger, logIntroduction("python Sol.py"));
+        EXPECT_CALL(logger, logTestGroupIntroduction(TestGroup::SAMPLE_ID));
+        EXPECT_CALL(logger, logTestCaseIntroduction("foo_sample_1"));
+        EXPECT_CALL(logger, logTestCaseIntroduction("foo_sample_2"));
+        EXPECT_CALL(logger, logTestGroupIntroduction(1));
+        EXPECT_CALL(logger, logTestCaseIntroduction("foo_1_1"));
+        EXPECT_CALL(logger, logTestCaseIntroduction("foo_2_1"));
+        EXPECT_CALL(logger, logTestCaseSkipped());
+        EXPECT_CALL(logger, logTestGroupIntroduction(2));
+        EXPECT_CALL(logger, logTestCaseIntroduction("foo_3_1"));
+        EXPECT_CALL(logger, logTestCaseSkipped());
+
+        EXPECT_CALL(testCaseAggregator, aggregate(vector<TestCaseVerdict>{stc1Verdict, tc1WaVerdict}, 40))
+                .WillOnce(Return(subtask1Verdict));
+        EXPECT_CALL(testCaseAggregator, aggregate(
+                vector<TestCaseVerdict>{stc1Verdict, stc2WaVerdict, tc1WaVerdict}, 50))
+                .WillOnce(Return(subtask2Verdict));
+        EXPECT_CALL(subtaskAggregator, aggregate(vector<SubtaskVerdict>{subtask1Verdict, subtask2Verdict}))
+                .WillOnce(Return(verdict));
+
+        EXPECT_CALL(logger, logResult(
+                map<int, SubtaskVerdict>{{1, subtask1Verdict}, {2, subtask2Verdict}},
+                verdict));
+    }
+
+    parallelGrader.grade(stoppingOptions);
+}
+
+TEST_F(GraderTests, Grading_Reordered_StopOnFirstFailure) {
+    MOCK(GradingScheduler) scheduler;
+    Grader reorderingGrader = {&specClient, &testCaseGrader, &testCaseAggregator, &subtaskAggregator, &logger, {
+            GradingWorker(&workerTestCaseGrader1, &workerLogger1)}, &scheduler};
+
+    GradingOptions stoppingOptions = GradingOptionsBuilder(optionsWithSubtasks)
+            .setStopsOnFirstFailure(true)
+            .setOrder(GradingOrder::FAILING_FIRST)
+            .build();
+    TestCaseVerdict tc2RteVerdict(Verdict::rte());
+    verdictsByName["foo_2_1"] = tc2RteVerdict;
+
+    ON_CALL(specClient, getTestSuite())
+            .WillByDefault(Return(testSuiteWithSubtasks));
+    ON_CALL(testCaseAggregator, zeroesSubtask(tc2RteVerdict)).WillByDefault(Return(true));
+    EXPECT_CALL(scheduler, schedule(vector<TestCase>{stc1, stc2, tc1, tc2, tc3}, stoppingOptions))
+            .WillOnce(Return(vector<size_t>{3, 0, 1, 2, 4}));
+    EXPECT_CALL(workerTestCaseGrader1, grade(_, _)).Times(AnyNumber());
+    EXPECT_CALL(workerTestCaseGrader1, grade(tc2, stoppingOptions));
+    {
+        InSequence sequence;
+        EXPECT_CALL(logger, logIntroduction("python Sol.py"));
+        EXPECT_CALL(logger, logTestGroupIntroduction(TestGroup::SAMPLE_ID));
+        EXPECT_CALL(logger, logTestCaseIntroduction("foo_sample_1"));
+        EXPECT_CALL(logger, logTestCaseSkipped());
+        EXPECT_CALL(logger, logTestCaseIntroduction("foo_sample_2"));
+        EXPECT_CALL(logger, logTestCaseSkipped());
+        EXPECT_CALL(logger, logTestGroupIntroduction(1));
+        EXPECT_CALL(logger, logTestCaseIntroduction("foo_1_1"));
+        EXPECT_CALL(logger, logTestCaseSkipped());
+        EXPECT_CALL(logger, logTestCaseIntroduction("foo_2_1"));
+        EXPECT_CALL(scheduler, record(tc2, tc2RteVerdict, stoppingOptions));
+        EXPECT_CALL(logger, logTestGroupIntroduction(2));
+        EXPECT_CALL(logger, logTestCaseIntroduction("foo_3_1"));
+        EXPECT_CALL(logger, logTestCaseSkipped());
+        EXPECT_CALL(scheduler, save(stoppingOptions));
+
+        EXPECT_CALL(testCaseAggregator, aggregate(vector<TestCaseVerdict>{tc2RteVerdict}, 40))
+                .WillOnce(Return(subtask1Verdict));
+        EXPECT_CALL(testCaseAggregator, aggregate(vector<TestCaseVerdict>{tc2RteVerdict}, 50))
+                .WillOnce(Return(subtask2Verdict));
+        EXPECT_CALL(subtaskAggregator, aggregate(vector<SubtaskVerdict>{subtask1Verdict, subtask2Verdict}))
+                .WillOnce(Return(verdict));
+
+        EXPECT_CALL(logger, logResult(
+                map<int, SubtaskVerdict>{{1, subtask1Verdict}, {2, subtask2Verdict}},
+                verdict));
+    }
+    EXPECT_CALL(testCaseGrader, grade(_, _)).Times(0);
+
+    reorderingGrader.grade(stoppingOptions);
+}
+
+TEST_F(GraderTests, Grading_Reordered_Sequential_StopOnFirstFailure) {
+    MOCK(GradingScheduler) scheduler;
+    Grader reorderingGrader = {
+            &specClient, &testCaseGrader, &testCaseAggregator, &subtaskAggregator, &logger, {}, &scheduler};
+
+    GradingOptions stoppingOptions = GradingOptionsBuilder(optionsWithSubtasks)
+            .setStopsOnFirstFailure(true)
+            .setOrder(GradingOrder::FAILING_FIRST)
+            .build();
+    TestCaseVerdict tc2RteVerdict(Verdict::rte());
+
+    ON_CALL(specClient, getTestSuite())
+            .WillByDefault(Return(testSuiteWithSubtasks));
+    ON_CALL(testCaseAggregator, zeroesSubtask(tc2RteVerdict)).WillByDefault(Return(true));
+    EXPECT_CALL(scheduler, schedule(vector<TestCase>{stc1, stc2, tc1, tc2, tc3}, stoppingOptions))
+            .WillOnce(Return(vector<size_t>{3, 0, 1, 2, 4}));
+    EXPECT_CALL(testCaseGrader, grade(_, _)).Times(0);
+    EXPECT_CALL(testCaseGrader, grade(tc2, stoppingOptions, NotNull())).WillOnce(Invoke(
+            [&] (const TestCase& testCase, const GradingOptions&, GraderLogger* bufferedLogger) {
+                bufferedLogger->logTestCaseIntroduction(testCase.name());
+                return tc2RteVerdict;
+            }));
+    {
+        InSequence sequence;
+        EXPECT_CALL(logger, logIntroduction("python Sol.py"));
+        EXPECT_CALL(logger, logTestGroupIntroduction(TestGroup::SAMPLE_ID));
+        EXPECT_CALL(logger, logTestCaseIntroduction("foo_sample_1"));
+        EXPECT_CALL(logger, logTestCaseSkipped());
+        EXPECT_CALL(logger, logTestCaseIntroduction("foo_sample_2"));
+        EXPECT_CALL(logger, logTestCaseSkipped());
+        EXPECT_CALL(logger, logTestGroupIntroduction(1));
+        EXPECT_CALL(logger, logTestCaseIntroduction("foo_1_1"));
+        EXPECT_CALL(logger, logTestCaseSkipped());
+        EXPECT_CALL(logger, logTestCaseIntroduction("foo_2_1"));
+        EXPECT_CALL(scheduler, record(tc2, tc2RteVerdict, stoppingOptions));
+        EXPECT_CALL(logger, logTestGroupIntroduction(2));
+        EXPECT_CALL(logger, logTestCaseIntroduction("foo_3_1"));
+        EXPECT_CALL(logger, logTestCaseSkipped());
+        EXPECT_CALL(scheduler, save(stoppingOptions));
+
+        EXPECT_CALL(testCaseAggregator, aggregate(vector<TestCaseVerdict>{tc2RteVerdict}, 40))
+                .WillOnce(Return(subtask1Verdict));
+        EXPECT_CALL(testCaseAggregator, aggregate(vector<TestCaseVerdict>{tc2RteVerdict}, 50))
+                .WillOnce(Return(subtask2Verdict));
+        EXPECT_CALL(subtaskAggregator, aggregate(vector<SubtaskVerdict>{subtask1Verdict, subtask2Verdict}))
+                .WillOnce(Return(verdict));
+
+        EXPECT_CALL(logger, logResult(
+                map<int, SubtaskVerdict>{{1, subtask1Verdict}, {2, subtask2Verdict}},
+                verdict));
+    }
+
+    reorderingGrader.grade(stoppingOptions);
+}
+
 }
@@ -0,0 +1,63 @@
+#include "gmock/gmock.h"
+
+#include <sstream>
+
+#include "tcframe/runner/grader/GradingHistory.hpp"
+
+using ::testing::Eq;
+using ::testing::Test;
+
+using std::istringstream;
+using std::ostringstream;
+
+namespace tcframe {
+
+class GradingHistoryTests : public Test {
+protected:
+    static TestCaseVerdict createVerdict(Verdict verdict, int cpuTimeMs) {
+        return {verdict, optional<double>(), optional<ResourceUsage>(ResourceUsage(cpuTimeMs, cpuTimeMs, 1024))};
+    }
+};
+
+TEST_F(GradingHistoryTests, Record) {
+    GradingHistory history;
+    history.record("foo_1", createVerdict(Verdict::ac(), 100));
+    history.record("foo_1", createVerdict(Verdict::wa(), 200));
+    history.record("foo_1", TestCaseVerdict(Verdict::ok(), 10));
+    history.record("foo_1", TestCaseVerdict(Verdict::tle()));
+
+    TestCaseHistory entry = history.get("foo_1");
+    EXPECT_THAT(entry.runs, Eq(4));
+    EXPECT_THAT(entry.failures, Eq(2));
+    EXPECT_THAT(entry.totalCpuTimeMs, Eq(300));
+    EXPECT_THAT(entry.failureRate(), Eq(0.5));
+    EXPECT_THAT(entry.averageCpuTimeMs(), Eq(75));
+}
+
+TEST_F(GradingHistoryTests, Get_Unknown) {
+    EXPECT_THAT(GradingHistory().get("foo_1"), Eq(TestCaseHistory()));
+    EXPECT_THAT(GradingHistory().get("foo_1").failureRate(), Eq(0));
+}
+
+TEST_F(GradingHistoryTests, ReadAndWrite) {
+    GradingHistory history;
+    history.record("foo_2", TestCaseVerdict(Verdict::rte()));
+    history.record("foo_1", createVerdict(Verdict::ac(), 100));
+
+    ostringstream out;
+    history.write(&out);
+    EXPECT_THAT(out.str(), Eq("foo_1 1 0 100\nfoo_2 1 1 0\n"));
+
+    istringstream in(out.str());
+    EXPECT_THAT(GradingHistory::read(&in), Eq(history));
+}
+
+TEST_F(GradingHistoryTests, Read_Malformed) {
+    istringstream in("foo_1 3 1 100\nfoo_2 bogus\nfoo_3 1 1 0\n");
+    GradingHistory history = GradingHistory::read(&in);
+
+    EXPECT_THAT(history.get("foo_1").runs, Eq(3));
+    EXPECT_THAT(history.get("foo_3").runs, Eq(0));
+}
+
+}
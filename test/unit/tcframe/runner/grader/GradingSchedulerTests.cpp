@@ -0,0 +1,83 @@
+#include "gmock/gmock.h"
+#include "../../mock.hpp"
+
+#include <sstream>
+
+#include "../../util/TestUtils.hpp"
+#include "../os/MockOperatingSystem.hpp"
+#include "tcframe/runner/grader/GradingScheduler.hpp"
+
+using ::testing::_;
+using ::testing::Eq;
+using ::testing::InvokeWithoutArgs;
+using ::testing::Return;
+using ::testing::Test;
+
+using std::istringstream;
+using std::ostringstream;
+
+namespace tcframe {
+
+class GradingSchedulerTests : public Test {
+protected:
+    MOCK(OperatingSystem) os;
+
+    vector<TestCase> testCases = {
+            TestUtils::newSampleTestCase("foo_sample_1"),
+            TestUtils::newTestCase("foo_1"),
+            TestUtils::newTestCase("foo_2"),
+            TestUtils::newTestCase("foo_3")};
+
+    GradingOptions options = GradingOptionsBuilder("foo")
+            .setSolutionCommand("python Sol.py")
+            .setOutputDir("dir")
+            .build();
+
+    GradingScheduler scheduler = GradingScheduler(&os);
+
+    void expectReading(const string& filename, const string& content) {
+        EXPECT_CALL(os, openForReading(filename)).WillOnce(InvokeWithoutArgs([=] {
+            return new istringstream(content);
+        }));
+    }
+};
+
+TEST_F(GradingSchedulerTests, Schedule_Canonical) {
+    EXPECT_CALL(os, openForReading(_)).Times(0);
+    EXPECT_CALL(os, openForWriting(_)).Times(0);
+
+    EXPECT_THAT(scheduler.schedule(testCases, options), Eq(vector<size_t>{0, 1, 2, 3}));
+    scheduler.record(testCases[1], TestCaseVerdict(Verdict::wa()), options);
+    scheduler.save(options);
+}
+
+TEST_F(GradingSchedulerTests, Schedule_SmallestFirst) {
+    expectReading("dir/foo_sample_1.in", "1 2\n");
+    expectReading("dir/foo_1.in", "10 20\n");
+    expectReading("dir/foo_2.in", "1\n");
+    expectReading("dir/foo_3.in", "3 4\n");
+
+    GradingOptions smallestFirstOptions = GradingOptionsBuilder(options)
+            .setOrder(GradingOrder::SMALLEST_FIRST)
+            .build();
+    EXPECT_THAT(scheduler.schedule(testCases, smallestFirstOptions), Eq(vector<size_t>{2, 0, 3, 1}));
+}
+
+TEST_F(GradingSchedulerTests, Schedule_FailingFirst) {
+    expectReading(".tcframe_grading_history", "foo_1 4 1 100\nfoo_2 2 1 300\nfoo_3 2 1 200\n");
+    ostringstream* out = new ostringstream();
+    EXPECT_CALL(os, openForWriting(".tcframe_grading_history")).WillOnce(Return(out));
+
+    GradingOptions failingFirstOptions = GradingOptionsBuilder(options)
+            .setOrder(GradingOrder::FAILING_FIRST)
+            .build();
+    EXPECT_THAT(scheduler.schedule(testCases, failingFirstOptions), Eq(vector<size_t>{3, 2, 1, 0}));
+
+    scheduler.record(testCases[0], TestCaseVerdict(Verdict::wa()), failingFirstOptions);
+    scheduler.record(testCases[1], TestCaseVerdict(Verdict::ac()), failingFirstOptions);
+    scheduler.save(failingFirstOptions);
+    EXPECT_THAT(out->str(), Eq("foo_1 5 1 100\nfoo_2 2 1 300\nfoo_3 2 1 200\nfoo_sample_1 1 1 0\n"));
+    delete out;
+}
+
+}
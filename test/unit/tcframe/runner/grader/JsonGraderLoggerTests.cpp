@@ -0,0 +1,107 @@
+#include "gmock/gmock.h"
+#include "../../mock.hpp"
+
+#include "../logger/MockJsonLoggerEngine.hpp"
+#include "tcframe/runner/grader/JsonGraderLogger.hpp"
+
+using ::testing::InSequence;
+using ::testing::Test;
+
+namespace tcframe {
+
+class JsonGraderLoggerTests : public Test {
+protected:
+    MOCK(JsonLoggerEngine) engine;
+
+    JsonGraderLogger logger = JsonGraderLogger(&engine);
+};
+
+TEST_F(JsonGraderLoggerTests, Introduction) {
+    EXPECT_CALL(engine, logObject(JsonObject()
+            .add("event", "grading")
+            .add("solution", "./solution")));
+
+    logger.logIntroduction("./solution");
+}
+
+TEST_F(JsonGraderLoggerTests, TestCaseVerdict) {
+    EXPECT_CALL(engine, logObject(JsonObject()
+            .add("event", "test_case")
+            .add("name", "foo_1")
+            .add("verdict", "AC")));
+
+    logger.logTestCaseIntroduction("foo_1");
+    logger.logTestCaseVerdict(TestCaseVerdict(Verdict::ac()));
+}
+
+TEST_F(JsonGraderLoggerTests, TestCaseVerdict_WithPointsAndUsage) {
+    EXPECT_CALL(engine, logObject(JsonObject()
+            .add("event", "test_case")
+            .add("name", "foo_1")
+            .add("verdict", "OK")
+            .add("points", 7.5)
+            .add("cpu_ms", 100)
+            .add("wall_ms", 120)
+            .add("memory_kb", 2048)));
+
+    logger.logTestCaseIntroduction("foo_1");
+    logger.logTestCaseVerdict(TestCaseVerdict(
+            Verdict::ok(),
+            optional<double>(7.5),
+            optional<ResourceUsage>(ResourceUsage(100, 120, 2048))));
+}
+
+TEST_F(JsonGraderLoggerTests, TestCaseSkipped) {
+    EXPECT_CALL(engine, logObject(JsonObject()
+            .add("event", "test_case")
+            .add("name", "foo_1")
+            .add("skipped", true)));
+
+    logger.logTestCaseIntroduction("foo_1");
+    logger.logTestCaseSkipped();
+}
+
+TEST_F(JsonGraderLoggerTests, Result) {
+    SubtaskVerdict verdict(Verdict::ac(), 100);
+    EXPECT_CALL(engine, logObject(JsonObject()
+            .add("event", "result")
+            .add("verdict", "AC")
+            .add("points", 100.0)));
+
+    logger.logResult({{Subtask::MAIN_ID, verdict}}, verdict);
+}
+
+TEST_F(JsonGraderLoggerTests, Result_WithSubtasks) {
+    SubtaskVerdict subtask1Verdict(Verdict::ac(), 70, optional<ResourceUsage>(ResourceUsage(10, 20, 30)));
+    SubtaskVerdict subtask2Verdict(Verdict::tle(), 0, optional<ResourceUsage>(ResourceUsage(40, 50, 60)));
+    SubtaskVerdict verdict(Verdict::tle(), 70, optional<ResourceUsage>(ResourceUsage(40, 50, 60)));
+    {
+        InSequence sequence;
+        EXPECT_CALL(engine, logObject(JsonObject()
+                .add("event", "subtask")
+                .add("id", 1)
+                .add("verdict", "AC")
+                .add("points", 70.0)
+                .add("cpu_ms", 10)
+                .add("wall_ms", 20)
+                .add("memory_kb", 30)));
+        EXPECT_CALL(engine, logObject(JsonObject()
+                .add("event", "subtask")
+                .add("id", 2)
+                .add("verdict", "TLE")
+                .add("points", 0.0)
+                .add("cpu_ms", 40)
+                .add("wall_ms", 50)
+                .add("memory_kb", 60)));
+        EXPECT_CALL(engine, logObject(JsonObject()
+                .add("event", "result")
+                .add("verdict", "TLE")
+                .add("points", 70.0)
+                .add("cpu_ms", 40)
+                .add("wall_ms", 50)
+                .add("memory_kb", 60)));
+    }
+    logger.logResult({{1, subtask1Verdict}, {2, subtask2Verdict}}, verdict);
+}
+
+}
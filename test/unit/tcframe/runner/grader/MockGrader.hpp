@@ -16,7 +16,14 @@ public:
 
 class MockGraderFactory : public GraderFactory {
 public:
-    MOCK_METHOD5(create, Grader*(SpecClient*, TestCaseGrader*, TestCaseAggregator*, SubtaskAggregator*, GraderLogger*));
+    MOCK_METHOD7(create, Grader*(
+            SpecClient*,
+            TestCaseGrader*,
+            TestCaseAggregator*,
+            SubtaskAggregator*,
+            GraderLogger*,
+            const vector<GradingWorker>&,
+            GradingScheduler*));
 };
 
 }
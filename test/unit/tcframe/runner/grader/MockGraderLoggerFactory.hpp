@@ -9,6 +9,7 @@ namespace tcframe {
 class MockGraderLoggerFactory : public GraderLoggerFactory {
 public:
     MOCK_METHOD2(create, GraderLogger*(LoggerEngine*, bool));
+    MOCK_METHOD1(createJson, GraderLogger*(JsonLoggerEngine*));
 };
 
 }
@@ -0,0 +1,19 @@
+#pragma once
+
+#include "gmock/gmock.h"
+
+#include "tcframe/runner/grader/GradingScheduler.hpp"
+
+namespace tcframe {
+
+class MockGradingScheduler : public GradingScheduler {
+public:
+    MockGradingScheduler()
+            : GradingScheduler(nullptr) {}
+
+    MOCK_METHOD2(schedule, vector<size_t>(const vector<TestCase>&, const GradingOptions&));
+    MOCK_METHOD3(record, void(const TestCase&, const TestCaseVerdict&, const GradingOptions&));
+    MOCK_METHOD1(save, void(const GradingOptions&));
+};
+
+}
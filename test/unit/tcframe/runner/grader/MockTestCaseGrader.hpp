@@ -12,6 +12,7 @@ public:
             : TestCaseGrader(nullptr, nullptr) {}
 
     MOCK_METHOD2(grade, TestCaseVerdict(const TestCase&, const GradingOptions&));
+    MOCK_METHOD3(grade, TestCaseVerdict(const TestCase&, const GradingOptions&, GraderLogger*));
 };
 
 }
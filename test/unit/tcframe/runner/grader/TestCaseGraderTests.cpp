@@ -28,46 +28,86 @@ protected:
             .setOutputDir("dir")
             .setTimeLimit(3)
             .setMemoryLimit(128)
+            .setRssMemoryLimit(true)
             .build();
     EvaluationOptions evaluationOptions = EvaluationOptionsBuilder()
             .setSolutionCommand("python Sol.py")
             .setTimeLimit(3)
             .setMemoryLimit(128)
+            .setRssMemoryLimit(true)
+            .setMeasuresPeakMemory(true)
             .build();
 
+    ExecutionResult executionResult = ExecutionResultBuilder()
+            .setCpuTimeMs(100)
+            .setWallTimeMs(120)
+            .setPeakMemoryKb(2048)
+            .build();
+    optional<ResourceUsage> usage = optional<ResourceUsage>(ResourceUsage(100, 120, 2048));
+
     TestCaseGrader grader = {&evaluator, &logger};
 };
 
 TEST_F(TestCaseGraderTests, Grading_AC) {
     TestCaseVerdict verdict(Verdict::ac());
-    map<string, ExecutionResult> executionResults = {{"solution", ExecutionResult()}};
+    TestCaseVerdict gradedVerdict(Verdict::ac(), optional<double>(), usage);
+    map<string, ExecutionResult> executionResults = {{"solution", executionResult}};
     ON_CALL(evaluator, evaluate(_, _, _))
             .WillByDefault(Return(EvaluationResult(verdict, executionResults)));
     {
         InSequence sequence;
         EXPECT_CALL(logger, logTestCaseIntroduction("foo_1"));
         EXPECT_CALL(evaluator, evaluate("dir/foo_1.in", "dir/foo_1.out", evaluationOptions));
-        EXPECT_CALL(logger, logTestCaseVerdict(verdict));
+        EXPECT_CALL(logger, logTestCaseVerdict(gradedVerdict));
         EXPECT_CALL(logger, logError(
                 WhenDynamicCastTo<FormattedError*>(Pointee(ExecutionResults::asFormattedError(executionResults)))));
     }
-    EXPECT_THAT(grader.grade(testCase, options), Eq(verdict));
+    EXPECT_THAT(grader.grade(testCase, options), Eq(gradedVerdict));
 }
 
 TEST_F(TestCaseGraderTests, Grading_TLE) {
     TestCaseVerdict verdict(Verdict::tle());
-    map<string, ExecutionResult> executionResults = {{"solution", ExecutionResult()}};
+    TestCaseVerdict gradedVerdict(Verdict::tle(), optional<double>(), usage);
+    map<string, ExecutionResult> executionResults = {{"solution", executionResult}};
+    ON_CALL(evaluator, evaluate(_, _, _))
+            .WillByDefault(Return(EvaluationResult(verdict, executionResults)));
+    {
+        InSequence sequence;
+        EXPECT_CALL(logger, logTestCaseIntroduction("foo_1"));
+        EXPECT_CALL(evaluator, evaluate(_, _, _));
+        EXPECT_CALL(logger, logTestCaseVerdict(gradedVerdict));
+        EXPECT_CALL(logger, logError(_)).Times(0);
+    }
+    EXPECT_THAT(grader.grade(testCase, options), Eq(gradedVerdict));
+}
+
+TEST_F(TestCaseGraderTests, Grading_MLE) {
+    TestCaseVerdict verdict(Verdict::mle());
+    TestCaseVerdict gradedVerdict(Verdict::mle(), optional<double>(), usage);
+    map<string, ExecutionResult> executionResults = {{"solution", executionResult}};
     ON_CALL(evaluator, evaluate(_, _, _))
             .WillByDefault(Return(EvaluationResult(verdict, executionResults)));
     {
         InSequence sequence;
         EXPECT_CALL(logger, logTestCaseIntroduction("foo_1"));
         EXPECT_CALL(evaluator, evaluate(_, _, _));
-        EXPECT_CALL(logger, logTestCaseVerdict(verdict));
+        EXPECT_CALL(logger, logTestCaseVerdict(gradedVerdict));
         EXPECT_CALL(logger, logError(_)).Times(0);
     }
-    EXPECT_THAT(grader.grade(testCase, options), Eq(verdict));
+    EXPECT_THAT(grader.grade(testCase, options), Eq(gradedVerdict));
 }
 
+TEST_F(TestCaseGraderTests, Grading_Interactive) {
+    TestCaseVerdict verdict(Verdict::ok(), 40);
+    TestCaseVerdict gradedVerdict(Verdict::ok(), optional<double>(40), usage);
+    map<string, ExecutionResult> executionResults = {{"communicator", executionResult}};
+    ON_CALL(evaluator, evaluate(_, _, _))
+            .WillByDefault(Return(EvaluationResult(verdict, executionResults)));
+
+    EXPECT_CALL(logger, logTestCaseIntroduction("foo_1"));
+    EXPECT_CALL(logger, logTestCaseVerdict(gradedVerdict));
+    EXPECT_CALL(logger, logError(_));
+    EXPECT_THAT(grader.grade(testCase, options), Eq(gradedVerdict));
+}
 
 }
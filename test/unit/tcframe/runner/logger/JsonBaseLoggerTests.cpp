@@ -0,0 +1,49 @@
+#include "gmock/gmock.h"
+#include "../../mock.hpp"
+
+#include "MockJsonLoggerEngine.hpp"
+#include "tcframe/runner/logger/JsonBaseLogger.hpp"
+
+using ::testing::_;
+using ::testing::Test;
+
+namespace tcframe {
+
+class JsonBaseLoggerTests : public Test {
+protected:
+    MOCK(JsonLoggerEngine) engine;
+
+    JsonBaseLogger logger = JsonBaseLogger(&engine);
+};
+
+TEST_F(JsonBaseLoggerTests, TestGroupIntroduction) {
+    EXPECT_CALL(engine, logObject(JsonObject()
+            .add("event", "test_group")
+            .add("id", 3)));
+    logger.logTestGroupIntroduction(3);
+}
+
+TEST_F(JsonBaseLoggerTests, TestCaseIntroduction) {
+    EXPECT_CALL(engine, logObject(_)).Times(0);
+    logger.logTestCaseIntroduction("foo_1");
+}
+
+TEST_F(JsonBaseLoggerTests, Error_Simple) {
+    EXPECT_CALL(engine, logObject(JsonObject()
+            .add("event", "error")
+            .add("name", "foo_1")
+            .add("messages", vector<string>{"error"})));
+    logger.logTestCaseIntroduction("foo_1");
+    logger.logError(new runtime_error("error"));
+}
+
+TEST_F(JsonBaseLoggerTests, Error_Formatted) {
+    EXPECT_CALL(engine, logObject(JsonObject()
+            .add("event", "error")
+            .add("name", "foo_1")
+            .add("messages", vector<string>{"error 1", "error 1a", "error 2"})));
+    logger.logTestCaseIntroduction("foo_1");
+    logger.logError(new FormattedError({{0, "error 1"}, {1, "error 1a"}, {0, "error 2"}}));
+}
+
+}
@@ -0,0 +1,55 @@
+#include "gmock/gmock.h"
+
+#include <sstream>
+#include <streambuf>
+
+#include "tcframe/runner/logger/JsonLoggerEngine.hpp"
+
+using ::testing::Eq;
+using ::testing::Test;
+
+using std::ostringstream;
+using std::streambuf;
+
+namespace tcframe {
+
+class JsonLoggerEngineTests : public Test {
+private:
+    streambuf* coutBuf;
+
+protected:
+    ostringstream sout;
+    JsonLoggerEngine engine;
+
+    void SetUp() {
+        coutBuf = cout.rdbuf();
+        cout.rdbuf(sout.rdbuf());
+    }
+
+    void TearDown() {
+        cout.rdbuf(coutBuf);
+    }
+};
+
+TEST_F(JsonLoggerEngineTests, Object) {
+    engine.logObject(JsonObject().add("event", "result"));
+    engine.logObject(JsonObject().add("id", 1));
+    EXPECT_THAT(sout.str(), Eq("{\"event\":\"result\"}\n{\"id\":1}\n"));
+}
+
+TEST_F(JsonLoggerEngineTests, Heading) {
+    engine.logHeading("HEADING");
+    EXPECT_THAT(sout.str(), Eq("{\"event\":\"message\",\"level\":0,\"text\":\"HEADING\"}\n"));
+}
+
+TEST_F(JsonLoggerEngineTests, Paragraph) {
+    engine.logParagraph(2, "paragraph");
+    EXPECT_THAT(sout.str(), Eq("{\"event\":\"message\",\"level\":2,\"text\":\"paragraph\"}\n"));
+}
+
+TEST_F(JsonLoggerEngineTests, ListItem1) {
+    engine.logListItem1(2, "item");
+    EXPECT_THAT(sout.str(), Eq("{\"event\":\"message\",\"level\":2,\"text\":\"item\"}\n"));
+}
+
+}
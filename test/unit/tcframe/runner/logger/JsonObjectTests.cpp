@@ -0,0 +1,66 @@
+#include "gmock/gmock.h"
+
+#include <limits>
+
+#include "tcframe/runner/logger/JsonObject.hpp"
+
+using ::testing::Eq;
+using ::testing::Test;
+
+using std::numeric_limits;
+
+namespace tcframe {
+
+class JsonObjectTests : public Test {};
+
+TEST_F(JsonObjectTests, Empty) {
+    EXPECT_THAT(JsonObject().toString(), Eq("{}"));
+}
+
+TEST_F(JsonObjectTests, Members) {
+    JsonObject object;
+    object.add("string", "abc")
+            .add("bool", true)
+            .add("int", -42)
+            .add("double", 12.5)
+            .add("array", vector<string>{"x", "y"})
+            .add("empty", vector<string>());
+
+    EXPECT_THAT(object.toString(), Eq(
+            "{\"string\":\"abc\",\"bool\":true,\"int\":-42,\"double\":12.5,"
+            "\"array\":[\"x\",\"y\"],\"empty\":[]}"));
+}
+
+TEST_F(JsonObjectTests, Members_NonFinite) {
+    JsonObject object;
+    object.add("value", numeric_limits<double>::infinity());
+
+    EXPECT_THAT(object.toString(), Eq("{\"value\":null}"));
+}
+
+TEST_F(JsonObjectTests, Members_Escaped) {
+    JsonObject object;
+    object.add("a\"b", "quote \" backslash \\ newline \n tab \t bell \a");
+
+    EXPECT_THAT(object.toString(), Eq(
+            "{\"a\\\"b\":\"quote \\\" backslash \\\\ newline \\n tab \\t bell \\u0007\"}"));
+}
+
+TEST_F(JsonObjectTests, Members_Utf8) {
+    JsonObject object;
+    object.add("value", "caf\xc3\xa9 \xe2\x82\xac \xf0\x9f\x98\x80");
+
+    EXPECT_THAT(object.toString(), Eq("{\"value\":\"caf\xc3\xa9 \xe2\x82\xac \xf0\x9f\x98\x80\"}"));
+}
+
+TEST_F(JsonObjectTests, Members_InvalidUtf8) {
+    JsonObject object;
+    object.add("stderr", "bad \xff byte, truncated \xe2\x82, overlong \xc0\xaf, surrogate \xed\xa0\x80, "
+                         "end \xc3");
+
+    EXPECT_THAT(object.toString(), Eq(
+            "{\"stderr\":\"bad \\ufffd byte, truncated \\ufffd\\ufffd, overlong \\ufffd\\ufffd, "
+            "surrogate \\ufffd\\ufffd\\ufffd, end \\ufffd\"}"));
+}
+
+}
@@ -0,0 +1,14 @@
+#pragma once
+
+#include "gmock/gmock.h"
+
+#include "tcframe/runner/logger/JsonLoggerEngine.hpp"
+
+namespace tcframe {
+
+class MockJsonLoggerEngine : public JsonLoggerEngine {
+public:
+    MOCK_METHOD1(logObject, void(const JsonObject&));
+};
+
+}
@@ -12,8 +12,11 @@ public:
     MOCK_METHOD1(openForWriting, ostream*(const string&));
     MOCK_METHOD1(closeOpenedStream, void(ios*));
     MOCK_METHOD1(forceMakeDir, void(const string&));
+    MOCK_METHOD1(makeDir, void(const string&));
     MOCK_METHOD1(removeFile, void(const string&));
     MOCK_METHOD1(execute, ExecutionResult(const ExecutionRequest&));
+    MOCK_METHOD2(forkProcess, int(const function<bool()>&, const string&));
+    MOCK_METHOD0(waitForAnyProcess, pair<int, bool>());
 };
 
 }
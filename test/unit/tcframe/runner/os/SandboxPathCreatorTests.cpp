@@ -0,0 +1,24 @@
+#include "gmock/gmock.h"
+
+#include "tcframe/runner/os/SandboxPathCreator.hpp"
+
+using ::testing::Eq;
+using ::testing::Test;
+
+namespace tcframe {
+
+class SandboxPathCreatorTests : public Test {};
+
+TEST_F(SandboxPathCreatorTests, SandboxDir) {
+    EXPECT_THAT(SandboxPathCreator::createSandboxDir(3), Eq("__tcframe_worker_3"));
+}
+
+TEST_F(SandboxPathCreatorTests, Path) {
+    EXPECT_THAT(SandboxPathCreator::createPath("dir", "__tcframe_foo.out"), Eq("dir/__tcframe_foo.out"));
+}
+
+TEST_F(SandboxPathCreatorTests, Path_WithoutSandbox) {
+    EXPECT_THAT(SandboxPathCreator::createPath("", "__tcframe_foo.out"), Eq("__tcframe_foo.out"));
+}
+
+}
@@ -10,7 +10,7 @@ class MockTestCaseVerdictParser : public TestCaseVerdictParser {
 public:
     MOCK_METHOD1(parseStream, TestCaseVerdict(istream*));
 
-    MOCK_METHOD1(parseExecutionResult, optional<TestCaseVerdict>(const ExecutionResult&));
+    MOCK_METHOD2(parseExecutionResult, optional<TestCaseVerdict>(const ExecutionResult&, const optional<int>&));
 };
 
 }
@@ -0,0 +1,29 @@
+#include "gmock/gmock.h"
+
+#include "tcframe/runner/verdict/ResourceUsage.hpp"
+
+using ::testing::Eq;
+using ::testing::Test;
+
+namespace tcframe {
+
+class ResourceUsageTests : public Test {};
+
+TEST_F(ResourceUsageTests, Max) {
+    ResourceUsage usage1(100, 250, 2048);
+    ResourceUsage usage2(150, 200, 1024);
+    EXPECT_THAT(ResourceUsage::max(usage1, usage2), Eq(ResourceUsage(150, 250, 2048)));
+}
+
+TEST_F(ResourceUsageTests, Max_Optional) {
+    optional<ResourceUsage> usage(ResourceUsage(100, 250, 2048));
+    EXPECT_THAT(ResourceUsage::max(usage, optional<ResourceUsage>()), Eq(usage));
+    EXPECT_THAT(ResourceUsage::max(optional<ResourceUsage>(), usage), Eq(usage));
+    EXPECT_FALSE(ResourceUsage::max(optional<ResourceUsage>(), optional<ResourceUsage>()));
+}
+
+TEST_F(ResourceUsageTests, ToString) {
+    EXPECT_THAT(ResourceUsage(100, 250, 2048).toString(), Eq("100 ms CPU, 250 ms wall, 2048 KB"));
+}
+
+}
@@ -70,7 +70,7 @@ TEST_F(TestCaseVerdictParserTests, ParseStream_UnknownVerdict) {
 }
 
 TEST_F(TestCaseVerdictParserTests, ParseExecutionResult_Nothing) {
-    EXPECT_FALSE(parser.parseExecutionResult(ExecutionResult()));
+    EXPECT_FALSE(parser.parseExecutionResult(ExecutionResult(), optional<int>()));
 }
 
 TEST_F(TestCaseVerdictParserTests, ParseExecutionResult_TLE) {
@@ -78,14 +78,75 @@ TEST_F(TestCaseVerdictParserTests, ParseExecutionResult_TLE) {
             .setExitSignal(SIGXCPU)
             .build();
     EXPECT_THAT(
-            parser.parseExecutionResult(executionResult),
+            parser.parseExecutionResult(executionResult, optional<int>(1000)),
             Eq(optional<TestCaseVerdict>(TestCaseVerdict(Verdict::tle()))));
 }
 
+TEST_F(TestCaseVerdictParserTests, ParseExecutionResult_TLE_CpuTime) {
+    auto executionResult = ExecutionResultBuilder()
+            .setExitCode(0)
+            .setCpuTimeMs(1001)
+            .build();
+    EXPECT_THAT(
+            parser.parseExecutionResult(executionResult, optional<int>(1000)),
+            Eq(optional<TestCaseVerdict>(TestCaseVerdict(Verdict::tle()))));
+    EXPECT_FALSE(parser.parseExecutionResult(executionResult, optional<int>()));
+}
+
+TEST_F(TestCaseVerdictParserTests, ParseExecutionResult_TLE_WallTime) {
+    auto executionResult = ExecutionResultBuilder()
+            .setExitSignal(SIGKILL)
+            .setCpuTimeMs(10)
+            .setWallTimeMs(3000)
+            .build();
+    EXPECT_THAT(
+            parser.parseExecutionResult(executionResult, optional<int>(1000)),
+            Eq(optional<TestCaseVerdict>(TestCaseVerdict(Verdict::tle()))));
+}
+
+TEST_F(TestCaseVerdictParserTests, ParseExecutionResult_WithinTimeLimit) {
+    auto executionResult = ExecutionResultBuilder()
+            .setExitCode(0)
+            .setCpuTimeMs(1000)
+            .setWallTimeMs(1500)
+            .build();
+    EXPECT_FALSE(parser.parseExecutionResult(executionResult, optional<int>(1000)));
+}
+
+TEST_F(TestCaseVerdictParserTests, ParseExecutionResult_MLE) {
+    auto executionResult = ExecutionResultBuilder()
+            .setExitSignal(SIGKILL)
+            .setWallTimeMs(3000)
+            .setPeakMemoryKb(65 * 1024)
+            .setMemoryLimitExceeded(true)
+            .build();
+    EXPECT_THAT(
+            parser.parseExecutionResult(executionResult, optional<int>(1000)),
+            Eq(optional<TestCaseVerdict>(TestCaseVerdict(Verdict::mle()))));
+}
+
+TEST_F(TestCaseVerdictParserTests, ParseExecutionResult_AddressSpaceLimit) {
+    auto executionResult = ExecutionResultBuilder()
+            .setExitSignal(SIGSEGV)
+            .setPeakMemoryKb(65 * 1024)
+            .build();
+    EXPECT_THAT(
+            parser.parseExecutionResult(executionResult, optional<int>()),
+            Eq(optional<TestCaseVerdict>(TestCaseVerdict(Verdict::rte()))));
+}
+
+TEST_F(TestCaseVerdictParserTests, ParseExecutionResult_PeakMemory) {
+    auto executionResult = ExecutionResultBuilder()
+            .setExitCode(0)
+            .setPeakMemoryKb(65 * 1024)
+            .build();
+    EXPECT_FALSE(parser.parseExecutionResult(executionResult, optional<int>()));
+}
+
 TEST_F(TestCaseVerdictParserTests, ParseExecutionResult_RTE) {
     auto executionResult = ExecutionResultBuilder().setExitCode(1).build();
     EXPECT_THAT(
-            parser.parseExecutionResult(executionResult),
+            parser.parseExecutionResult(executionResult, optional<int>(1000)),
             Eq(optional<TestCaseVerdict>(TestCaseVerdict(Verdict::rte()))));
 }
 
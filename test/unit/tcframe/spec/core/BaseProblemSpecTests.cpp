@@ -81,6 +81,28 @@ protected:
         }
     };
 
+    class ProblemSpecWithTokenScorer : public ProblemSpec {
+    protected:
+        void StyleConfig() {
+            TokenScorer();
+        }
+    };
+
+    class ProblemSpecWithRealScorer : public ProblemSpec {
+    protected:
+        void StyleConfig() {
+            RealScorer(1e-6);
+        }
+    };
+
+    class ProblemSpecWithInvalidStyleConfig : public ProblemSpec {
+    protected:
+        void StyleConfig() {
+            CustomScorer();
+            TokenScorer();
+        }
+    };
+
     class ProblemSpecWithMultipleTestCasesConfig : public ProblemSpec {
     protected:
         void MultipleTestCasesConfig() {
@@ -97,6 +119,13 @@ protected:
         }
     };
 
+    class ProblemSpecWithGradingConfigInMilliseconds : public ProblemSpec {
+    protected:
+        void GradingConfig() {
+            TimeLimitMs(1500);
+        }
+    };
+
     class ProblemSpecWithMultipleTestCasesConstraints : public ProblemSpec {
     protected:
         int T;
@@ -139,6 +168,28 @@ TEST_F(BaseProblemSpecTests, StyleConfig) {
     EXPECT_FALSE(config.hasTcOutput());
 }
 
+TEST_F(BaseProblemSpecTests, StyleConfig_TokenScorer) {
+    StyleConfig config = ProblemSpecWithTokenScorer().buildStyleConfig();
+    EXPECT_FALSE(config.hasScorer());
+    EXPECT_THAT(config.scoringStyle(), Eq(ScoringStyle::TOKEN));
+}
+
+TEST_F(BaseProblemSpecTests, StyleConfig_RealScorer) {
+    StyleConfig config = ProblemSpecWithRealScorer().buildStyleConfig();
+    EXPECT_THAT(config.scoringStyle(), Eq(ScoringStyle::REAL));
+    EXPECT_THAT(config.scoringEpsilon(), Eq(1e-6));
+}
+
+TEST_F(BaseProblemSpecTests, StyleConfig_Invalid) {
+    try {
+        ProblemSpecWithInvalidStyleConfig().buildStyleConfig();
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(),
+                StrEq("If CustomScorer() is specified, TokenScorer() and RealScorer() cannot be specified"));
+    }
+}
+
 TEST_F(BaseProblemSpecTests, MultipleTestCasesConfig) {
     MultipleTestCasesConfig config = ProblemSpecWithMultipleTestCasesConfig().buildMultipleTestCasesConfig();
     EXPECT_TRUE(config.counter());
@@ -147,10 +198,15 @@ TEST_F(BaseProblemSpecTests, MultipleTestCasesConfig) {
 
 TEST_F(BaseProblemSpecTests, GradingConfig) {
     GradingConfig config = ProblemSpecWithGradingConfig().buildGradingConfig();
-    EXPECT_THAT(config.timeLimit(), Eq(3));
+    EXPECT_THAT(config.timeLimitMs(), Eq(3000));
     EXPECT_THAT(config.memoryLimit(), Eq(128));
 }
 
+TEST_F(BaseProblemSpecTests, GradingConfig_TimeLimitMs) {
+    GradingConfig config = ProblemSpecWithGradingConfigInMilliseconds().buildGradingConfig();
+    EXPECT_THAT(config.timeLimitMs(), Eq(1500));
+}
+
 TEST_F(BaseProblemSpecTests, IOFormat) {
     ProblemSpecWithOutputFormat problemSpec;
     problemSpec.Z = 0;
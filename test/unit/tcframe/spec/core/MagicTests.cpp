@@ -68,6 +68,7 @@ protected:
         vector<int> X, Y;
         vector<vector<int>> Z;
         vector<int> A, B;
+        FlatMatrix<int> F;
 
         int bogus;
 
@@ -76,6 +77,7 @@ protected:
             LINES(X) % SIZE(2);
             LINES(X, Y) % SIZE(3);
             LINES(X, Y, Z) % SIZE(N);
+            LINES(X, F) % SIZE(N);
             LINES(A, B);
         }
 
@@ -132,6 +134,7 @@ protected:
         int R = 2;
         int C = 3;
         vector<vector<int>> M1, M2, M3, M4;
+        FlatMatrix<char> M5;
 
         int bogus;
 
@@ -141,6 +144,7 @@ protected:
             GRID(M2) % SIZE(R, 3);
             GRID(M3) % SIZE(2, C);
             GRID(M4) % SIZE(R, C);
+            GRID(M5) % SIZE(R, C);
         }
 
         void testInvalid() {
@@ -267,6 +271,10 @@ TEST_F(MagicTests, LINES_Valid) {
             .addVectorVariable(Vector::create(dummy, "Y"))
             .addJaggedVectorVariable(Matrix::create(dummy2, "Z"))
             .setSize([] {return 4;});
+    builder.newLinesIOSegment()
+            .addVectorVariable(Vector::create(dummy, "X"))
+            .addJaggedVectorVariable(Matrix::create(dummy2, "F"))
+            .setSize([] {return 4;});
     builder.newLinesIOSegment()
             .addVectorVariable(Vector::create(dummy, "A"))
             .addVectorVariable(Vector::create(dummy, "B"))
@@ -397,6 +405,9 @@ TEST_F(MagicTests, GRID_Valid) {
     builder.newGridIOSegment()
             .addMatrixVariable(Matrix::create(dummy, "M4"))
             .setSize([] {return 2;}, [] {return 3;});
+    builder.newGridIOSegment()
+            .addMatrixVariable(Matrix::create(dummy, "M5"))
+            .setSize([] {return 2;}, [] {return 3;});
 
     EXPECT_THAT(ioFormat, Eq(builder.build()));
 }
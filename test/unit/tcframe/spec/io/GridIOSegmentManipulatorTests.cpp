@@ -1,16 +1,11 @@
 #include "gmock/gmock.h"
 
-#include <sstream>
-
 #include "tcframe/spec/io/GridIOSegmentManipulator.hpp"
 
 using ::testing::Eq;
 using ::testing::StrEq;
 using ::testing::Test;
 
-using std::istringstream;
-using std::ostringstream;
-
 namespace tcframe {
 
 class GridIOSegmentManipulatorTests : public Test {
@@ -28,20 +23,20 @@ protected:
 };
 
 TEST_F(GridIOSegmentManipulatorTests, Parsing_Successful) {
-    istringstream in("1 2 3\n4 5 6\n");
+    InputReader in("1 2 3\n4 5 6\n");
 
     manipulator.parse(segment, &in);
     EXPECT_THAT(M, Eq(vector<vector<int>>{{1, 2, 3}, {4, 5, 6}}));
 }
 
 TEST_F(GridIOSegmentManipulatorTests, Parsing_Successful_CheckLastVariable) {
-    istringstream in("1 2 3\n4 5 6\n");
+    InputReader in("1 2 3\n4 5 6\n");
 
     EXPECT_THAT(manipulator.parse(segment, &in), Eq("'M[1][2]'"));
 }
 
 TEST_F(GridIOSegmentManipulatorTests, Printing_Successful) {
-    ostringstream out;
+    OutputWriter out;
 
     M = {{1, 2, 3}, {4, 5, 6}};
 
@@ -50,7 +45,7 @@ TEST_F(GridIOSegmentManipulatorTests, Printing_Successful) {
 }
 
 TEST_F(GridIOSegmentManipulatorTests, Printing_Failed_RowsMismatch) {
-    ostringstream out;
+    OutputWriter out;
 
     M = {{1, 2, 3}};
 
@@ -63,7 +58,7 @@ TEST_F(GridIOSegmentManipulatorTests, Printing_Failed_RowsMismatch) {
 }
 
 TEST_F(GridIOSegmentManipulatorTests, Printing_Failed_ColumnsMismatch) {
-    ostringstream out;
+    OutputWriter out;
 
     M = {{1, 2, 3}, {4, 5}};
 
@@ -76,11 +71,11 @@ TEST_F(GridIOSegmentManipulatorTests, Printing_Failed_ColumnsMismatch) {
 }
 
 TEST_F(GridIOSegmentManipulatorTests, Parsing_ClearSegment_Successful) {
-    istringstream in("1 2 3\n4 5 6\n");
+    InputReader in("1 2 3\n4 5 6\n");
 
     manipulator.parse(segment, &in);
 
-    in.seekg(0, in.beg);
+    in.seek(0);
     manipulator.parse(segment, &in);
     EXPECT_THAT(M, Eq(vector<vector<int>>{{1, 2, 3}, {4, 5, 6}}));
 }
@@ -190,6 +190,46 @@ TEST_F(IOManipulatorTests, Parsing_Output_Multiple_Failed) {
     }
 }
 
+TEST_F(IOManipulatorTests, Parsing_Outputs) {
+    istringstream in("Case 1:\n1\n2\n3\nCase 2:\n4\n5\n6\n");
+    N = 0;
+    manipulatorWithOutputFormat->parseOutputs(&in, {"Case 1:\n", "Case 2:\n"});
+    EXPECT_THAT(U, Eq((vector<int>{4, 5, 6})));
+}
+
+TEST_F(IOManipulatorTests, Parsing_Outputs_Failed) {
+    istringstream in("1\n2\n3\n4\n5\n");
+    N = 0;
+    try {
+        manipulatorWithOutputFormat->parseOutputs(&in, {"", ""});
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("Test case #2: Cannot parse for 'U[2]'. Found: <EOF>"));
+    }
+}
+
+TEST_F(IOManipulatorTests, Parsing_Outputs_Failed_Prefix) {
+    istringstream in("Case 1:\n1\n2\n3\n4\n5\n6\n");
+    N = 0;
+    try {
+        manipulatorWithOutputFormat->parseOutputs(&in, {"Case 1:\n", "Case 2:\n"});
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("Test case #2: Output must start with \"Case 2:\n\""));
+    }
+}
+
+TEST_F(IOManipulatorTests, Parsing_Outputs_Failed_MissingEof) {
+    istringstream in("1\n2\n3\n4\n");
+    N = 0;
+    try {
+        manipulatorWithOutputFormat->parseOutputs(&in, {""});
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("Expected: <EOF> after 'U[2]'"));
+    }
+}
+
 TEST_F(IOManipulatorTests, Printing_Successful) {
     A = 123;
     S = "hello, world!";
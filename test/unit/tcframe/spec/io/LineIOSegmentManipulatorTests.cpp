@@ -1,16 +1,11 @@
 #include "gmock/gmock.h"
 
-#include <sstream>
-
 #include "tcframe/spec/io/LineIOSegmentManipulator.hpp"
 
 using ::testing::Eq;
 using ::testing::StrEq;
 using ::testing::Test;
 
-using std::istringstream;
-using std::ostringstream;
-
 namespace tcframe {
 
 class LineIOSegmentManipulatorTests : public Test {
@@ -55,13 +50,13 @@ protected:
 };
 
 TEST_F(LineIOSegmentManipulatorTests, Parsing_EmptyLine) {
-    istringstream in("\n");
+    InputReader in("\n");
 
     manipulator.parse(LineIOSegmentBuilder().build(), &in);
 }
 
 TEST_F(LineIOSegmentManipulatorTests, Parsing_Successful) {
-    istringstream in("42 123\n");
+    InputReader in("42 123\n");
 
     manipulator.parse(segment, &in);
     EXPECT_THAT(A, Eq(42));
@@ -69,13 +64,13 @@ TEST_F(LineIOSegmentManipulatorTests, Parsing_Successful) {
 }
 
 TEST_F(LineIOSegmentManipulatorTests, Parsing_Successful_CheckLastVariable) {
-    istringstream in("42 123\n");
+    InputReader in("42 123\n");
 
     EXPECT_THAT(manipulator.parse(segment, &in), Eq("'B'"));
 }
 
 TEST_F(LineIOSegmentManipulatorTests, Parsing_WithVector_Successful) {
-    istringstream in("42 123 1 2\n");
+    InputReader in("42 123 1 2\n");
 
     manipulator.parse(segmentWithVector, &in);
     EXPECT_THAT(A, Eq(42));
@@ -84,7 +79,7 @@ TEST_F(LineIOSegmentManipulatorTests, Parsing_WithVector_Successful) {
 }
 
 TEST_F(LineIOSegmentManipulatorTests, Parsing_WithVector_Empty_Successful) {
-    istringstream in("42 123\n");
+    InputReader in("42 123\n");
 
     manipulator.parse(segmentWithEmptyVector, &in);
     EXPECT_THAT(A, Eq(42));
@@ -93,27 +88,27 @@ TEST_F(LineIOSegmentManipulatorTests, Parsing_WithVector_Empty_Successful) {
 }
 
 TEST_F(LineIOSegmentManipulatorTests, Parsing_WithVector_Only_Successful) {
-    istringstream in("1 2\n");
+    InputReader in("1 2\n");
 
     manipulator.parse(segmentWithVectorOnly, &in);
     EXPECT_THAT(C, Eq(vector<int>{1, 2}));
 }
 
 TEST_F(LineIOSegmentManipulatorTests, Parsing_WithVector_Only_Empty_Successful) {
-    istringstream in("\n");
+    InputReader in("\n");
 
     manipulator.parse(segmentWithEmptyVectorOnly, &in);
     EXPECT_THAT(C, Eq(vector<int>{}));
 }
 
 TEST_F(LineIOSegmentManipulatorTests, Parsing_WithVector_Successful_CheckLastVariable) {
-    istringstream in("42 123 1 2\n");
+    InputReader in("42 123 1 2\n");
 
     EXPECT_THAT(manipulator.parse(segmentWithVector, &in), Eq("'C[1]'"));
 }
 
 TEST_F(LineIOSegmentManipulatorTests, Parsing_WithVector_Failed_MissingVariable) {
-    istringstream in("42  ");
+    InputReader in("42  ");
 
     try {
         manipulator.parse(segmentWithVector, &in);
@@ -124,7 +119,7 @@ TEST_F(LineIOSegmentManipulatorTests, Parsing_WithVector_Failed_MissingVariable)
 }
 
 TEST_F(LineIOSegmentManipulatorTests, Parsing_WithVector_Failed_MissingWhitespace) {
-    istringstream in("42 123\n");
+    InputReader in("42 123\n");
 
     try {
         manipulator.parse(segmentWithVector, &in);
@@ -135,7 +130,7 @@ TEST_F(LineIOSegmentManipulatorTests, Parsing_WithVector_Failed_MissingWhitespac
 }
 
 TEST_F(LineIOSegmentManipulatorTests, Parsing_WithVector_Failed_MissingNewline) {
-    istringstream in("42 123 1 2");
+    InputReader in("42 123 1 2");
 
     try {
         manipulator.parse(segmentWithVector, &in);
@@ -146,7 +141,7 @@ TEST_F(LineIOSegmentManipulatorTests, Parsing_WithVector_Failed_MissingNewline)
 }
 
 TEST_F(LineIOSegmentManipulatorTests, Parsing_WithVector_Failed_TooManyElements) {
-    istringstream in("42 123 1 2 3 4 5\n");
+    InputReader in("42 123 1 2 3 4 5\n");
 
     try {
         manipulator.parse(segmentWithVector, &in);
@@ -157,7 +152,7 @@ TEST_F(LineIOSegmentManipulatorTests, Parsing_WithVector_Failed_TooManyElements)
 }
 
 TEST_F(LineIOSegmentManipulatorTests, Parsing_WithVectorWithoutSize_Successful) {
-    istringstream in("42 123 1 2 3 4 5\n");
+    InputReader in("42 123 1 2 3 4 5\n");
 
     manipulator.parse(segmentWithVectorWithoutSize, &in);
     EXPECT_THAT(A, Eq(42));
@@ -167,7 +162,7 @@ TEST_F(LineIOSegmentManipulatorTests, Parsing_WithVectorWithoutSize_Successful)
 }
 
 TEST_F(LineIOSegmentManipulatorTests, Parsing_WithVectorWithoutSize_Empty_Successful) {
-    istringstream in("42 123 1 2\n");
+    InputReader in("42 123 1 2\n");
 
     manipulator.parse(segmentWithVectorWithoutSize, &in);
     EXPECT_THAT(A, Eq(42));
@@ -177,27 +172,27 @@ TEST_F(LineIOSegmentManipulatorTests, Parsing_WithVectorWithoutSize_Empty_Succes
 }
 
 TEST_F(LineIOSegmentManipulatorTests, Parsing_WithVectorWithoutSize_Only_Successful) {
-    istringstream in("3 4 5\n");
+    InputReader in("3 4 5\n");
 
     manipulator.parse(segmentWithVectorWithoutSizeOnly, &in);
     EXPECT_THAT(D, Eq(vector<int>{3, 4, 5}));
 }
 
 TEST_F(LineIOSegmentManipulatorTests, Parsing_WithVectorWithoutSize_Only_Empty_Successful) {
-    istringstream in("\n");
+    InputReader in("\n");
 
     manipulator.parse(segmentWithVectorWithoutSizeOnly, &in);
     EXPECT_THAT(D, Eq(vector<int>{}));
 }
 
 TEST_F(LineIOSegmentManipulatorTests, Parsing_WithVectorWithoutSize_Successful_CheckLastVariable) {
-    istringstream in("42 123 1 2 3 4 5\n");
+    InputReader in("42 123 1 2 3 4 5\n");
 
     EXPECT_THAT(manipulator.parse(segmentWithVectorWithoutSize, &in), Eq("'D[2]'"));
 }
 
 TEST_F(LineIOSegmentManipulatorTests, Parsing_WithVectorWithoutSize_Failed_MissingSpaceOrNewline) {
-    istringstream in("42 123 1 2 3 4 5");
+    InputReader in("42 123 1 2 3 4 5");
 
     try {
         manipulator.parse(segmentWithVectorWithoutSize, &in);
@@ -208,14 +203,14 @@ TEST_F(LineIOSegmentManipulatorTests, Parsing_WithVectorWithoutSize_Failed_Missi
 }
 
 TEST_F(LineIOSegmentManipulatorTests, Printing_EmptyLine) {
-    ostringstream out;
+    OutputWriter out;
 
     manipulator.print(LineIOSegmentBuilder().build(), &out);
     EXPECT_THAT(out.str(), Eq("\n"));
 }
 
 TEST_F(LineIOSegmentManipulatorTests, Printing_WithVector_Successful) {
-    ostringstream out;
+    OutputWriter out;
 
     A = 42;
     B = 123;
@@ -226,7 +221,7 @@ TEST_F(LineIOSegmentManipulatorTests, Printing_WithVector_Successful) {
 }
 
 TEST_F(LineIOSegmentManipulatorTests, Printing_WithVector_Empty_Successful) {
-    ostringstream out;
+    OutputWriter out;
 
     A = 42;
     B = 123;
@@ -237,7 +232,7 @@ TEST_F(LineIOSegmentManipulatorTests, Printing_WithVector_Empty_Successful) {
 }
 
 TEST_F(LineIOSegmentManipulatorTests, Printing_WithVector_Only_Successful) {
-    ostringstream out;
+    OutputWriter out;
 
     C = {1, 2};
 
@@ -246,7 +241,7 @@ TEST_F(LineIOSegmentManipulatorTests, Printing_WithVector_Only_Successful) {
 }
 
 TEST_F(LineIOSegmentManipulatorTests, Printing_WithVector_Only_Empty_Successful) {
-    ostringstream out;
+    OutputWriter out;
 
     C = {};
 
@@ -255,7 +250,7 @@ TEST_F(LineIOSegmentManipulatorTests, Printing_WithVector_Only_Empty_Successful)
 }
 
 TEST_F(LineIOSegmentManipulatorTests, Printing_WithVector_Failed_SizeMismatch) {
-    ostringstream out;
+    OutputWriter out;
 
     C = {1, 2, 3};
 
@@ -268,7 +263,7 @@ TEST_F(LineIOSegmentManipulatorTests, Printing_WithVector_Failed_SizeMismatch) {
 }
 
 TEST_F(LineIOSegmentManipulatorTests, Printing_WithVectorWithoutSize_Successful) {
-    ostringstream out;
+    OutputWriter out;
 
     A = 42;
     B = 123;
@@ -280,7 +275,7 @@ TEST_F(LineIOSegmentManipulatorTests, Printing_WithVectorWithoutSize_Successful)
 }
 
 TEST_F(LineIOSegmentManipulatorTests, Printing_WithVectorWithoutSize_Empty_Successful) {
-    ostringstream out;
+    OutputWriter out;
 
     A = 42;
     B = 123;
@@ -292,7 +287,7 @@ TEST_F(LineIOSegmentManipulatorTests, Printing_WithVectorWithoutSize_Empty_Succe
 }
 
 TEST_F(LineIOSegmentManipulatorTests, Printing_WithVectorWithoutSize_Only_Successful) {
-    ostringstream out;
+    OutputWriter out;
 
     D = {3, 4, 5};
 
@@ -301,7 +296,7 @@ TEST_F(LineIOSegmentManipulatorTests, Printing_WithVectorWithoutSize_Only_Succes
 }
 
 TEST_F(LineIOSegmentManipulatorTests, Printing_WithVectorWithoutSize_Only_Empty_Successful) {
-    ostringstream out;
+    OutputWriter out;
 
     D = {};
 
@@ -310,11 +305,11 @@ TEST_F(LineIOSegmentManipulatorTests, Printing_WithVectorWithoutSize_Only_Empty_
 }
 
 TEST_F(LineIOSegmentManipulatorTests, Parsing_ClearVectorSegment_Successful) {
-    istringstream in("42 123 1 2\n");
+    InputReader in("42 123 1 2\n");
 
     manipulator.parse(segmentWithVector, &in);
 
-    in.seekg(0, in.beg);
+    in.seek(0);
     manipulator.parse(segmentWithVector, &in);
     EXPECT_THAT(A, Eq(42));
     EXPECT_THAT(B, Eq(123));
@@ -1,16 +1,11 @@
 #include "gmock/gmock.h"
 
-#include <sstream>
-
 #include "tcframe/spec/io/LinesIOSegmentManipulator.hpp"
 
 using ::testing::Eq;
 using ::testing::StrEq;
 using ::testing::Test;
 
-using std::istringstream;
-using std::ostringstream;
-
 namespace tcframe {
 
 class LinesIOSegmentManipulatorTests : public Test {
@@ -51,7 +46,7 @@ protected:
 };
 
 TEST_F(LinesIOSegmentManipulatorTests, Parsing_Successful) {
-    istringstream in("1 2\n3 4\n5 6\n");
+    InputReader in("1 2\n3 4\n5 6\n");
 
     manipulator.parse(segment, &in);
     EXPECT_THAT(X, Eq(vector<int>{1, 3, 5}));
@@ -59,13 +54,13 @@ TEST_F(LinesIOSegmentManipulatorTests, Parsing_Successful) {
 }
 
 TEST_F(LinesIOSegmentManipulatorTests, Parsing_Successful_CheckLastVariable) {
-    istringstream in("1 2\n3 4\n5 6\n");
+    InputReader in("1 2\n3 4\n5 6\n");
 
     EXPECT_THAT(manipulator.parse(segment, &in), Eq("'Y[2]'"));
 }
 
 TEST_F(LinesIOSegmentManipulatorTests, Parsing_Failed_MissingVariable) {
-    istringstream in("1 2\n3  ");
+    InputReader in("1 2\n3  ");
 
     try {
         manipulator.parse(segment, &in);
@@ -76,7 +71,7 @@ TEST_F(LinesIOSegmentManipulatorTests, Parsing_Failed_MissingVariable) {
 }
 
 TEST_F(LinesIOSegmentManipulatorTests, Parsing_Failed_MissingWhitespace) {
-    istringstream in("1 2\n3");
+    InputReader in("1 2\n3");
 
     try {
         manipulator.parse(segment, &in);
@@ -87,7 +82,7 @@ TEST_F(LinesIOSegmentManipulatorTests, Parsing_Failed_MissingWhitespace) {
 }
 
 TEST_F(LinesIOSegmentManipulatorTests, Parsing_Failed_MissingNewline) {
-    istringstream in("1 2\n3 4 ");
+    InputReader in("1 2\n3 4 ");
 
     try {
         manipulator.parse(segment, &in);
@@ -98,7 +93,7 @@ TEST_F(LinesIOSegmentManipulatorTests, Parsing_Failed_MissingNewline) {
 }
 
 TEST_F(LinesIOSegmentManipulatorTests, Parsing_WithJaggedVector_Successful) {
-    istringstream in("1 2 10\n3 4\n5 6 20 30\n");
+    InputReader in("1 2 10\n3 4\n5 6 20 30\n");
 
     manipulator.parse(segmentWithJaggedVector, &in);
     EXPECT_THAT(X, Eq(vector<int>{1, 3, 5}));
@@ -107,20 +102,20 @@ TEST_F(LinesIOSegmentManipulatorTests, Parsing_WithJaggedVector_Successful) {
 }
 
 TEST_F(LinesIOSegmentManipulatorTests, Parsing_WithJaggedVector_Only_Successful) {
-    istringstream in("10\n\n20 30\n");
+    InputReader in("10\n\n20 30\n");
 
     manipulator.parse(segmentWithJaggedVectorOnly, &in);
     EXPECT_THAT(Z, Eq(vector<vector<int>>{{10}, {}, {20, 30}}));
 }
 
 TEST_F(LinesIOSegmentManipulatorTests, Parsing_WithJaggedVector_Successful_CheckLastVariable) {
-    istringstream in("1 2 10\n3 4\n5 6 20 30\n");
+    InputReader in("1 2 10\n3 4\n5 6 20 30\n");
 
     EXPECT_THAT(manipulator.parse(segmentWithJaggedVector, &in), Eq("'Z[2][1]'"));
 }
 
 TEST_F(LinesIOSegmentManipulatorTests, Parsing_WithJaggedVector_Failed_MissingSpaceOrNewline) {
-    istringstream in("1 2 10\n3 4\n5 6 20 30");
+    InputReader in("1 2 10\n3 4\n5 6 20 30");
 
     try {
         manipulator.parse(segmentWithJaggedVector, &in);
@@ -131,7 +126,7 @@ TEST_F(LinesIOSegmentManipulatorTests, Parsing_WithJaggedVector_Failed_MissingSp
 }
 
 TEST_F(LinesIOSegmentManipulatorTests, Parsing_WithoutSize_Successful) {
-    istringstream in("1 2\n3 4\n5 6\n");
+    InputReader in("1 2\n3 4\n5 6\n");
 
     manipulator.parse(segmentWithoutSize, &in);
     EXPECT_THAT(X, Eq(vector<int>{1, 3, 5}));
@@ -139,13 +134,13 @@ TEST_F(LinesIOSegmentManipulatorTests, Parsing_WithoutSize_Successful) {
 }
 
 TEST_F(LinesIOSegmentManipulatorTests, Parsing_WithoutSize_Successful_CheckLastVariable) {
-    istringstream in("1 2\n3 4\n5 6\n");
+    InputReader in("1 2\n3 4\n5 6\n");
 
     EXPECT_THAT(manipulator.parse(segmentWithoutSize, &in), Eq("'Y[2]'"));
 }
 
 TEST_F(LinesIOSegmentManipulatorTests, Parsing_WithoutSize_Failed_MissingVariable) {
-    istringstream in("1 2\n3  ");
+    InputReader in("1 2\n3  ");
 
     try {
         manipulator.parse(segmentWithoutSize, &in);
@@ -156,7 +151,7 @@ TEST_F(LinesIOSegmentManipulatorTests, Parsing_WithoutSize_Failed_MissingVariabl
 }
 
 TEST_F(LinesIOSegmentManipulatorTests, Parsing_WithoutSize__Failed_MissingWhitespace) {
-    istringstream in("1 2\n3");
+    InputReader in("1 2\n3");
 
     try {
         manipulator.parse(segmentWithoutSize, &in);
@@ -167,7 +162,7 @@ TEST_F(LinesIOSegmentManipulatorTests, Parsing_WithoutSize__Failed_MissingWhites
 }
 
 TEST_F(LinesIOSegmentManipulatorTests, Parsing_WithoutSize_Failed_MissingNewline) {
-    istringstream in("1 2\n3 4 ");
+    InputReader in("1 2\n3 4 ");
 
     try {
         manipulator.parse(segmentWithoutSize, &in);
@@ -178,7 +173,7 @@ TEST_F(LinesIOSegmentManipulatorTests, Parsing_WithoutSize_Failed_MissingNewline
 }
 
 TEST_F(LinesIOSegmentManipulatorTests, Parsing_WithJaggedVector_WithoutSize_Successful) {
-    istringstream in("1 2 10\n3 4\n5 6 20 30\n");
+    InputReader in("1 2 10\n3 4\n5 6 20 30\n");
 
     manipulator.parse(segmentWithJaggedVectorWithoutSize, &in);
     EXPECT_THAT(X, Eq(vector<int>{1, 3, 5}));
@@ -187,20 +182,20 @@ TEST_F(LinesIOSegmentManipulatorTests, Parsing_WithJaggedVector_WithoutSize_Succ
 }
 
 TEST_F(LinesIOSegmentManipulatorTests, Parsing_WithJaggedVector_WithoutSize_Only_Successful) {
-    istringstream in("10\n\n20 30\n");
+    InputReader in("10\n\n20 30\n");
 
     manipulator.parse(segmentWithJaggedVectorWithoutSizeOnly, &in);
     EXPECT_THAT(Z, Eq(vector<vector<int>>{{10}, {}, {20, 30}}));
 }
 
 TEST_F(LinesIOSegmentManipulatorTests, Parsing_WithJaggedVector_WithoutSize_Successful_CheckLastVariable) {
-    istringstream in("1 2 10\n3 4\n5 6 20 30\n");
+    InputReader in("1 2 10\n3 4\n5 6 20 30\n");
 
     EXPECT_THAT(manipulator.parse(segmentWithJaggedVectorWithoutSize, &in), Eq("'Z[2][1]'"));
 }
 
 TEST_F(LinesIOSegmentManipulatorTests, Parsing_WithJaggedVector_WithoutSize_Failed_MissingSpaceOrNewline) {
-    istringstream in("1 2 10\n3 4\n5 6 20 30");
+    InputReader in("1 2 10\n3 4\n5 6 20 30");
 
     try {
         manipulator.parse(segmentWithJaggedVectorWithoutSize, &in);
@@ -211,7 +206,7 @@ TEST_F(LinesIOSegmentManipulatorTests, Parsing_WithJaggedVector_WithoutSize_Fail
 }
 
 TEST_F(LinesIOSegmentManipulatorTests, Printing_Successful) {
-    ostringstream out;
+    OutputWriter out;
 
     X = {1, 3, 5};
     Y = {2, 4, 6};
@@ -221,7 +216,7 @@ TEST_F(LinesIOSegmentManipulatorTests, Printing_Successful) {
 }
 
 TEST_F(LinesIOSegmentManipulatorTests, Printing_Failed_SizeMismatch) {
-    ostringstream out;
+    OutputWriter out;
 
     X = {1, 3, 5};
     Y = {2, 4};
@@ -235,7 +230,7 @@ TEST_F(LinesIOSegmentManipulatorTests, Printing_Failed_SizeMismatch) {
 }
 
 TEST_F(LinesIOSegmentManipulatorTests, Printing_WithJaggedVector_Successful) {
-    ostringstream out;
+    OutputWriter out;
 
     X = {1, 3, 5};
     Y = {2, 4, 6};
@@ -246,7 +241,7 @@ TEST_F(LinesIOSegmentManipulatorTests, Printing_WithJaggedVector_Successful) {
 }
 
 TEST_F(LinesIOSegmentManipulatorTests, Printing_WithJaggedVector_Only_Successful) {
-    ostringstream out;
+    OutputWriter out;
 
     Z = {{10}, {}, {20, 30}};
 
@@ -255,7 +250,7 @@ TEST_F(LinesIOSegmentManipulatorTests, Printing_WithJaggedVector_Only_Successful
 }
 
 TEST_F(LinesIOSegmentManipulatorTests, Printing_WithJaggedVector_Failed_SizeMismatch) {
-    ostringstream out;
+    OutputWriter out;
 
     X = {1, 3, 5};
     Y = {2, 4, 6};
@@ -270,7 +265,7 @@ TEST_F(LinesIOSegmentManipulatorTests, Printing_WithJaggedVector_Failed_SizeMism
 }
 
 TEST_F(LinesIOSegmentManipulatorTests, Printing_WithoutSize_Successful) {
-    ostringstream out;
+    OutputWriter out;
 
     X = {1, 3, 5};
     Y = {2, 4, 6};
@@ -280,7 +275,7 @@ TEST_F(LinesIOSegmentManipulatorTests, Printing_WithoutSize_Successful) {
 }
 
 TEST_F(LinesIOSegmentManipulatorTests, Printing_WithoutSize_Failed_DifferentSizes) {
-    ostringstream out;
+    OutputWriter out;
 
     X = {1, 3, 5};
     Y = {2, 4};
@@ -297,7 +292,7 @@ TEST_F(LinesIOSegmentManipulatorTests, Printing_WithoutSize_Failed_DifferentSize
 }
 
 TEST_F(LinesIOSegmentManipulatorTests, Printing_WithJaggedVector_WithoutSize_Successful) {
-    ostringstream out;
+    OutputWriter out;
 
     X = {1, 3, 5};
     Y = {2, 4, 6};
@@ -308,7 +303,7 @@ TEST_F(LinesIOSegmentManipulatorTests, Printing_WithJaggedVector_WithoutSize_Suc
 }
 
 TEST_F(LinesIOSegmentManipulatorTests, Printing_WithJaggedVector_WithoutSize_Only_Successful) {
-    ostringstream out;
+    OutputWriter out;
 
     Z = {{10}, {}, {20, 30}};
 
@@ -317,7 +312,7 @@ TEST_F(LinesIOSegmentManipulatorTests, Printing_WithJaggedVector_WithoutSize_Onl
 }
 
 TEST_F(LinesIOSegmentManipulatorTests, Printing_WithJaggedVector_WithoutSize_Failed_DifferentSizes) {
-    ostringstream out;
+    OutputWriter out;
 
     X = {1, 3, 5};
     Y = {2, 4, 6};
@@ -335,11 +330,11 @@ TEST_F(LinesIOSegmentManipulatorTests, Printing_WithJaggedVector_WithoutSize_Fai
 }
 
 TEST_F(LinesIOSegmentManipulatorTests, Parsing_ClearSegment_Successful) {
-    istringstream in("1 2 10\n3 4\n5 6 20 30\n");
+    InputReader in("1 2 10\n3 4\n5 6 20 30\n");
 
     manipulator.parse(segmentWithJaggedVector, &in);
 
-    in.seekg(0, in.beg);
+    in.seek(0);
     manipulator.parse(segmentWithJaggedVector, &in);
     EXPECT_THAT(X, Eq(vector<int>{1, 3, 5}));
     EXPECT_THAT(Y, Eq(vector<int>{2, 4, 6}));
@@ -14,6 +14,7 @@ public:
     MOCK_METHOD1(printInput, void(ostream*));
     MOCK_METHOD1(parseInput, void(istream*));
     MOCK_METHOD1(parseOutput, void(istream*));
+    MOCK_METHOD2(parseOutputs, void(istream*, const vector<string>&));
 };
 
 }
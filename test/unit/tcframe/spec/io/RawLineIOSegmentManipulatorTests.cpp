@@ -1,16 +1,11 @@
 #include "gmock/gmock.h"
 
-#include <sstream>
-
 #include "tcframe/spec/io/RawLineIOSegmentManipulator.hpp"
 
 using ::testing::Eq;
 using ::testing::StrEq;
 using ::testing::Test;
 
-using std::istringstream;
-using std::ostringstream;
-
 namespace tcframe {
 
 class RawLineIOSegmentManipulatorTests : public Test {
@@ -25,20 +20,20 @@ protected:
 };
 
 TEST_F(RawLineIOSegmentManipulatorTests, Parsing_Successful) {
-    istringstream in("  123 45 \n");
+    InputReader in("  123 45 \n");
 
     manipulator.parse(segment, &in);
     EXPECT_THAT(S, Eq("  123 45 "));
 }
 
 TEST_F(RawLineIOSegmentManipulatorTests, Parsing_Successful_CheckLastVariable) {
-    istringstream in("  123 45 \n");
+    InputReader in("  123 45 \n");
 
     EXPECT_THAT(manipulator.parse(segment, &in), Eq("'S'"));
 }
 
 TEST_F(RawLineIOSegmentManipulatorTests, Parsing_Failed_MissingNewline) {
-    istringstream in("  123 45 ");
+    InputReader in("  123 45 ");
 
     try {
         manipulator.parse(segment, &in);
@@ -49,7 +44,7 @@ TEST_F(RawLineIOSegmentManipulatorTests, Parsing_Failed_MissingNewline) {
 }
 
 TEST_F(RawLineIOSegmentManipulatorTests, Printing_Successful) {
-    ostringstream out;
+    OutputWriter out;
 
     S = "  123 45 ";
 
@@ -1,16 +1,11 @@
 #include "gmock/gmock.h"
 
-#include <sstream>
-
 #include "tcframe/spec/io/RawLinesIOSegmentManipulator.hpp"
 
 using ::testing::Eq;
 using ::testing::StrEq;
 using ::testing::Test;
 
-using std::istringstream;
-using std::ostringstream;
-
 namespace tcframe {
 
 class RawLinesIOSegmentManipulatorTests : public Test {
@@ -30,20 +25,20 @@ protected:
 };
 
 TEST_F(RawLinesIOSegmentManipulatorTests, Parsing_Successful) {
-    istringstream in("hello, world!\n  lorem  ipsum \n");
+    InputReader in("hello, world!\n  lorem  ipsum \n");
 
     manipulator.parse(segment, &in);
     EXPECT_THAT(V, Eq(vector<string>{"hello, world!", "  lorem  ipsum "}));
 }
 
 TEST_F(RawLinesIOSegmentManipulatorTests, Parsing_Successful_CheckLastVariable) {
-    istringstream in("hello, world!\n  lorem  ipsum \n");
+    InputReader in("hello, world!\n  lorem  ipsum \n");
 
     EXPECT_THAT(manipulator.parse(segment, &in), Eq("'V[1]'"));
 }
 
 TEST_F(RawLinesIOSegmentManipulatorTests, Parsing_Failed_MissingNewline) {
-    istringstream in("hello, world!\n  lorem  ipsum ");
+    InputReader in("hello, world!\n  lorem  ipsum ");
 
     try {
         manipulator.parse(segment, &in);
@@ -54,20 +49,20 @@ TEST_F(RawLinesIOSegmentManipulatorTests, Parsing_Failed_MissingNewline) {
 }
 
 TEST_F(RawLinesIOSegmentManipulatorTests, Parsing_WithoutSize_Successful) {
-    istringstream in("hello, world!\n  lorem  ipsum \n");
+    InputReader in("hello, world!\n  lorem  ipsum \n");
 
     manipulator.parse(segmentWithoutSize, &in);
     EXPECT_THAT(V, Eq(vector<string>{"hello, world!", "  lorem  ipsum "}));
 }
 
 TEST_F(RawLinesIOSegmentManipulatorTests, Parsing_WithoutSize_Successful_CheckLastVariable) {
-    istringstream in("hello, world!\n  lorem  ipsum \n");
+    InputReader in("hello, world!\n  lorem  ipsum \n");
 
     EXPECT_THAT(manipulator.parse(segmentWithoutSize, &in), Eq("'V[1]'"));
 }
 
 TEST_F(RawLinesIOSegmentManipulatorTests, Parsing_WithoutSize_Failed_MissingNewline) {
-    istringstream in("hello, world!\n  lorem  ipsum ");
+    InputReader in("hello, world!\n  lorem  ipsum ");
 
     try {
         manipulator.parse(segmentWithoutSize, &in);
@@ -78,7 +73,7 @@ TEST_F(RawLinesIOSegmentManipulatorTests, Parsing_WithoutSize_Failed_MissingNewl
 }
 
 TEST_F(RawLinesIOSegmentManipulatorTests, Printing_Successful) {
-    ostringstream out;
+    OutputWriter out;
 
     V = {"hello, world!", "  lorem  ipsum "};
 
@@ -87,7 +82,7 @@ TEST_F(RawLinesIOSegmentManipulatorTests, Printing_Successful) {
 }
 
 TEST_F(RawLinesIOSegmentManipulatorTests, Printing_Failed_SizeMismatch) {
-    ostringstream out;
+    OutputWriter out;
 
     V = {"hello, world!"};
 
@@ -100,7 +95,7 @@ TEST_F(RawLinesIOSegmentManipulatorTests, Printing_Failed_SizeMismatch) {
 }
 
 TEST_F(RawLinesIOSegmentManipulatorTests, Printing_WithoutSize_Successful) {
-    ostringstream out;
+    OutputWriter out;
 
     V = {"hello, world!", "  lorem  ipsum "};
 
@@ -109,11 +104,11 @@ TEST_F(RawLinesIOSegmentManipulatorTests, Printing_WithoutSize_Successful) {
 }
 
 TEST_F(RawLinesIOSegmentManipulatorTests, Parsing_ClearSegment_Successful) {
-    istringstream in("hello, world!\n  lorem  ipsum \n");
+    InputReader in("hello, world!\n  lorem  ipsum \n");
 
     manipulator.parse(segment, &in);
 
-    in.seekg(0, in.beg);
+    in.seek(0);
     manipulator.parse(segment, &in);
     EXPECT_THAT(V, Eq(vector<string>{"hello, world!", "  lorem  ipsum "}));
 }
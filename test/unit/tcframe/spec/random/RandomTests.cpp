@@ -3,8 +3,18 @@
 #include "tcframe/spec/random/Random.hpp"
 
 #include <algorithm>
+#include <climits>
+#include <random>
+#include <set>
+#include <stdexcept>
 #include <vector>
 
+using std::mt19937;
+using std::runtime_error;
+using std::set;
+using std::swap;
+using std::uniform_int_distribution;
+using std::uniform_real_distribution;
 using std::vector;
 
 using ::testing::Eq;
@@ -12,6 +22,8 @@ using ::testing::Le;
 using ::testing::Lt;
 using ::testing::Ge;
 using ::testing::Ne;
+using ::testing::SizeIs;
+using ::testing::StrEq;
 using ::testing::Test;
 
 namespace tcframe {
@@ -71,4 +83,194 @@ TEST_F(RandomTests, Seed) {
     EXPECT_THAT(a, Ne(b));
 }
 
+TEST_F(RandomTests, NextNumber_Bounds) {
+    for (int i = 0; i < 1000; i++) {
+        EXPECT_THAT(rnd.nextInt(-3, 3), Ge(-3));
+        EXPECT_THAT(rnd.nextInt(-3, 3), Le(3));
+        EXPECT_THAT(rnd.nextInt(7, 7), Eq(7));
+    }
+
+    rnd.nextInt(INT_MIN, INT_MAX);
+    rnd.nextLongLong(LLONG_MIN, LLONG_MAX);
+    EXPECT_THAT(rnd.nextLongLong(LLONG_MAX - 1, LLONG_MAX), Ge(LLONG_MAX - 1));
+    EXPECT_THAT(rnd.nextLongLong(LLONG_MIN, LLONG_MIN + 1), Le(LLONG_MIN + 1));
+}
+
+TEST_F(RandomTests, NextNumber_Uniform) {
+    vector<int> counts(6);
+    for (int i = 0; i < 60000; i++) {
+        counts[rnd.nextInt(6)]++;
+    }
+    for (int count : counts) {
+        EXPECT_THAT(count, Ge(9000));
+        EXPECT_THAT(count, Le(11000));
+    }
+}
+
+TEST_F(RandomTests, Seed_Reproducible) {
+    rnd.setSeed(42);
+    int a = rnd.nextInt(1000000000);
+    long long b = rnd.nextLongLong(1000000000000ll);
+    double c = rnd.nextDouble(1.0);
+
+    Random rnd2;
+    rnd2.setSeed(42);
+    EXPECT_THAT(rnd2.nextInt(1000000000), Eq(a));
+    EXPECT_THAT(rnd2.nextLongLong(1000000000000ll), Eq(b));
+    EXPECT_THAT(rnd2.nextDouble(1.0), Eq(c));
+}
+
+TEST_F(RandomTests, Engine_MT19937) {
+    rnd.setEngine(RandomEngine::MT19937);
+    rnd.setSeed(42);
+
+    mt19937 engine(42);
+    EXPECT_THAT(rnd.nextInt(1, 100), Eq(uniform_int_distribution<int>(1, 100)(engine)));
+    EXPECT_THAT(rnd.nextLongLong(1000000000000ll), Eq(uniform_int_distribution<long long>(0, 999999999999ll)(engine)));
+    EXPECT_THAT(rnd.nextDouble(2.0), Eq(uniform_real_distribution<double>(0, 2.0)(engine)));
+}
+
+TEST_F(RandomTests, Fill) {
+    Random rnd2;
+    vector<int> a(100);
+    vector<long long> b(100);
+    vector<double> c(100);
+    rnd.fillInts(a.begin(), a.end(), -10, 10);
+    rnd.fillLongLongs(b.begin(), b.end(), 0, 1000000000000ll);
+    rnd.fillDoubles(c.begin(), c.end(), 1.0, 2.0);
+
+    for (int i = 0; i < 100; i++) {
+        EXPECT_THAT(a[i], Eq(rnd2.nextInt(-10, 10)));
+    }
+    for (int i = 0; i < 100; i++) {
+        EXPECT_THAT(b[i], Eq(rnd2.nextLongLong(0, 1000000000000ll)));
+    }
+    for (int i = 0; i < 100; i++) {
+        EXPECT_THAT(c[i], Eq(rnd2.nextDouble(1.0, 2.0)));
+    }
+}
+
+TEST_F(RandomTests, Fill_MT19937) {
+    rnd.setEngine(RandomEngine::MT19937);
+    Random rnd2;
+    rnd2.setEngine(RandomEngine::MT19937);
+
+    vector<int> a = rnd.nextInts(100, -10, 10);
+    for (int i = 0; i < 100; i++) {
+        EXPECT_THAT(a[i], Eq(rnd2.nextInt(-10, 10)));
+    }
+    EXPECT_THAT(rnd.nextLongLongs(3, 0, 100), Eq(vector<long long>{
+            rnd2.nextLongLong(0, 100),
+            rnd2.nextLongLong(0, 100),
+            rnd2.nextLongLong(0, 100)}));
+}
+
+TEST_F(RandomTests, NextNumbers) {
+    Random rnd2;
+
+    EXPECT_THAT(rnd.nextInts(3, 1, 1000000000), Eq(vector<int>{
+            rnd2.nextInt(1, 1000000000),
+            rnd2.nextInt(1, 1000000000),
+            rnd2.nextInt(1, 1000000000)}));
+    EXPECT_THAT(rnd.nextLongLongs(2, 1, 1000000000000ll), Eq(vector<long long>{
+            rnd2.nextLongLong(1, 1000000000000ll),
+            rnd2.nextLongLong(1, 1000000000000ll)}));
+    EXPECT_THAT(rnd.nextDoubles(2, 0, 1.0), Eq(vector<double>{
+            rnd2.nextDouble(0, 1.0),
+            rnd2.nextDouble(0, 1.0)}));
+    EXPECT_THAT(rnd.nextInts(0, 1, 10), Eq(vector<int>()));
+}
+
+TEST_F(RandomTests, NextDistinctNumbers_Sparse) {
+    vector<long long> numbers = rnd.nextDistinctLongLongs(1000, -1000000000000ll, 1000000000000ll);
+
+    EXPECT_THAT(numbers, SizeIs(1000));
+    EXPECT_THAT(set<long long>(numbers.begin(), numbers.end()), SizeIs(1000));
+    for (long long number : numbers) {
+        EXPECT_THAT(number, Ge(-1000000000000ll));
+        EXPECT_THAT(number, Le(1000000000000ll));
+    }
+}
+
+TEST_F(RandomTests, NextDistinctNumbers_Dense) {
+    vector<int> numbers = rnd.nextDistinctInts(10, 1, 10);
+
+    // almost always true
+    EXPECT_THAT(numbers, Ne(vector<int>{1, 2, 3, 4, 5, 6, 7, 8, 9, 10}));
+
+    sort(numbers.begin(), numbers.end());
+    EXPECT_THAT(numbers, Eq(vector<int>{1, 2, 3, 4, 5, 6, 7, 8, 9, 10}));
+
+    numbers = rnd.nextDistinctInts(6, 1, 10);
+    EXPECT_THAT(set<int>(numbers.begin(), numbers.end()), SizeIs(6));
+}
+
+TEST_F(RandomTests, NextDistinctNumbers_Uniform) {
+    vector<int> counts(5);
+    for (int i = 0; i < 10000; i++) {
+        for (int number : rnd.nextDistinctInts(2, 0, 4)) {
+            counts[number]++;
+        }
+    }
+    for (int count : counts) {
+        EXPECT_THAT(count, Ge(3600));
+        EXPECT_THAT(count, Le(4400));
+    }
+}
+
+TEST_F(RandomTests, NextDistinctNumbers_Failed) {
+    try {
+        rnd.nextDistinctInts(11, 1, 10);
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("Cannot pick 11 distinct numbers between 1 and 10"));
+    }
+}
+
+// The values are computed by the documented algorithms, independently of this implementation. They must not change, so
+// that test cases stay identical across platforms and versions.
+TEST_F(RandomTests, Values_Stable) {
+    rnd.setSeed(42);
+
+    EXPECT_THAT(rnd.nextInt(1, 100), Eq(9));
+    EXPECT_THAT(rnd.nextInt(1, 100), Eq(38));
+    EXPECT_THAT(rnd.nextInt(1, 100), Eq(69));
+    EXPECT_THAT(rnd.nextLongLong(LLONG_MIN, LLONG_MAX), Eq(7834202072327348385ll));
+    EXPECT_THAT(rnd.nextLongLong(1000000000000000000ll), Eq(991803914282102882ll));
+    EXPECT_THAT(rnd.nextDouble(0, 1), Eq(0.7697394604342425));
+    EXPECT_THAT(rnd.nextDouble(-1.5, 2.5), Eq(1.3770343115116623));
+
+    vector<int> data = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    rnd.shuffle(data.begin(), data.end());
+    EXPECT_THAT(data, Eq(vector<int>{1, 6, 8, 5, 3, 7, 9, 4, 10, 2}));
+
+    EXPECT_THAT(rnd.nextDistinctInts(5, 1, 1000000), Eq(vector<int>{851388, 92861, 707829, 616760, 707540}));
+    EXPECT_THAT(rnd.nextDistinctInts(5, 1, 5), Eq(vector<int>{3, 1, 5, 2, 4}));
+}
+
+TEST_F(RandomTests, Shuffle_MT19937) {
+    rnd.setEngine(RandomEngine::MT19937);
+    rnd.setSeed(42);
+    vector<int> data = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    rnd.shuffle(data.begin(), data.end());
+
+    // The order of the random_shuffle() of libstdc++, which earlier versions used.
+    mt19937 engine(42);
+    vector<int> expected = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    for (int i = 1; i < 10; i++) {
+        int j = uniform_int_distribution<int>(0, i)(engine);
+        if (i != j) {
+            swap(expected[i], expected[j]);
+        }
+    }
+    EXPECT_THAT(data, Eq(expected));
+}
+
+TEST_F(RandomTests, Shuffle_Empty) {
+    vector<int> data;
+    rnd.shuffle(data.begin(), data.end());
+
+    EXPECT_THAT(data, Eq(vector<int>()));
+}
+
 }
@@ -0,0 +1,24 @@
+#include "gmock/gmock.h"
+
+#include "tcframe/spec/random/SeedDeriver.hpp"
+
+using ::testing::Eq;
+using ::testing::Ne;
+using ::testing::Test;
+
+namespace tcframe {
+
+class SeedDeriverTests : public Test {};
+
+TEST_F(SeedDeriverTests, Derivation_Deterministic) {
+    EXPECT_THAT(SeedDeriver::derive(42, 1, 2), Eq(SeedDeriver::derive(42, 1, 2)));
+}
+
+TEST_F(SeedDeriverTests, Derivation_Distinct) {
+    EXPECT_THAT(SeedDeriver::derive(42, 1, 2), Ne(SeedDeriver::derive(43, 1, 2)));
+    EXPECT_THAT(SeedDeriver::derive(42, 1, 2), Ne(SeedDeriver::derive(42, 2, 2)));
+    EXPECT_THAT(SeedDeriver::derive(42, 1, 2), Ne(SeedDeriver::derive(42, 1, 3)));
+    EXPECT_THAT(SeedDeriver::derive(42, 1, 2), Ne(SeedDeriver::derive(42, 2, 1)));
+}
+
+}
@@ -0,0 +1,37 @@
+#include "gmock/gmock.h"
+
+#include "tcframe/spec/random/Xoshiro256StarStar.hpp"
+
+using ::testing::Eq;
+using ::testing::Test;
+
+namespace tcframe {
+
+class Xoshiro256StarStarTests : public Test {};
+
+TEST_F(Xoshiro256StarStarTests, Generation_ReferenceState) {
+    Xoshiro256StarStar engine(1, 2, 3, 4);
+
+    EXPECT_THAT(engine(), Eq(11520ULL));
+    EXPECT_THAT(engine(), Eq(0ULL));
+    EXPECT_THAT(engine(), Eq(1509978240ULL));
+    EXPECT_THAT(engine(), Eq(1215971899390074240ULL));
+}
+
+TEST_F(Xoshiro256StarStarTests, Generation_Seeded) {
+    Xoshiro256StarStar engine(42);
+
+    EXPECT_THAT(engine(), Eq(0x15780b2e0c2ec716ULL));
+    EXPECT_THAT(engine(), Eq(0x6104d9866d113a7eULL));
+    EXPECT_THAT(engine(), Eq(0xae17533239e499a1ULL));
+}
+
+TEST_F(Xoshiro256StarStarTests, Seeding) {
+    Xoshiro256StarStar engine;
+    engine();
+    engine.seed(42);
+
+    EXPECT_THAT(engine(), Eq(Xoshiro256StarStar(42)()));
+}
+
+}
@@ -0,0 +1,164 @@
+#include "gmock/gmock.h"
+
+#include "tcframe/spec/variable/Matrix.hpp"
+
+using ::testing::Eq;
+using ::testing::StrEq;
+using ::testing::Test;
+
+namespace tcframe {
+
+class FlatMatrixTests : public Test {
+protected:
+    FlatMatrix<int> m;
+    FlatMatrix<char> c;
+    Matrix* M = Matrix::create(m, "M");
+    Matrix* C = Matrix::create(c, "C");
+
+    static vector<vector<int>> toVectors(const FlatMatrix<int>& matrix) {
+        vector<vector<int>> result;
+        for (int r = 0; r < matrix.rows(); r++) {
+            result.push_back(vector<int>(matrix[r], matrix[r] + matrix.columns(r)));
+        }
+        return result;
+    }
+};
+
+TEST_F(FlatMatrixTests, Construction) {
+    FlatMatrix<char> grid(2, 3, '.');
+    grid[1][2] = '#';
+
+    EXPECT_THAT(grid.rows(), Eq(2));
+    EXPECT_THAT(grid.columns(0), Eq(3));
+    EXPECT_THAT(grid.columns(1), Eq(3));
+    EXPECT_THAT(string(grid.data(), 6), Eq(".....#"));
+}
+
+TEST_F(FlatMatrixTests, AddingRows) {
+    m.addRow({1, 2});
+    m.addRow({});
+    m.addRow({3, 4, 5});
+
+    EXPECT_THAT(toVectors(m), Eq(vector<vector<int>>{{1, 2}, {}, {3, 4, 5}}));
+
+    m.clear();
+    EXPECT_TRUE(m.empty());
+    EXPECT_THAT(m, Eq(FlatMatrix<int>()));
+}
+
+TEST_F(FlatMatrixTests, Parsing_Successful) {
+    InputReader in("1 2 3\n4 5 6\n");
+    M->parseFrom(&in, 2, 3);
+
+    EXPECT_THAT(toVectors(m), Eq(vector<vector<int>>{{1, 2, 3}, {4, 5, 6}}));
+}
+
+TEST_F(FlatMatrixTests, Parsing_Char) {
+    InputReader in("abc\ndef\n");
+    C->parseFrom(&in, 2, 3);
+
+    EXPECT_THAT(c.rows(), Eq(2));
+    EXPECT_THAT(string(c.data(), 6), Eq("abcdef"));
+}
+
+TEST_F(FlatMatrixTests, Parsing_Char_Failed_ShortRow) {
+    InputReader in("abc\nde\n");
+
+    try {
+        C->parseFrom(&in, 2, 3);
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("Cannot parse for 'C[1][2]'. Found: <whitespace>"));
+    }
+}
+
+TEST_F(FlatMatrixTests, Parsing_Char_Failed_MissingNewline) {
+    InputReader in("abcd\nefg\n");
+
+    try {
+        C->parseFrom(&in, 2, 3);
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("Expected: <newline> after 'C[0][2]'"));
+    }
+}
+
+TEST_F(FlatMatrixTests, Parsing_Failed_MissingSpace) {
+    InputReader in("1 2 3\n4\n");
+
+    try {
+        M->parseFrom(&in, 2, 3);
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("Expected: <space> after 'M[1][0]'"));
+    }
+}
+
+TEST_F(FlatMatrixTests, Parsing_Failed_RolledBack) {
+    m.addRow({7, 8});
+    InputReader in("1 2 3\n4\n");
+
+    try {
+        M->parseFrom(&in, 2, 3);
+        FAIL();
+    } catch (runtime_error&) {}
+    EXPECT_THAT(toVectors(m), Eq(vector<vector<int>>{{7, 8}}));
+}
+
+TEST_F(FlatMatrixTests, Parsing_Char_Failed_HugeSize) {
+    InputReader in("abc\n");
+
+    try {
+        C->parseFrom(&in, 2000000000, 2000000000);
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("Cannot parse for 'C[0][3]'. Found: <whitespace>"));
+    }
+    EXPECT_TRUE(c.empty());
+}
+
+TEST_F(FlatMatrixTests, Parsing_WithoutSize_Rows_Successful) {
+    InputReader in("1 2\n3 4 5\n6\n");
+    M->parseAndAddRowFrom(&in, 0);
+    WhitespaceManipulator::parseNewline(&in, TokenContext());
+    M->parseAndAddRowFrom(&in, 1);
+    WhitespaceManipulator::parseNewline(&in, TokenContext());
+    M->parseAndAddRowFrom(&in, 2);
+    WhitespaceManipulator::parseNewline(&in, TokenContext());
+
+    EXPECT_THAT(toVectors(m), Eq(vector<vector<int>>{{1, 2}, {3, 4, 5}, {6}}));
+}
+
+TEST_F(FlatMatrixTests, Parsing_WithoutSize_Rows_Failed_RolledBack) {
+    m.addRow({7, 8});
+    InputReader in("1 2  3\n");
+
+    try {
+        M->parseAndAddRowFrom(&in, 1);
+        FAIL();
+    } catch (runtime_error&) {}
+    EXPECT_THAT(toVectors(m), Eq(vector<vector<int>>{{7, 8}}));
+}
+
+TEST_F(FlatMatrixTests, Printing) {
+    m = FlatMatrix<int>(2, 3);
+    for (int i = 0; i < 6; i++) {
+        m.data()[i] = i + 1;
+    }
+    OutputWriter out;
+    M->printTo(&out);
+
+    EXPECT_THAT(out.str(), Eq("1 2 3\n4 5 6\n"));
+}
+
+TEST_F(FlatMatrixTests, Printing_Char) {
+    c = FlatMatrix<char>(2, 3, 'x');
+    c[0][1] = 'y';
+    OutputWriter out;
+    C->printTo(&out);
+    C->printRowTo(1, &out);
+
+    EXPECT_THAT(out.str(), Eq("xyx\nxxx\nxxx"));
+}
+
+}
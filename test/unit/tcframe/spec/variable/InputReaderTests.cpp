@@ -0,0 +1,216 @@
+#include "gmock/gmock.h"
+
+#include <sstream>
+#include <string>
+
+#include "tcframe/spec/variable/InputReader.hpp"
+
+using ::testing::DoubleEq;
+using ::testing::Eq;
+using ::testing::FloatEq;
+using ::testing::Test;
+
+using std::istringstream;
+using std::string;
+
+namespace tcframe {
+
+class InputReaderTests : public Test {};
+
+TEST_F(InputReaderTests, Reading_Int) {
+    InputReader in("123 -45 +6");
+    int a, b, c;
+    EXPECT_TRUE(in.read(a));
+    in.get();
+    EXPECT_TRUE(in.read(b));
+    in.get();
+    EXPECT_TRUE(in.read(c));
+    EXPECT_THAT(a, Eq(123));
+    EXPECT_THAT(b, Eq(-45));
+    EXPECT_THAT(c, Eq(6));
+    EXPECT_THAT(in.peek(), Eq(char_traits<char>::eof()));
+}
+
+TEST_F(InputReaderTests, Reading_Int_Limits) {
+    InputReader in("2147483647 -2147483648");
+    int a, b;
+    EXPECT_TRUE(in.read(a));
+    in.get();
+    EXPECT_TRUE(in.read(b));
+    EXPECT_THAT(a, Eq(2147483647));
+    EXPECT_THAT(b, Eq(-2147483647 - 1));
+}
+
+TEST_F(InputReaderTests, Reading_Int_Overflow) {
+    InputReader in("2147483648");
+    int a;
+    EXPECT_FALSE(in.read(a));
+    EXPECT_THAT(in.position(), Eq(0));
+}
+
+TEST_F(InputReaderTests, Reading_LongLong_Limits) {
+    InputReader in("9223372036854775807 -9223372036854775808 9223372036854775808");
+    long long a, b, c;
+    EXPECT_TRUE(in.read(a));
+    in.get();
+    EXPECT_TRUE(in.read(b));
+    in.get();
+    EXPECT_FALSE(in.read(c));
+    EXPECT_THAT(a, Eq(9223372036854775807LL));
+    EXPECT_THAT(b, Eq(-9223372036854775807LL - 1));
+}
+
+TEST_F(InputReaderTests, Reading_Unsigned_Negative) {
+    InputReader in("-1");
+    unsigned a;
+    EXPECT_FALSE(in.read(a));
+}
+
+TEST_F(InputReaderTests, Reading_Int_StopsAtNonDigit) {
+    InputReader in("12abc");
+    int a;
+    EXPECT_TRUE(in.read(a));
+    EXPECT_THAT(a, Eq(12));
+    EXPECT_THAT(in.peek(), Eq('a'));
+}
+
+TEST_F(InputReaderTests, Reading_Int_Failed) {
+    InputReader in("-abc");
+    int a;
+    EXPECT_FALSE(in.read(a));
+    EXPECT_THAT(in.readToken(20), Eq("-abc"));
+}
+
+TEST_F(InputReaderTests, Reading_Bool) {
+    InputReader in("1 0 2");
+    bool a, b, c;
+    EXPECT_TRUE(in.read(a));
+    in.get();
+    EXPECT_TRUE(in.read(b));
+    in.get();
+    EXPECT_FALSE(in.read(c));
+    EXPECT_TRUE(a);
+    EXPECT_FALSE(b);
+}
+
+TEST_F(InputReaderTests, Reading_Double) {
+    InputReader in("3.25 -1e3 .5 7. 2E-2");
+    double a, b, c, d, e;
+    EXPECT_TRUE(in.read(a));
+    in.get();
+    EXPECT_TRUE(in.read(b));
+    in.get();
+    EXPECT_TRUE(in.read(c));
+    in.get();
+    EXPECT_TRUE(in.read(d));
+    in.get();
+    EXPECT_TRUE(in.read(e));
+    EXPECT_THAT(a, DoubleEq(3.25));
+    EXPECT_THAT(b, DoubleEq(-1000));
+    EXPECT_THAT(c, DoubleEq(0.5));
+    EXPECT_THAT(d, DoubleEq(7));
+    EXPECT_THAT(e, DoubleEq(0.02));
+}
+
+TEST_F(InputReaderTests, Reading_Float) {
+    InputReader in("0.1");
+    float a;
+    EXPECT_TRUE(in.read(a));
+    EXPECT_THAT(a, FloatEq(0.1f));
+}
+
+TEST_F(InputReaderTests, Reading_Double_Failed) {
+    double a;
+
+    InputReader in1(".");
+    EXPECT_FALSE(in1.read(a));
+
+    InputReader in2("1e");
+    EXPECT_FALSE(in2.read(a));
+
+    InputReader in3("1e999");
+    EXPECT_FALSE(in3.read(a));
+
+    InputReader in4("inf");
+    EXPECT_FALSE(in4.read(a));
+}
+
+TEST_F(InputReaderTests, Reading_Char) {
+    InputReader in("ab");
+    char a, b, c;
+    EXPECT_TRUE(in.read(a));
+    EXPECT_TRUE(in.read(b));
+    EXPECT_FALSE(in.read(c));
+    EXPECT_THAT(a, Eq('a'));
+    EXPECT_THAT(b, Eq('b'));
+}
+
+TEST_F(InputReaderTests, Reading_String) {
+    InputReader in("hello world");
+    string a, b;
+    EXPECT_TRUE(in.read(a));
+    in.get();
+    EXPECT_TRUE(in.read(b));
+    EXPECT_THAT(a, Eq("hello"));
+    EXPECT_THAT(b, Eq("world"));
+}
+
+TEST_F(InputReaderTests, Reading_Token_MaxLength) {
+    InputReader in("abcdef gh");
+    EXPECT_THAT(in.readToken(4), Eq("abcd"));
+}
+
+TEST_F(InputReaderTests, Reading_Characters) {
+    InputReader in("abcd\nef gh");
+    char block[4];
+    EXPECT_THAT(in.readCharacters(block, 3), Eq(3));
+    EXPECT_THAT(string(block, 3), Eq("abc"));
+    EXPECT_THAT(in.readCharacters(block, 3), Eq(1));
+    EXPECT_THAT(block[0], Eq('d'));
+    EXPECT_THAT(in.peek(), Eq('\n'));
+    in.get();
+    EXPECT_THAT(in.readCharacters(block, 4), Eq(2));
+    in.get();
+    EXPECT_THAT(in.readCharacters(block, 4), Eq(2));
+    EXPECT_THAT(in.peek(), Eq(char_traits<char>::eof()));
+}
+
+TEST_F(InputReaderTests, Reading_Line) {
+    InputReader in(" a b \nc");
+    string line;
+    in.readLine(line);
+    EXPECT_THAT(line, Eq(" a b "));
+    EXPECT_THAT(in.peek(), Eq('\n'));
+}
+
+TEST_F(InputReaderTests, Seeking) {
+    InputReader in("12 34");
+    int a;
+    in.read(a);
+    in.seek(0);
+    in.read(a);
+    EXPECT_THAT(a, Eq(12));
+    EXPECT_THAT(in.position(), Eq(2));
+}
+
+TEST_F(InputReaderTests, Reading_FromStream) {
+    istringstream stream("skipped 42\n");
+    string skipped;
+    stream >> skipped;
+    stream.get();
+
+    InputReader in(&stream);
+    int a;
+    EXPECT_TRUE(in.read(a));
+    EXPECT_THAT(a, Eq(42));
+    EXPECT_THAT(in.get(), Eq('\n'));
+    EXPECT_THAT(in.get(), Eq(char_traits<char>::eof()));
+}
+
+TEST_F(InputReaderTests, Reading_FromStream_Empty) {
+    istringstream stream("");
+    InputReader in(&stream);
+    EXPECT_THAT(in.peek(), Eq(char_traits<char>::eof()));
+}
+
+}
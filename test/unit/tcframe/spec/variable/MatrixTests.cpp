@@ -2,15 +2,10 @@
 
 #include "tcframe/spec/variable/Matrix.hpp"
 
-#include <sstream>
-
 using ::testing::Eq;
 using ::testing::StrEq;
 using ::testing::Test;
 
-using std::istringstream;
-using std::ostringstream;
-
 namespace tcframe {
 
 class MatrixTests : public Test {
@@ -22,21 +17,65 @@ protected:
 };
 
 TEST_F(MatrixTests, Parsing_Successful) {
-    istringstream in("1 2 3\n4 5 6\n");
+    InputReader in("1 2 3\n4 5 6\n");
     M->parseFrom(&in, 2, 3);
 
     EXPECT_THAT(m, Eq(vector<vector<int>>{{1, 2, 3}, {4, 5, 6}}));
 }
 
+TEST_F(MatrixTests, Parsing_Reserved) {
+    InputReader in("1 2 3\n4 5 6\n");
+    M->parseFrom(&in, 2, 3);
+
+    EXPECT_THAT(m.capacity(), Eq(2));
+    EXPECT_THAT(m[0].capacity(), Eq(3));
+    EXPECT_THAT(m[1].capacity(), Eq(3));
+}
+
 TEST_F(MatrixTests, Parsing_Char) {
-    istringstream in("abc\ndef\n");
+    InputReader in("abc\ndef\n");
     C->parseFrom(&in, 2, 3);
 
     EXPECT_THAT(c, Eq(vector<vector<char>>{{'a', 'b', 'c'}, {'d', 'e', 'f'}}));
 }
 
+TEST_F(MatrixTests, Parsing_Char_Failed_ShortRow) {
+    InputReader in("abc\nde\n");
+
+    try {
+        C->parseFrom(&in, 2, 3);
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("Cannot parse for 'C[1][2]'. Found: <whitespace>"));
+    }
+}
+
+TEST_F(MatrixTests, Parsing_Failed_HugeSize) {
+    InputReader in("1 2 3\n");
+
+    try {
+        M->parseFrom(&in, 2000000000, 2000000000);
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("Expected: <space> after 'M[0][2]'"));
+    }
+    EXPECT_THAT(m.capacity(), Eq(6));
+}
+
+TEST_F(MatrixTests, Parsing_Char_Failed_HugeSize) {
+    InputReader in("abc\n");
+
+    try {
+        C->parseFrom(&in, 2000000000, 2000000000);
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("Cannot parse for 'C[0][3]'. Found: <whitespace>"));
+    }
+    EXPECT_THAT(c.capacity(), Eq(4));
+}
+
 TEST_F(MatrixTests, Parsing_Failed_MissingSpace) {
-    istringstream in("1 2 3\n4\n");
+    InputReader in("1 2 3\n4\n");
 
     try {
         M->parseFrom(&in, 2, 3);
@@ -47,7 +86,7 @@ TEST_F(MatrixTests, Parsing_Failed_MissingSpace) {
 }
 
 TEST_F(MatrixTests, Parsing_Failed_MissingNewline) {
-    istringstream in("1 2 3 4 5 6\n");
+    InputReader in("1 2 3 4 5 6\n");
 
     try {
         M->parseFrom(&in, 2, 3);
@@ -58,7 +97,7 @@ TEST_F(MatrixTests, Parsing_Failed_MissingNewline) {
 }
 
 TEST_F(MatrixTests, Parsing_Failed_ExtraWhitespace) {
-    istringstream in("1 2 3\n 4 5 6\n");
+    InputReader in("1 2 3\n 4 5 6\n");
 
     try {
         M->parseFrom(&in, 2, 3);
@@ -69,19 +108,19 @@ TEST_F(MatrixTests, Parsing_Failed_ExtraWhitespace) {
 }
 
 TEST_F(MatrixTests, Parsing_WithoutSize_Rows_Successful) {
-    istringstream in("1 2\n3 4 5\n6\n");
+    InputReader in("1 2\n3 4 5\n6\n");
     M->parseAndAddRowFrom(&in, 0);
-    WhitespaceManipulator::parseNewline(&in, "");
+    WhitespaceManipulator::parseNewline(&in, TokenContext());
     M->parseAndAddRowFrom(&in, 1);
-    WhitespaceManipulator::parseNewline(&in, "");
+    WhitespaceManipulator::parseNewline(&in, TokenContext());
     M->parseAndAddRowFrom(&in, 2);
-    WhitespaceManipulator::parseNewline(&in, "");
+    WhitespaceManipulator::parseNewline(&in, TokenContext());
 
     EXPECT_THAT(m, Eq(vector<vector<int>>{{1, 2}, {3, 4, 5}, {6}}));
 }
 
 TEST_F(MatrixTests, Parsing_WithoutSize_Rows_Failed_LeadingWhitespace) {
-    istringstream in(" 1 2 3");
+    InputReader in(" 1 2 3");
 
     try {
         M->parseAndAddRowFrom(&in, 0);
@@ -92,7 +131,7 @@ TEST_F(MatrixTests, Parsing_WithoutSize_Rows_Failed_LeadingWhitespace) {
 }
 
 TEST_F(MatrixTests, Parsing_WithoutSize_Rows_Failed_MissingVariable) {
-    istringstream in("1 2  3");
+    InputReader in("1 2  3");
 
     try {
         M->parseAndAddRowFrom(&in, 0);
@@ -104,7 +143,7 @@ TEST_F(MatrixTests, Parsing_WithoutSize_Rows_Failed_MissingVariable) {
 
 TEST_F(MatrixTests, Printing_WithoutSize) {
     m = {{1, 2, 3}, {4, 5, 6}};
-    ostringstream out;
+    OutputWriter out;
     M->printTo(&out);
 
     EXPECT_THAT(out.str(), Eq("1 2 3\n4 5 6\n"));
@@ -112,18 +151,18 @@ TEST_F(MatrixTests, Printing_WithoutSize) {
 
 TEST_F(MatrixTests, Printing_WithoutSize_Rows) {
     m = {{1, 2, 3}, {4, 5, 6}};
-    ostringstream out;
+    OutputWriter out;
     M->printRowTo(0, &out);
-    out << endl;
+    out.write('\n');
     M->printRowTo(1, &out);
-    out << endl;
+    out.write('\n');
 
     EXPECT_THAT(out.str(), Eq("1 2 3\n4 5 6\n"));
 }
 
 TEST_F(MatrixTests, Printing_Char) {
     c = {{'a', 'b', 'c'}, {'d', 'e', 'f'}};
-    ostringstream out;
+    OutputWriter out;
     C->printTo(&out);
 
     EXPECT_THAT(out.str(), Eq("abc\ndef\n"));
@@ -0,0 +1,94 @@
+#include "gmock/gmock.h"
+
+#include <climits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "tcframe/spec/variable/OutputWriter.hpp"
+
+using ::testing::Eq;
+using ::testing::Test;
+
+using std::ostringstream;
+using std::string;
+using std::vector;
+
+namespace tcframe {
+
+class OutputWriterTests : public Test {
+protected:
+    OutputWriter out;
+};
+
+TEST_F(OutputWriterTests, Writing_Integers) {
+    out.write(0);
+    out.write(' ');
+    out.write(7);
+    out.write(' ');
+    out.write(-42);
+    out.write(' ');
+    out.write(1234567);
+    out.write(' ');
+    out.write(LLONG_MIN);
+    out.write(' ');
+    out.write(ULLONG_MAX);
+    EXPECT_THAT(out.str(), Eq("0 7 -42 1234567 -9223372036854775808 18446744073709551615"));
+}
+
+TEST_F(OutputWriterTests, Writing_Reals) {
+    out.write(3.25);
+    out.write(' ');
+    out.write(0.1f);
+    out.write(' ');
+    out.write(1e20);
+    out.write(' ');
+    out.write(1.0 / 3);
+    EXPECT_THAT(out.str(), Eq("3.25 0.1 1e+20 0.333333"));
+}
+
+TEST_F(OutputWriterTests, Writing_CharactersAndStrings) {
+    out.write('a');
+    out.write(true);
+    out.write(string(" hello"));
+    EXPECT_THAT(out.str(), Eq("a1 hello"));
+}
+
+TEST_F(OutputWriterTests, Writing_Rows) {
+    out.writeRow(vector<int>{1, 2, 3}, true);
+    out.write('\n');
+    out.writeRow(vector<char>{'a', 'b', 'c'}, false);
+    out.write('\n');
+    out.writeRow(vector<char>{'a', 'b'}, true);
+    out.write('\n');
+    out.writeRow(vector<int>(), true);
+    EXPECT_THAT(out.str(), Eq("1 2 3\nabc\na b\n"));
+}
+
+TEST_F(OutputWriterTests, Writing_Rows_FromPointers) {
+    int numbers[] = {1, 2, 3};
+    const char* characters = "abc";
+    out.writeRow(numbers, 3, true);
+    out.write('\n');
+    out.writeRow(characters, 3, false);
+    out.write('\n');
+    out.writeRow(characters, 2, true);
+    EXPECT_THAT(out.str(), Eq("1 2 3\nabc\na b"));
+}
+
+TEST_F(OutputWriterTests, Writing_ToStream) {
+    ostringstream stream;
+    OutputWriter writer(&stream);
+    for (int i = 0; i < 100000; i++) {
+        writer.write(i % 10);
+    }
+    writer.flush();
+
+    string expected;
+    for (int i = 0; i < 100000; i++) {
+        expected += (char) ('0' + i % 10);
+    }
+    EXPECT_THAT(stream.str(), Eq(expected));
+}
+
+}
@@ -3,13 +3,10 @@
 #include "tcframe/spec/variable/Scalar.hpp"
 
 #include <vector>
-#include <sstream>
 
 using ::testing::Eq;
 using ::testing::Test;
 
-using std::istringstream;
-using std::ostringstream;
 using std::vector;
 
 namespace tcframe {
@@ -89,13 +86,13 @@ TEST_F(ScalarTests, Compatibility_UnsupportedTypes){
 }
 
 TEST_F(ScalarTests, Parsing) {
-    istringstream in("42");
+    InputReader in("42");
     A->parseFrom(&in);
     EXPECT_THAT(a, Eq(42));
 }
 
 TEST_F(ScalarTests, Printing) {
-    ostringstream out;
+    OutputWriter out;
     a = 42;
     A->printTo(&out);
     EXPECT_THAT(out.str(), Eq("42"));
@@ -0,0 +1,48 @@
+#include "gmock/gmock.h"
+
+#include <type_traits>
+
+#include "tcframe/spec/variable/TokenContext.hpp"
+
+using ::testing::Eq;
+using ::testing::Test;
+using std::is_constructible;
+using std::is_convertible;
+
+namespace tcframe {
+
+class TokenContextTests : public Test {
+protected:
+    string name = "X";
+};
+
+TEST_F(TokenContextTests, Empty) {
+    TokenContext context;
+    EXPECT_TRUE(context.empty());
+    EXPECT_THAT(context.format(), Eq(""));
+}
+
+TEST_F(TokenContextTests, Text) {
+    TokenContext context("'Y'");
+    EXPECT_FALSE(context.empty());
+    EXPECT_THAT(context.format(), Eq("'Y'"));
+}
+
+TEST_F(TokenContextTests, Text_NotFromString) {
+    EXPECT_FALSE((is_constructible<TokenContext, string>::value));
+    EXPECT_FALSE((is_convertible<const char*, TokenContext>::value));
+}
+
+TEST_F(TokenContextTests, Variable) {
+    EXPECT_THAT(TokenContext::variable(name).format(), Eq("'X'"));
+}
+
+TEST_F(TokenContextTests, VectorElement) {
+    EXPECT_THAT(TokenContext::vectorElement(name, 2).format(), Eq("'X[2]'"));
+}
+
+TEST_F(TokenContextTests, MatrixElement) {
+    EXPECT_THAT(TokenContext::matrixElement(name, 2, 3).format(), Eq("'X[2][3]'"));
+}
+
+}
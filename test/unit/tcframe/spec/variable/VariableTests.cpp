@@ -8,7 +8,6 @@ using ::testing::Eq;
 using ::testing::StrEq;
 using ::testing::Test;
 
-using std::istringstream;
 using std::ostringstream;
 
 namespace tcframe {
@@ -20,15 +19,15 @@ protected:
 };
 
 TEST_F(VariableTests, Parsing_Successful) {
-    istringstream in("123");
-    Variable::parseValue(&in, X, "'X'");
+    InputReader in("123");
+    Variable::parseValue(&in, X, TokenContext("'X'"));
     EXPECT_THAT(X, Eq(123));
 }
 
 TEST_F(VariableTests, Parsing_Failed_FoundWhitespace) {
-    istringstream in(" 123");
+    InputReader in(" 123");
     try {
-        Variable::parseValue(&in, X, "'X'");
+        Variable::parseValue(&in, X, TokenContext("'X'"));
         FAIL();
     } catch (runtime_error& e) {
         EXPECT_THAT(e.what(), StrEq("Cannot parse for 'X'. Found: <whitespace>"));
@@ -36,9 +35,9 @@ TEST_F(VariableTests, Parsing_Failed_FoundWhitespace) {
 }
 
 TEST_F(VariableTests, Parsing_Failed_FoundEof) {
-    istringstream in("");
+    InputReader in("");
     try {
-        Variable::parseValue(&in, X, "'X'");
+        Variable::parseValue(&in, X, TokenContext("'X'"));
         FAIL();
     } catch (runtime_error& e) {
         EXPECT_THAT(e.what(), StrEq("Cannot parse for 'X'. Found: <EOF>"));
@@ -46,9 +45,9 @@ TEST_F(VariableTests, Parsing_Failed_FoundEof) {
 }
 
 TEST_F(VariableTests, Parsing_Failed_Overflow) {
-    istringstream in("12345678901234567890");
+    InputReader in("12345678901234567890");
     try {
-        Variable::parseValue(&in, X, "'X'");
+        Variable::parseValue(&in, X, TokenContext("'X'"));
         FAIL();
     } catch (runtime_error& e) {
         EXPECT_THAT(e.what(), StrEq("Cannot parse for 'X'. Found: '12345678901234567890'"));
@@ -56,9 +55,9 @@ TEST_F(VariableTests, Parsing_Failed_Overflow) {
 }
 
 TEST_F(VariableTests, Parsing_Failed_TypeMismatch) {
-    istringstream in("abc123");
+    InputReader in("abc123");
     try {
-        Variable::parseValue(&in, X, "'X'");
+        Variable::parseValue(&in, X, TokenContext("'X'"));
         FAIL();
     } catch (runtime_error& e) {
         EXPECT_THAT(e.what(), StrEq("Cannot parse for 'X'. Found: 'abc123'"));
@@ -66,19 +65,19 @@ TEST_F(VariableTests, Parsing_Failed_TypeMismatch) {
 }
 
 TEST_F(VariableTests, Parsing_Raw_Successful) {
-    istringstream in("  123 45 \nabc");
+    InputReader in("  123 45 \nabc");
     Variable::parseRawLine(&in, S);
     EXPECT_THAT(S, Eq("  123 45 "));
 }
 
 TEST_F(VariableTests, Parsing_Raw_Successful_Empty) {
-    istringstream in("\nabc");
+    InputReader in("\nabc");
     Variable::parseRawLine(&in, S);
     EXPECT_THAT(S, Eq(""));
 }
 
 TEST_F(VariableTests, Parsing_Raw_Successful_Eof) {
-    istringstream in("  123 45 ");
+    InputReader in("  123 45 ");
     Variable::parseRawLine(&in, S);
     EXPECT_THAT(S, Eq("  123 45 "));
 }
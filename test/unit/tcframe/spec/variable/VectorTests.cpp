@@ -2,15 +2,11 @@
 
 #include "tcframe/spec/variable/Vector.hpp"
 
-#include <sstream>
-
 using ::testing::Eq;
+using ::testing::Ge;
 using ::testing::StrEq;
 using ::testing::Test;
 
-using std::istringstream;
-using std::ostringstream;
-
 namespace tcframe {
 
 class VectorTests : public Test {
@@ -20,14 +16,41 @@ protected:
 };
 
 TEST_F(VectorTests, Parsing_Successful) {
-    istringstream in("1 2 3");
+    InputReader in("1 2 3");
     V->parseFrom(&in, 3);
 
     EXPECT_THAT(v, Eq(vector<int>{1, 2, 3}));
 }
 
+TEST_F(VectorTests, Parsing_Reserved) {
+    InputReader in("1 2 3");
+    V->parseFrom(&in, 3);
+
+    EXPECT_THAT(v.capacity(), Eq(3));
+}
+
+TEST_F(VectorTests, Parsing_Failed_HugeSize) {
+    InputReader in("1 2");
+
+    try {
+        V->parseFrom(&in, 2000000000);
+        FAIL();
+    } catch (runtime_error& e) {
+        EXPECT_THAT(e.what(), StrEq("Expected: <space> after 'V[1]'"));
+    }
+    EXPECT_THAT(v.capacity(), Eq(3));
+}
+
+TEST_F(VectorTests, Reserving) {
+    v = {1};
+    V->reserve(4);
+
+    EXPECT_THAT(v, Eq(vector<int>{1}));
+    EXPECT_THAT(v.capacity(), Ge(5));
+}
+
 TEST_F(VectorTests, Parsing_Failed_MissingSpace) {
-    istringstream in("1 2");
+    InputReader in("1 2");
 
     try {
         V->parseFrom(&in, 3);
@@ -38,7 +61,7 @@ TEST_F(VectorTests, Parsing_Failed_MissingSpace) {
 }
 
 TEST_F(VectorTests, Parsing_Failed_LeadingWhitepace) {
-    istringstream in(" 1 2 3");
+    InputReader in(" 1 2 3");
 
     try {
         V->parseFrom(&in, 3);
@@ -49,7 +72,7 @@ TEST_F(VectorTests, Parsing_Failed_LeadingWhitepace) {
 }
 
 TEST_F(VectorTests, Parsing_Failed_ExtraWhitepace) {
-    istringstream in("1 2  3");
+    InputReader in("1 2  3");
 
     try {
         V->parseFrom(&in, 3);
@@ -60,14 +83,14 @@ TEST_F(VectorTests, Parsing_Failed_ExtraWhitepace) {
 }
 
 TEST_F(VectorTests, Parsing_WithoutSize_Successful) {
-    istringstream in("1 2 3\n");
+    InputReader in("1 2 3\n");
     V->parseFrom(&in);
 
     EXPECT_THAT(v, Eq(vector<int>{1, 2, 3}));
 }
 
 TEST_F(VectorTests, Parsing_WithoutSize_Failed_LeadingWhitespace) {
-    istringstream in(" 1 2 3");
+    InputReader in(" 1 2 3");
 
     try {
         V->parseFrom(&in);
@@ -78,7 +101,7 @@ TEST_F(VectorTests, Parsing_WithoutSize_Failed_LeadingWhitespace) {
 }
 
 TEST_F(VectorTests, Parsing_WithoutSize_Failed_MissingVariable) {
-    istringstream in("1 2  3");
+    InputReader in("1 2  3");
 
     try {
         V->parseFrom(&in);
@@ -90,7 +113,7 @@ TEST_F(VectorTests, Parsing_WithoutSize_Failed_MissingVariable) {
 
 TEST_F(VectorTests, Printing_WithoutSize) {
     v = {1, 2, 3};
-    ostringstream out;
+    OutputWriter out;
     V->printTo(&out);
 
     EXPECT_THAT(out.str(), Eq("1 2 3"));
@@ -98,11 +121,11 @@ TEST_F(VectorTests, Printing_WithoutSize) {
 
 TEST_F(VectorTests, Printing_Elements) {
     v = {1, 2, 3};
-    ostringstream out;
+    OutputWriter out;
     V->printElementTo(0, &out);
-    out << ' ';
+    out.write(' ');
     V->printElementTo(1, &out);
-    out << ' ';
+    out.write(' ');
     V->printElementTo(2, &out);
 
     EXPECT_THAT(out.str(), Eq("1 2 3"));
@@ -8,7 +8,6 @@ using ::testing::Eq;
 using ::testing::StrEq;
 using ::testing::Test;
 
-using std::istringstream;
 using std::ostringstream;
 
 namespace tcframe {
@@ -16,19 +15,19 @@ namespace tcframe {
 class WhitespaceManipulatorTests : public Test {};
 
 TEST_F(WhitespaceManipulatorTests, Parsing_Space_Successful) {
-    istringstream in(" 123");
+    InputReader in(" 123");
     EXPECT_NO_THROW({
-        WhitespaceManipulator::parseSpace(&in, "'N'");
+        WhitespaceManipulator::parseSpace(&in, TokenContext("'N'"));
     });
     int M;
-    in >> M;
+    in.read(M);
     EXPECT_THAT(M, Eq(123));
 }
 
 TEST_F(WhitespaceManipulatorTests, Parsing_Space_Failed) {
-    istringstream in("123");
+    InputReader in("123");
     try {
-        WhitespaceManipulator::parseSpace(&in, "'N'");
+        WhitespaceManipulator::parseSpace(&in, TokenContext("'N'"));
         FAIL();
     } catch (runtime_error& e) {
         EXPECT_THAT(e.what(), StrEq("Expected: <space> after 'N'"));
@@ -36,19 +35,19 @@ TEST_F(WhitespaceManipulatorTests, Parsing_Space_Failed) {
 }
 
 TEST_F(WhitespaceManipulatorTests, Parsing_SpaceAfterMissingNewline_Successful) {
-    istringstream in(" 123");
+    InputReader in(" 123");
     EXPECT_NO_THROW({
-        WhitespaceManipulator::parseSpaceAfterMissingNewline(&in, "'N'");
+        WhitespaceManipulator::parseSpaceAfterMissingNewline(&in, TokenContext("'N'"));
     });
     int M;
-    in >> M;
+    in.read(M);
     EXPECT_THAT(M, Eq(123));
 }
 
 TEST_F(WhitespaceManipulatorTests, Parsing_SpaceAfterMissingNewline_Failed) {
-    istringstream in("123");
+    InputReader in("123");
     try {
-        WhitespaceManipulator::parseSpaceAfterMissingNewline(&in, "'N'");
+        WhitespaceManipulator::parseSpaceAfterMissingNewline(&in, TokenContext("'N'"));
         FAIL();
     } catch (runtime_error& e) {
         EXPECT_THAT(e.what(), StrEq("Expected: <space> or <newline> after 'N'"));
@@ -56,19 +55,19 @@ TEST_F(WhitespaceManipulatorTests, Parsing_SpaceAfterMissingNewline_Failed) {
 }
 
 TEST_F(WhitespaceManipulatorTests, Parsing_Newline_Successful) {
-    istringstream in("\n123");
+    InputReader in("\n123");
     EXPECT_NO_THROW({
-        WhitespaceManipulator::parseNewline(&in, "'N'");
+        WhitespaceManipulator::parseNewline(&in, TokenContext("'N'"));
     });
     int M;
-    in >> M;
+    in.read(M);
     EXPECT_THAT(M, Eq(123));
 }
 
 TEST_F(WhitespaceManipulatorTests, Parsing_Newline_Failed) {
-    istream* in = new istringstream("123");
+    InputReader* in = new InputReader("123");
     try {
-        WhitespaceManipulator::parseNewline(in, "'N'");
+        WhitespaceManipulator::parseNewline(in, TokenContext("'N'"));
         FAIL();
     } catch (runtime_error& e) {
         EXPECT_THAT(e.what(), StrEq("Expected: <newline> after 'N'"));
@@ -76,24 +75,24 @@ TEST_F(WhitespaceManipulatorTests, Parsing_Newline_Failed) {
 }
 
 TEST_F(WhitespaceManipulatorTests, IsEof_True) {
-    istream* in = new istringstream("");
+    InputReader* in = new InputReader("");
     EXPECT_TRUE(WhitespaceManipulator::isEof(in));
 }
 
 TEST_F(WhitespaceManipulatorTests, IsEof_False) {
-    istream* in = new istringstream("123");
+    InputReader* in = new InputReader("123");
     EXPECT_FALSE(WhitespaceManipulator::isEof(in));
 }
 
 TEST_F(WhitespaceManipulatorTests, EnsuringEof_Successful) {
-    istream* in = new istringstream("");
+    InputReader* in = new InputReader("");
     EXPECT_NO_THROW({
         WhitespaceManipulator::ensureEof(in);
     });
 }
 
 TEST_F(WhitespaceManipulatorTests, EnsuringEof_Failed) {
-    istream* in = new istringstream("123");
+    InputReader* in = new InputReader("123");
     try {
         WhitespaceManipulator::ensureEof(in);
         FAIL();
@@ -101,7 +100,7 @@ TEST_F(WhitespaceManipulatorTests, EnsuringEof_Failed) {
         EXPECT_THAT(e.what(), StrEq("Expected: <EOF>"));
     }
     try {
-        WhitespaceManipulator::ensureEof(in, "'N'");
+        WhitespaceManipulator::ensureEof(in, TokenContext("'N'"));
         FAIL();
     } catch (runtime_error& e) {
         EXPECT_THAT(e.what(), StrEq("Expected: <EOF> after 'N'"));
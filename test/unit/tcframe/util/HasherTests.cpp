@@ -0,0 +1,44 @@
+#include "gmock/gmock.h"
+
+#include <sstream>
+
+#include "tcframe/util/Hasher.hpp"
+
+using ::testing::Eq;
+using ::testing::Ne;
+using ::testing::Test;
+
+using std::istringstream;
+
+namespace tcframe {
+
+class HasherTests : public Test {};
+
+TEST_F(HasherTests, Hashing_Empty) {
+    EXPECT_THAT(Hasher().hex(), Eq("6c62272e07bb014262b821756295c58d"));
+}
+
+TEST_F(HasherTests, Hashing_Stream) {
+    istringstream in("a");
+    EXPECT_THAT(Hasher().addStream(&in).hex(), Eq("d228cb696f1a8caf78912b704e4a8964"));
+}
+
+TEST_F(HasherTests, Hashing_Stream_AllBytes) {
+    string bytes;
+    for (int i = 0; i < 3 * 256; i++) {
+        bytes += (char) (i % 256);
+    }
+    istringstream in(bytes);
+    EXPECT_THAT(Hasher().addStream(&in).hex(), Eq("ceced98447397784e46346c4dbaac68d"));
+}
+
+TEST_F(HasherTests, Hashing_Values) {
+    EXPECT_THAT(Hasher().add("ab").add("c").hex(), Eq(Hasher().add("ab").add("c").hex()));
+    EXPECT_THAT(Hasher().add("ab").add("c").hex(), Ne(Hasher().add("a").add("bc").hex()));
+}
+
+TEST_F(HasherTests, Hashing_Command_WithoutFiles) {
+    EXPECT_THAT(Hasher().addCommand("java Solution").hex(), Eq(Hasher().add("java Solution").hex()));
+}
+
+}